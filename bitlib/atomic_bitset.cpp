@@ -0,0 +1,226 @@
+/**
+ * @file atomic_bitset.cpp
+ * @implements atomic_bitset.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `atomic_bitset_t` class
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "atomic_bitset.h"
+#include "bitset_kernels.h"
+
+// Slots of the threads writing atomic bitsets: live threads hold distinct slots, taken at their first write and given back when they exit, so that a stripe owned by a slot has a single writer
+static std::mutex slotLock;
+static std::vector<size_t> releasedSlots;
+static size_t nextSlot = 0;
+
+static size_t acquireSlot() {
+	std::lock_guard<std::mutex> guard(slotLock);
+	if (releasedSlots.empty()) return nextSlot++;
+	// Lowest slot first, so that it falls within the owned stripes of as many bitsets as possible
+	const std::vector<size_t>::iterator lowest = std::min_element(releasedSlots.begin(), releasedSlots.end());
+	const size_t slot = *lowest;
+	releasedSlots.erase(lowest);
+	return slot;
+}
+
+static void releaseSlot(const size_t slot) {
+	std::lock_guard<std::mutex> guard(slotLock);
+	releasedSlots.push_back(slot);
+}
+
+// Holds the slot of a thread for its lifetime
+struct thread_slot_t {
+	const size_t index;
+
+	thread_slot_t() : index(acquireSlot()) {}
+
+	~thread_slot_t() {
+		releaseSlot(index);
+	}
+};
+
+static thread_local thread_slot_t threadSlot;
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+atomic_bitset_t::atomic_bitset_t(const size_t length) : words(new std::atomic<word_t>[length / 64 + (length % 64 != 0)]), storageWords(length / 64 + (length % 64 != 0)), bitLength(length), stripeStorage(), stripes(nullptr), ownedStripes(0) {
+	for (size_t index = 0; index < storageWords; ++index)
+		words[index].store(0, std::memory_order_relaxed);
+	makeStripes(0);
+	return;
+}
+
+atomic_bitset_t::atomic_bitset_t(const bitset_view_t& bits) : words(new std::atomic<word_t>[bits.wordCount()]), storageWords(bits.wordCount()), bitLength(bits.length()), stripeStorage(), stripes(nullptr), ownedStripes(0) {
+	for (size_t index = 0; index < storageWords; ++index)
+		words[index].store(bits.paddedWord(index), std::memory_order_relaxed);
+	makeStripes(bits.count());
+	return;
+}
+
+void atomic_bitset_t::makeStripes(const size_t population) {
+	// A stripe per hardware thread, but no more than cache lines of words: writers of one line contend on it anyway
+	const size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	ownedStripes = std::min(threads, std::max<size_t>((storageWords + 7) / 8, 1));
+	const size_t count = ownedStripes + 1;
+	stripeStorage.reset(new char[(count + 1) * sizeof(stripe_t)]);
+	char* head = stripeStorage.get() + (sizeof(stripe_t) - (size_t)((uintptr_t)stripeStorage.get() % sizeof(stripe_t))) % sizeof(stripe_t);
+	stripes = reinterpret_cast<stripe_t*>(head);
+	for (size_t index = 0; index < count; ++index) {
+		new (&stripes[index].sets) std::atomic<uint64_t>(0);
+		new (&stripes[index].resets) std::atomic<uint64_t>(0);
+	}
+	stripes[ownedStripes].sets.store(population, std::memory_order_relaxed);
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+void atomic_bitset_t::addChanges(const uint64_t sets, const uint64_t resets) {
+	const size_t slot = threadSlot.index;
+	if (slot < ownedStripes) {
+		// The calling thread is the only writer of its stripe, thus needs no read-modify-write
+		stripe_t& own = stripes[slot];
+		if (sets != 0) own.sets.store(own.sets.load(std::memory_order_relaxed) + sets, std::memory_order_release);
+		if (resets != 0) own.resets.store(own.resets.load(std::memory_order_relaxed) + resets, std::memory_order_release);
+	} else {
+		stripe_t& shared = stripes[ownedStripes];
+		if (sets != 0) shared.sets.fetch_add(sets, std::memory_order_release);
+		if (resets != 0) shared.resets.fetch_add(resets, std::memory_order_release);
+	}
+}
+
+uint64_t atomic_bitset_t::collect(uint64_t& sets, uint64_t& resets) const {
+	sets = resets = 0;
+	for (size_t index = 0; index <= ownedStripes; ++index) {
+		sets += stripes[index].sets.load(std::memory_order_acquire);
+		resets += stripes[index].resets.load(std::memory_order_acquire);
+	}
+	return sets + resets;
+}
+
+atomic_bitset_t::word_t atomic_bitset_t::orWord(const size_t index, const word_t mask) {
+	return words[index].fetch_or(mask, std::memory_order_acq_rel);
+}
+
+atomic_bitset_t::word_t atomic_bitset_t::andNotWord(const size_t index, const word_t mask) {
+	return words[index].fetch_and(~mask, std::memory_order_acq_rel);
+}
+
+size_t atomic_bitset_t::length() const {
+	return bitLength;
+}
+
+bool atomic_bitset_t::test(const size_t index) const {
+	return ((words[index / 64].load(std::memory_order_acquire) >> (index % 64)) & 1) != 0;
+}
+
+void atomic_bitset_t::set(const size_t index) {
+	testAndSet(index);
+}
+
+void atomic_bitset_t::reset(const size_t index) {
+	testAndReset(index);
+}
+
+bool atomic_bitset_t::testAndSet(const size_t index) {
+	const word_t mask = (word_t)1 << (index % 64);
+	const bool previous = (orWord(index / 64, mask) & mask) != 0;
+	if (!previous) addChanges(1, 0);
+	return previous;
+}
+
+bool atomic_bitset_t::testAndReset(const size_t index) {
+	const word_t mask = (word_t)1 << (index % 64);
+	const bool previous = (andNotWord(index / 64, mask) & mask) != 0;
+	if (previous) addChanges(0, 1);
+	return previous;
+}
+
+size_t atomic_bitset_t::fetchOr(const size_t first, const size_t last) {
+	if (first > last || last > bitLength)
+		throw std::out_of_range("atomic_bitset_t::fetchOr: range exceeds the bitset");
+	size_t changed = 0;
+	for (size_t index = first / 64; first < last && index <= (last - 1) / 64; ++index) {
+		word_t mask = ~(word_t)0;
+		if (index == first / 64) mask &= ~(word_t)0 << (first % 64);
+		if (index == (last - 1) / 64) mask &= ~(word_t)0 >> (63 - (last - 1) % 64);
+		changed += popcountWord(~orWord(index, mask) & mask);
+	}
+	if (changed != 0) addChanges(changed, 0);
+	return changed;
+}
+
+size_t atomic_bitset_t::fetchOr(const bitset_view_t& bits) {
+	const size_t count = std::min(storageWords, bits.wordCount());
+	size_t changed = 0;
+	for (size_t index = 0; index < count; ++index) {
+		const word_t mask = bits.paddedWord(index) & bitsetTailMask(bitLength, index);
+		// Words with nothing to set are not written, so that their cache lines stay shared
+		if (mask != 0) changed += popcountWord(~orWord(index, mask) & mask);
+	}
+	if (changed != 0) addChanges(changed, 0);
+	return changed;
+}
+
+size_t atomic_bitset_t::claimFirst(const size_t from) {
+	if (storageWords == 0) return bitset_t::npos;
+	const size_t start = (from < bitLength) ? from / 64 : 0;
+	for (size_t step = 0; step <= storageWords; ++step) {
+		// The word of from is visited twice, its bits before from last
+		const size_t index = (start + step) % storageWords;
+		word_t usable = bitsetTailMask(bitLength, index);
+		if (step == 0 && from < bitLength) usable &= ~(word_t)0 << (from % 64);
+		word_t value = words[index].load(std::memory_order_relaxed);
+		while ((~value & usable) != 0) {
+			const word_t bit = (word_t)1 << trailingZeros(~value & usable);
+			value = orWord(index, bit);
+			if ((value & bit) == 0) {
+				addChanges(1, 0);
+				return index * 64 + trailingZeros(bit);
+			}
+		}
+	}
+	return bitset_t::npos;
+}
+
+size_t atomic_bitset_t::count() const {
+	return readStable([]() {});
+}
+
+void atomic_bitset_t::resetAll() {
+	size_t changed = 0;
+	for (size_t index = 0; index < storageWords; ++index)
+		changed += popcountWord(words[index].exchange(0, std::memory_order_acq_rel));
+	if (changed != 0) addChanges(0, changed);
+}
+
+bitset_t atomic_bitset_t::snapshot() const {
+	bitset_t::word_vector_t copy(storageWords);
+	readStable([&]() {
+		for (size_t index = 0; index < storageWords; ++index)
+			copy[index] = words[index].load(std::memory_order_relaxed);
+	});
+	return bitset_t(std::move(copy), bitLength);
+}
@@ -0,0 +1,256 @@
+/**
+ * @file atomic_bitset.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `atomic_bitset_t` class
+ */
+
+#ifndef bitlib___atomic_bitset_h
+#define bitlib___atomic_bitset_h
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "bitset_type.h"
+#include "bitset_view.h"
+
+/**
+ * @brief Fixed-length bitset shared by threads, modified with lock-free atomic operations
+ *
+ * @details Stores the bits as `bitset_t` does, in words of type `std::atomic<uint64_t>`; every operation on a bit is a single atomic read-modify-write of its word, and operations on ranges are a read-modify-write per word. The number of set bits is maintained by the writers, which add the bits they actually change to counters of their own thread, each alone in a cache line, so that writers of different words do not contend on a shared line and count() does not scan the words.
+ *
+ * count() and snapshot() read the counters before and after their work, and retry only if a writer completed a modification in between: they are lock-free and consistent, see count(). Writers never wait for readers; a single-bit write is one read-modify-write of its word, plus a store to the counters of its thread when it changes the bit.
+ *
+ * Modifications of a bit have acquire-release semantics: data published before setting a bit is visible to the thread which observes the bit set.
+ *
+ * @warning The length is fixed at construction, and indices <b>are not checked</b> by the single-bit operations.
+ *
+ * Example usage:
+ * @code
+ *	// Visited set of a parallel breadth-first search
+ *	atomic_bitset_t visited(vertexCount);
+ *	#pragma omp parallel for
+ *	for (size_t index = 0; index < frontier.size(); ++index)
+ *		for (const size_t next : neighbours(frontier[index]))
+ *			if (!visited.testAndSet(next)) nextFrontier.push(next);
+ * @endcode
+ */
+class atomic_bitset_t {
+public:
+	/**
+	 * @brief Storage word type, same as @ref bitset_t::word_t
+	 */
+	typedef bitset_t::word_t word_t;
+private:
+	std::unique_ptr<std::atomic<word_t>[]> words;
+	size_t storageWords;
+	size_t bitLength;
+
+	/**
+	 * @brief Numbers of bits set and reset by the writers of a thread slot, alone in a cache line
+	 *
+	 * @details Both counters only grow, thus a reader which finds the same total over every stripe twice knows that no writer completed a modification in between. A thread whose slot is below @ref ownedStripes is the only writer of its stripe and updates it with plain stores; the other threads share the last stripe and update it with atomic additions.
+	 */
+	struct stripe_t {
+		std::atomic<uint64_t> sets;
+		std::atomic<uint64_t> resets;
+		char padding[64 - 2 * sizeof(std::atomic<uint64_t>)];
+	};
+
+	/**
+	 * @brief Memory of the stripes, one cache line longer than them so that they start at a line boundary
+	 */
+	std::unique_ptr<char[]> stripeStorage;
+	stripe_t* stripes;
+
+	/**
+	 * @brief Number of stripes owned by a single thread, followed by the shared one
+	 */
+	size_t ownedStripes;
+
+	/**
+	 * @brief Allocates the stripes, and counts @p population bits set initially
+	 */
+	void makeStripes(const size_t population);
+
+	/**
+	 * @brief Counts @p sets bits set and @p resets bits reset by the calling thread, after it has changed them
+	 */
+	void addChanges(const uint64_t sets, const uint64_t resets);
+
+	/**
+	 * @brief Reads every stripe, stores the numbers of set and reset bits in @p sets and @p resets, and returns the number of modifications counted
+	 */
+	uint64_t collect(uint64_t& sets, uint64_t& resets) const;
+
+	/**
+	 * @brief Calls @p read until no writer has completed a modification since the counters were read before it, and returns the number of set bits at that point
+	 *
+	 * @details The loads of @p read may be relaxed; the fence after them orders them before the counters are read again. A retry means that another thread has completed a modification meanwhile, hence the readers are lock-free.
+	 */
+	template <class Read>
+	size_t readStable(const Read& read) const {
+		uint64_t sets = 0, resets = 0;
+		uint64_t before = collect(sets, resets);
+		for (;;) {
+			read();
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t after = collect(sets, resets);
+			if (after == before) return (size_t)(sets - resets);
+			before = after;
+		}
+	}
+
+	/**
+	 * @brief Sets the bits of @p mask in word @p index, and returns the previous value of the word
+	 */
+	word_t orWord(const size_t index, const word_t mask);
+
+	/**
+	 * @brief Resets the bits of @p mask in word @p index, and returns the previous value of the word
+	 */
+	word_t andNotWord(const size_t index, const word_t mask);
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Length `atomic_bitset_t` constructor
+	 *
+	 * @details Initialises a bitset of @p length bits, all reset.
+	 *
+	 * @param [in] length Number of bits.
+	 */
+	explicit atomic_bitset_t(const size_t length);
+
+	/**
+	 * @brief Copy `atomic_bitset_t` constructor from a bitset or view
+	 *
+	 * @param [in] bits Initial bits.
+	 */
+	explicit atomic_bitset_t(const bitset_view_t& bits);
+
+	atomic_bitset_t(const atomic_bitset_t&) = delete;
+	atomic_bitset_t& operator=(const atomic_bitset_t&) = delete;
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns length of the bitset
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns the bit at @p index
+	 */
+	bool test(const size_t index) const;
+
+	/**
+	 * @brief Sets the bit at @p index
+	 */
+	void set(const size_t index);
+
+	/**
+	 * @brief Resets the bit at @p index
+	 */
+	void reset(const size_t index);
+
+	/**
+	 * @brief Sets the bit at @p index, and returns its previous value
+	 *
+	 * @details Among threads setting the same bit concurrently, exactly one observes `false`.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Process every item once, whichever thread reaches it first
+	 *	if (!done.testAndSet(item)) process(item);
+	 * @endcode
+	 */
+	bool testAndSet(const size_t index);
+
+	/**
+	 * @brief Resets the bit at @p index, and returns its previous value
+	 *
+	 * @details Among threads resetting the same bit concurrently, exactly one observes `true`.
+	 */
+	bool testAndReset(const size_t index);
+
+	/**
+	 * @brief Sets the bits [@p first, @p last)
+	 *
+	 * @details Each word of the range is set with a single atomic OR, so that bits of the range are never reset by a concurrent writer of another part of the word.
+	 *
+	 * @return Number of bits of the range which were reset before.
+	 *
+	 * @throw std::out_of_range If the range exceeds the bitset.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Reserve a run of 16 slots
+	 *	slots.fetchOr(base, base + 16);
+	 * @endcode
+	 */
+	size_t fetchOr(const size_t first, const size_t last);
+
+	/**
+	 * @brief Sets the bits which are set in @p bits
+	 *
+	 * @details Merges a thread-local bitset, e.g. the part of a frontier found by a thread, with a word-wise atomic OR; bits of @p bits past length() are ignored.
+	 *
+	 * @return Number of bits of @p bits which were reset before.
+	 */
+	size_t fetchOr(const bitset_view_t& bits);
+
+	/**
+	 * @brief Sets the lowest reset bit at or after @p from, wrapping around to the start of the bitset, and returns its index
+	 *
+	 * @details Lock-free: a word with a reset bit is claimed with an atomic OR of that bit, and the next reset bit of the word is tried if another thread claimed it first. Starting threads at different @p from spreads them over the words.
+	 *
+	 * @return Index of the claimed bit, or @ref bitset_t::npos if every bit is set.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Slot allocator
+	 *	const size_t slot = freeSlots.claimFirst(threadIndex * 64);
+	 *	if (slot == bitset_t::npos) throw std::bad_alloc();
+	 *	...
+	 *	freeSlots.reset(slot);
+	 * @endcode
+	 */
+	size_t claimFirst(const size_t from = 0);
+
+	/**
+	 * @brief Returns the number of set bits
+	 *
+	 * @details Reads the counters maintained by the writers, in time proportional to the number of hardware threads rather than to the length. The count is consistent: it is the number of set bits after the modifications counted by their writers at one moment of the call, each of them whole, e.g. never part of a fetchOr() over many words. Writers count a modification just after they change the bits, thus a thread which observes a bit set by a writer still in flight may find it missing from the count.
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Resets every bit
+	 */
+	void resetAll();
+
+	/**
+	 * @brief Returns a copy of the bits
+	 *
+	 * @details The copy is read again if a writer completed a modification during the copy, thus it holds every modification completed before the call and none completed during it; a modification in flight may be partly in it, e.g. some words of a fetchOr().
+	 */
+	bitset_t snapshot() const;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef bitty_bit_c11_operators_h
 #define bitty_bit_c11_operators_h
 
+#include <cstdint>
 #include "bit_type.h"
 
 //   #######  ########  ######## ########  ######## ##    ##  ######
@@ -15,30 +16,50 @@ struct bitwise_xor : public std::binary_function<bit_t, bit_t, bit_t> {
 	bit_t operator() (bit_t left, bit_t right) {
 		return left ^ right;
 	}
+
+	uint64_t operator() (uint64_t left, uint64_t right) {
+		return left ^ right;
+	}
 };
 
 struct bitwise_and : public std::binary_function<bit_t, bit_t, bit_t> {
 	bit_t operator() (bit_t left, bit_t right) {
 		return left & right;
 	}
+
+	uint64_t operator() (uint64_t left, uint64_t right) {
+		return left & right;
+	}
 };
 
 struct bitwise_or : public std::binary_function<bit_t, bit_t, bit_t> {
 	bit_t operator() (bit_t left, bit_t right) {
 		return left | right;
 	}
+
+	uint64_t operator() (uint64_t left, uint64_t right) {
+		return left | right;
+	}
 };
 
 struct bitwise_nand : public std::binary_function<bit_t, bit_t, bit_t> {
 	bit_t operator() (bit_t left, bit_t right) {
 		return nand(left, right);
 	}
+
+	uint64_t operator() (uint64_t left, uint64_t right) {
+		return ~(left & right);
+	}
 };
 
 struct bitwise_nor : public std::binary_function<bit_t, bit_t, bit_t> {
 	bit_t operator() (bit_t left, bit_t right) {
 		return nor(left, right);
 	}
+
+	uint64_t operator() (uint64_t left, uint64_t right) {
+		return ~(left | right);
+	}
 };
 
 struct bitwise_equal : public std::binary_function<bit_t, bit_t, bool> {
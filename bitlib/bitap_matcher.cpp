@@ -0,0 +1,190 @@
+/**
+ * @file bitap_matcher.cpp
+ * @implements bitap_matcher.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `bitap_matcher_t` class
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "bitap_matcher.h"
+#include "bitset_kernels.h"
+
+
+
+//   ######  ######## ######## ########
+//  ##    ##    ##    ##       ##     ##
+//  ##          ##    ##       ##     ##
+//   ######     ##    ######   ########
+//        ##    ##    ##       ##
+//  ##    ##    ##    ##       ##
+//   ######     ##    ######## ##
+
+template <bool Edits>
+bool bitap_matcher_t::step(const uint64_t* mask) {
+	uint64_t* state = states.data();
+	uint64_t carry = 0, found = 0;
+	if (maxErrors == 0) {
+		// Reading the old state from a separate buffer keeps the words independent, so that the loop vectorises
+		const uint64_t* old = states.data();
+		uint64_t* next = scratch.data();
+		next[0] = ((old[0] << 1) | firsts[0]) & mask[0];
+		found = next[0] & finals[0];
+		for (size_t word = 1; word < words; ++word) {
+			next[word] = ((old[word] << 1) | (old[word - 1] >> 63) | firsts[word]) & mask[word];
+			found |= next[word] & finals[word];
+		}
+		states.swap(scratch);
+		return found != 0;
+	}
+	// Exact state first, the previous value of every state is kept in scratch for the next one
+	for (size_t word = 0; word < words; ++word) {
+		const uint64_t old = state[word];
+		scratch[word] = old;
+		state[word] = ((old << 1) | carry | firsts[word]) & mask[word];
+		carry = old >> 63;
+	}
+	for (size_t errors = 1; errors <= maxErrors; ++errors) {
+		const uint64_t* updated = state;
+		state += words;
+		uint64_t ownCarry = 0, previousCarry = 0, updatedCarry = 0;
+		for (size_t word = 0; word < words; ++word) {
+			const uint64_t old = state[word], previous = scratch[word];
+			uint64_t value = (((old << 1) | ownCarry | firsts[word]) & mask[word]) | (previous << 1) | previousCarry | firsts[word];
+			if (Edits) {
+				value |= previous | (updated[word] << 1) | updatedCarry;
+				updatedCarry = updated[word] >> 63;
+			}
+			ownCarry = old >> 63;
+			previousCarry = previous >> 63;
+			scratch[word] = old;
+			state[word] = value;
+		}
+	}
+	for (size_t word = 0; word < words; ++word)
+		found |= state[word] & finals[word];
+	return found != 0;
+}
+
+void bitap_matcher_t::report(std::vector<pattern_match_t>& matches) const {
+	const uint64_t* last = states.data() + maxErrors * words;
+	for (size_t word = 0; word < words; ++word) {
+		for (uint64_t rest = last[word] & finals[word]; rest != 0; rest &= rest - 1) {
+			const size_t bit = trailingZeros(rest);
+			size_t errors = 0;
+			while ((states[errors * words + word] & ((uint64_t)1 << bit)) == 0)
+				++errors;
+			const size_t pattern = std::lower_bound(lasts.begin(), lasts.end(), word * 64 + bit) - lasts.begin();
+			matches.push_back({pattern, offset, errors});
+		}
+	}
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+bitap_matcher_t::bitap_matcher_t(const std::vector<std::string>& patterns, const size_t errors, const distance_t distance) {
+	if (patterns.empty())
+		throw std::invalid_argument("bitap_matcher_t::bitap_matcher_t: no patterns");
+	size_t bits = 0;
+	for (const std::string& pattern : patterns) {
+		if (pattern.empty())
+			throw std::invalid_argument("bitap_matcher_t::bitap_matcher_t: empty pattern");
+		bits += pattern.size();
+		lasts.push_back(bits - 1);
+	}
+	this->words = (bits + 63) / 64;
+	this->maxErrors = errors;
+	this->distance = distance;
+	firsts.assign(words, 0);
+	finals.assign(words, 0);
+	masks.assign(256 * words, 0);
+	size_t bit = 0;
+	for (const std::string& pattern : patterns) {
+		firsts[bit / 64] |= (uint64_t)1 << (bit % 64);
+		for (const char character : pattern) {
+			masks[(unsigned char)character * words + bit / 64] |= (uint64_t)1 << (bit % 64);
+			++bit;
+		}
+		finals[(bit - 1) / 64] |= (uint64_t)1 << ((bit - 1) % 64);
+	}
+	scratch.assign(words, 0);
+	reset();
+	return;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t bitap_matcher_t::size() const {
+	return lasts.size();
+}
+
+size_t bitap_matcher_t::position() const {
+	return offset;
+}
+
+void bitap_matcher_t::reset() {
+	offset = 0;
+	states.assign((maxErrors + 1) * words, 0);
+	if (distance != distance_t::levenshtein) return;
+	// Up to j leading characters of every pattern can be deleted before the stream starts
+	for (size_t errors = 1; errors <= maxErrors; ++errors) {
+		uint64_t* state = states.data() + errors * words;
+		size_t first = 0;
+		for (const size_t last : lasts) {
+			for (size_t bit = first; bit < std::min(first + errors, last + 1); ++bit)
+				state[bit / 64] |= (uint64_t)1 << (bit % 64);
+			first = last + 1;
+		}
+	}
+}
+
+void bitap_matcher_t::scan(const char* text, const size_t length, std::vector<pattern_match_t>& matches) {
+	const unsigned char* bytes = (const unsigned char*)text;
+	if (words == 1 && maxErrors == 0) {
+		// Single-word exact matching keeps the state in a register
+		const size_t start = offset;
+		const uint64_t first = firsts[0], final = finals[0];
+		uint64_t state = states[0];
+		for (size_t index = 0; index < length; ++index) {
+			state = ((state << 1) | first) & masks[bytes[index]];
+			if ((state & final) != 0) {
+				states[0] = state;
+				offset = start + index + 1;
+				report(matches);
+			}
+		}
+		states[0] = state;
+		offset = start + length;
+		return;
+	}
+	for (size_t index = 0; index < length; ++index) {
+		const uint64_t* mask = masks.data() + bytes[index] * words;
+		++offset;
+		if (distance == distance_t::levenshtein ? step<true>(mask) : step<false>(mask))
+			report(matches);
+	}
+}
+
+std::vector<pattern_match_t> bitap_matcher_t::find(const std::string& text) {
+	std::vector<pattern_match_t> matches;
+	reset();
+	scan(text.data(), text.size(), matches);
+	return matches;
+}
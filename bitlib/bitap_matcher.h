@@ -0,0 +1,218 @@
+/**
+ * @file bitap_matcher.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `bitap_matcher_t` class
+ */
+
+#ifndef bitlib___bitap_matcher_h
+#define bitlib___bitap_matcher_h
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Occurrence of a pattern found by the matcher
+ */
+struct pattern_match_t {
+	/**
+	 * @brief Index of the pattern in the list passed to the matcher
+	 */
+	size_t pattern;
+
+	/**
+	 * @brief Offset of the end of the occurrence in the stream, i.e. one past its last character
+	 */
+	size_t end;
+
+	/**
+	 * @brief Smallest number of errors the occurrence ending at @ref end can be matched with
+	 */
+	size_t errors;
+};
+
+/**
+ * @brief Streaming multi-pattern matcher based on the Shift-And (bitap) algorithm
+ *
+ * @details All patterns are concatenated into a single state vector of one bit per pattern character, stored packed into 64-bit words with the same layout as `bitset_t` (bit @c i in the word @c i / 64). Bit @c i of the state is set while the pattern prefix ending at the character @c i matches the text read so far; for every input character the state is shifted up by one bit, the first bit of every pattern is set, and the result is and-ed with the precomputed mask of the character. Thus a character costs a few word operations per 64 pattern characters, regardless of the number of patterns, and patterns may be of any length.
+ *
+ * Approximate matching keeps one more state per allowed error (Wu, Manber, "Fast Text Searching Allowing Errors"):
+ *	| Distance  | State of @c j errors after reading character @c c                 |
+ *	|:----------|:------------------------------------------------------------------|
+ *	|hamming    |`(S(R[j]) & B[c]) \| S(R[j - 1])`                                  |
+ *	|levenshtein|`(S(R[j]) & B[c]) \| R[j - 1] \| S(R[j - 1]) \| S(R'[j - 1])`       |
+ * where @c S shifts the state and sets the first bit of every pattern, @c B[c] is the mask of the character and @c R' is the updated state: the terms stand for a match, an inserted, a substituted and a deleted character.
+ *
+ * Text is read in chunks of any size with scan(); the state is kept between calls, so occurrences crossing chunk boundaries are found. Characters are compared as `unsigned char` bytes.
+ *
+ * Example usage:
+ * @code
+ *	// Find two keywords with up to one typo in a log stream
+ *	bitap_matcher_t matcher({"timeout", "refused"}, 1, bitap_matcher_t::distance_t::levenshtein);
+ *	std::vector<pattern_match_t> matches;
+ *	while (readChunk(buffer, &length))
+ *		matcher.scan(buffer, length, matches);
+ * @endcode
+ */
+class bitap_matcher_t {
+public:
+	/**
+	 * @brief Distance the errors are counted in
+	 */
+	enum class distance_t {
+		hamming,	///< Substituted characters only, occurrences are as long as the pattern
+		levenshtein	///< Substituted, inserted and deleted characters
+	};
+private:
+	/**
+	 * @brief Number of words of a single state or mask
+	 */
+	size_t words;
+
+	/**
+	 * @brief Number of errors allowed
+	 */
+	size_t maxErrors;
+
+	/**
+	 * @brief Distance the errors are counted in
+	 */
+	distance_t distance;
+
+	/**
+	 * @brief Number of characters read since the construction or the last reset()
+	 */
+	size_t offset;
+
+	/**
+	 * @brief Bit of the last character of every pattern, in the order of the patterns
+	 */
+	std::vector<size_t> lasts;
+
+	/**
+	 * @brief Mask of the first character of every pattern
+	 */
+	std::vector<uint64_t> firsts;
+
+	/**
+	 * @brief Mask of the last character of every pattern
+	 */
+	std::vector<uint64_t> finals;
+
+	/**
+	 * @brief Masks of the pattern characters equal to each of 256 bytes, @ref words words each
+	 */
+	std::vector<uint64_t> masks;
+
+	/**
+	 * @brief States for 0 to @ref maxErrors errors, @ref words words each
+	 */
+	std::vector<uint64_t> states;
+
+	/**
+	 * @brief Copy of the state of one error less before the update, used by the approximate step
+	 */
+	std::vector<uint64_t> scratch;
+
+	/**
+	 * @brief Updates the states after reading a character of the given @p mask
+	 *
+	 * @return Whether the state of @ref maxErrors errors has the last character of any pattern set.
+	 */
+	template <bool Edits>
+	bool step(const uint64_t* mask);
+
+	/**
+	 * @brief Appends the occurrences whose last characters are set in the state of @ref maxErrors errors
+	 */
+	void report(std::vector<pattern_match_t>& matches) const;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Matcher constructor
+	 *
+	 * @param [in] patterns Patterns to search for, in any number and of any length.
+	 * @param [in] errors Largest number of errors an occurrence may have.
+	 * @param [in] distance Distance the errors are counted in.
+	 *
+	 * @throw std::invalid_argument If @p patterns is empty or contains an empty pattern.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Exact matcher
+	 *	bitap_matcher_t exact({"GET ", "POST "});
+	 *
+	 *	// Up to two substituted characters
+	 *	bitap_matcher_t fuzzy({"ACGTTGCA"}, 2, bitap_matcher_t::distance_t::hamming);
+	 * @endcode
+	 */
+	bitap_matcher_t(const std::vector<std::string>& patterns, const size_t errors = 0, const distance_t distance = distance_t::hamming);
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns the number of patterns
+	 */
+	size_t size() const;
+
+	/**
+	 * @brief Returns the number of characters read since the construction or the last reset()
+	 */
+	size_t position() const;
+
+	/**
+	 * @brief Forgets the characters read so far
+	 *
+	 * @details The next character read is treated as the start of a new stream, at offset zero.
+	 */
+	void reset();
+
+	/**
+	 * @brief Reads a chunk of the stream
+	 *
+	 * @details Occurrences are appended in the order of their ends, and in the order of the patterns for the same end. With errors allowed, an occurrence is reported for every end offset within the distance, e.g. both `"abc"` and `"abcd"` end an occurrence of `"abc"` with one insertion.
+	 *
+	 * @param [in] text Characters of the chunk.
+	 * @param [in] length Number of characters in the chunk.
+	 * @param [out] matches Vector to append the occurrences to.
+	 *
+	 * Example usage:
+	 * @code
+	 *	std::vector<pattern_match_t> matches;
+	 *	matcher.scan(line.data(), line.size(), matches);
+	 *	for (const pattern_match_t& match : matches)
+	 *		std::cout << match.pattern << " at " << match.end << std::endl;
+	 * @endcode
+	 */
+	void scan(const char* text, const size_t length, std::vector<pattern_match_t>& matches);
+
+	/**
+	 * @brief Finds every occurrence in @p text
+	 *
+	 * @details Resets the matcher and reads the whole @p text as a single stream.
+	 *
+	 * @param [in] text Text to search.
+	 *
+	 * @return Occurrences, ordered as by scan().
+	 */
+	std::vector<pattern_match_t> find(const std::string& text);
+};
+
+#endif
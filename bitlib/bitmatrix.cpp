@@ -0,0 +1,315 @@
+/**
+ * @file bitmatrix.cpp
+ * @implements bitmatrix.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `bitmatrix_t` class and of the 64 by 64 bit transpose kernel
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "bitmatrix.h"
+#include "bitset_kernels.h"
+#include "hamming_batch.h"
+
+// Number of rows of the right operand tabulated at once by the Method of Four Russians
+static const size_t tableBits = 8;
+
+static size_t wordsFor(const size_t bits) {
+	return (bits + 63) / 64;
+}
+
+void transposeBlock64(uint64_t* block) {
+	uint64_t mask = 0x00000000FFFFFFFFULL;
+	for (unsigned width = 32; width != 0; width >>= 1, mask ^= mask << width) {
+		// Swap the upper width columns of row k with the lower width columns of row k + width
+		for (unsigned row = 0; row < 64; row = ((row | width) + 1) & ~width) {
+			const uint64_t swapped = ((block[row] >> width) ^ block[row | width]) & mask;
+			block[row] ^= swapped << width;
+			block[row | width] ^= swapped;
+		}
+	}
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+bitmatrix_t::bitmatrix_t() : words(), rowCount(0), columnCount(0), stride(0) {
+	return;
+}
+
+bitmatrix_t::bitmatrix_t(const size_t rows, const size_t columns) : words(rows * wordsFor(columns), 0), rowCount(rows), columnCount(columns), stride(wordsFor(columns)) {
+	return;
+}
+
+bitmatrix_t::bitmatrix_t(const std::vector<bitset_t>& rows) : words(), rowCount(rows.size()), columnCount(rows.empty() ? 0 : rows[0].length()), stride(wordsFor(columnCount)) {
+	words.reserve(rowCount * stride);
+	for (const bitset_t& bits : rows) {
+		if (bits.length() != columnCount)
+			throw std::invalid_argument("bitmatrix_t::bitmatrix_t: rows differ in length");
+		words.insert(words.end(), bits.data(), bits.data() + stride);
+	}
+	return;
+}
+
+bitmatrix_t bitmatrix_t::identity(const size_t size) {
+	bitmatrix_t result(size, size);
+	for (size_t index = 0; index < size; ++index)
+		result.rowData(index)[index / 64] = (word_t)1 << (index % 64);
+	return result;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t bitmatrix_t::rows() const {
+	return rowCount;
+}
+
+size_t bitmatrix_t::columns() const {
+	return columnCount;
+}
+
+size_t bitmatrix_t::rowWords() const {
+	return stride;
+}
+
+const bitmatrix_t::word_t* bitmatrix_t::data() const {
+	return words.data();
+}
+
+bit_t bitmatrix_t::at(const size_t row, const size_t column) const {
+	if (row >= rowCount || column >= columnCount)
+		throw std::out_of_range("bitmatrix_t::at: position out of the matrix");
+	return bit_t(((rowData(row)[column / 64] >> (column % 64)) & 1) != 0);
+}
+
+void bitmatrix_t::set(const size_t row, const size_t column, const bool value) {
+	if (row >= rowCount || column >= columnCount)
+		throw std::out_of_range("bitmatrix_t::set: position out of the matrix");
+	const word_t mask = (word_t)1 << (column % 64);
+	if (value) rowData(row)[column / 64] |= mask;
+	else rowData(row)[column / 64] &= ~mask;
+}
+
+bitset_view_t bitmatrix_t::row(const size_t index) const {
+	if (index >= rowCount)
+		throw std::out_of_range("bitmatrix_t::row: index out of the matrix");
+	return bitset_view_t(rowData(index), columnCount);
+}
+
+void bitmatrix_t::setRow(const size_t index, const bitset_view_t& bits) {
+	if (index >= rowCount)
+		throw std::out_of_range("bitmatrix_t::setRow: index out of the matrix");
+	if (bits.length() != columnCount)
+		throw std::invalid_argument("bitmatrix_t::setRow: length differs from the number of columns");
+	word_t* target = rowData(index);
+	for (size_t word = 0; word < bits.commonWords(); ++word)
+		target[word] = bits.word(word);
+	for (size_t word = bits.commonWords(); word < stride; ++word)
+		target[word] = bits.paddedWord(word);
+}
+
+bitmatrix_t bitmatrix_t::transposed() const {
+	bitmatrix_t result(columnCount, rowCount);
+	uint64_t block[64];
+	for (size_t rowBlock = 0; rowBlock < rowCount; rowBlock += 64) {
+		const size_t height = std::min<size_t>(64, rowCount - rowBlock);
+		for (size_t columnWord = 0; columnWord < stride; ++columnWord) {
+			for (size_t row = 0; row < height; ++row)
+				block[row] = rowData(rowBlock + row)[columnWord];
+			std::fill(block + height, block + 64, 0);
+			transposeBlock64(block);
+			// Row j of the tile is column columnWord * 64 + j, that is row of the result
+			const size_t width = std::min<size_t>(64, columnCount - columnWord * 64);
+			for (size_t column = 0; column < width; ++column)
+				result.rowData(columnWord * 64 + column)[rowBlock / 64] = block[column];
+		}
+	}
+	return result;
+}
+
+
+
+//     ###    ##        ######   ######## ########  ########     ###
+//    ## ##   ##       ##    ##  ##       ##     ## ##     ##   ## ##
+//   ##   ##  ##       ##        ##       ##     ## ##     ##  ##   ##
+//  ##     ## ##       ##   #### ######   ########  ########  ##     ##
+//  ######### ##       ##    ##  ##       ##     ## ##   ##   #########
+//  ##     ## ##       ##    ##  ##       ##     ## ##    ##  ##     ##
+//  ##     ## ########  ######   ######## ########  ##     ## ##     ##
+
+bitset_t bitmatrix_t::operator*(const bitset_view_t& vector) const {
+	if (vector.length() != columnCount)
+		throw std::invalid_argument("bitmatrix_t::operator*: vector length differs from the number of columns");
+	const bitset_t packed(vector);
+	bitset_t::word_vector_t result(wordsFor(rowCount), 0);
+	scalarProducts(packed.data(), words.data(), rowCount, stride, result.data());
+	return bitset_t(std::move(result), rowCount);
+}
+
+bitset_t operator*(const bitset_view_t& vector, const bitmatrix_t& matrix) {
+	if (vector.length() != matrix.rowCount)
+		throw std::invalid_argument("bitmatrix_t::operator*: vector length differs from the number of rows");
+	bitset_t::word_vector_t sum(matrix.stride, 0);
+	const bitset_kernels_t& kernels = bitsetKernels();
+	for (size_t row = vector.findFirst(); row != bitset_t::npos; row = vector.findNext(row))
+		kernels.xorWords(sum.data(), matrix.rowData(row), matrix.stride);
+	return bitset_t(std::move(sum), matrix.columnCount);
+}
+
+bitmatrix_t bitmatrix_t::operator*(const bitmatrix_t& other) const {
+	if (columnCount != other.rowCount)
+		throw std::invalid_argument("bitmatrix_t::operator*: columns of the left matrix differ from rows of the right one");
+	bitmatrix_t result(rowCount, other.columnCount);
+	const size_t width = other.stride;
+	if (width == 0) return result;
+	const bitset_kernels_t& kernels = bitsetKernels();
+	std::vector<word_t> table(((size_t)1 << tableBits) * width, 0);
+	for (size_t first = 0; first < columnCount; first += tableBits) {
+		// Entry i is the sum of the rows first + j of other for the bits j set in i, one row XOR from a previous entry
+		const size_t group = std::min(tableBits, columnCount - first), entries = (size_t)1 << group;
+		for (size_t entry = 1; entry < entries; ++entry) {
+			word_t* target = table.data() + entry * width;
+			std::copy(table.data() + (entry & (entry - 1)) * width, table.data() + (entry & (entry - 1)) * width + width, target);
+			kernels.xorWords(target, other.rowData(first + trailingZeros(entry)), width);
+		}
+		// Groups start at multiples of tableBits, thus never straddle a word
+		for (size_t row = 0; row < rowCount; ++row) {
+			const size_t entry = (size_t)(rowData(row)[first / 64] >> (first % 64)) & (entries - 1);
+			if (entry != 0) kernels.xorWords(result.rowData(row), table.data() + entry * width, width);
+		}
+	}
+	return result;
+}
+
+bitmatrix_t bitmatrix_t::operator^(const bitmatrix_t& other) const {
+	bitmatrix_t result(*this);
+	result ^= other;
+	return result;
+}
+
+bitmatrix_t& bitmatrix_t::operator^=(const bitmatrix_t& other) {
+	if (rowCount != other.rowCount || columnCount != other.columnCount)
+		throw std::invalid_argument("bitmatrix_t::operator^=: matrices differ in dimensions");
+	bitsetKernels().xorWords(words.data(), other.words.data(), words.size());
+	return *this;
+}
+
+
+
+//  ######## ##       #### ##     ## #### ##    ##    ###    ######## ####  #######  ##    ##
+//  ##       ##        ##  ###   ###  ##  ###   ##   ## ##      ##     ##  ##     ## ###   ##
+//  ##       ##        ##  #### ####  ##  ####  ##  ##   ##     ##     ##  ##     ## ####  ##
+//  ######   ##        ##  ## ### ##  ##  ## ## ## ##     ##    ##     ##  ##     ## ## ## ##
+//  ##       ##        ##  ##     ##  ##  ##  #### #########    ##     ##  ##     ## ##  ####
+//  ##       ##        ##  ##     ##  ##  ##   ### ##     ##    ##     ##  ##     ## ##   ###
+//  ######## ######## #### ##     ## #### ##    ## ##     ##    ##    ####  #######  ##    ##
+
+size_t bitmatrix_t::eliminate(const size_t columns, const bool reduced, std::vector<size_t>* pivots) {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	size_t rank = 0;
+	for (size_t column = 0; column < columns && rank < rowCount; ++column) {
+		const size_t word = column / 64;
+		const word_t mask = (word_t)1 << (column % 64);
+		size_t pivot = rank;
+		while (pivot < rowCount && !(rowData(pivot)[word] & mask))
+			++pivot;
+		if (pivot == rowCount) continue;
+		if (pivot != rank) std::swap_ranges(rowData(pivot), rowData(pivot) + stride, rowData(rank));
+		// Rows from the rank on are zero left of the column, thus so is the pivot row
+		const word_t* source = rowData(rank) + word;
+		for (size_t row = reduced ? 0 : rank + 1; row < rowCount; ++row)
+			if (row != rank && (rowData(row)[word] & mask)) kernels.xorWords(rowData(row) + word, source, stride - word);
+		if (pivots != nullptr) pivots->push_back(column);
+		++rank;
+	}
+	return rank;
+}
+
+size_t bitmatrix_t::echelonize(const bool reduced) {
+	return eliminate(columnCount, reduced, nullptr);
+}
+
+size_t bitmatrix_t::rank() const {
+	bitmatrix_t copy(*this);
+	return copy.eliminate(columnCount, false, nullptr);
+}
+
+bool bitmatrix_t::solve(const bitset_view_t& rhs, bitset_t& solution) const {
+	if (rhs.length() != rowCount)
+		throw std::invalid_argument("bitmatrix_t::solve: right-hand side length differs from the number of rows");
+	// Augment the matrix with rhs as its last column
+	bitmatrix_t augmented(rowCount, columnCount + 1);
+	for (size_t row = 0; row < rowCount; ++row) {
+		std::copy(rowData(row), rowData(row) + stride, augmented.rowData(row));
+		if (rhs[row]) augmented.rowData(row)[columnCount / 64] |= (word_t)1 << (columnCount % 64);
+	}
+	std::vector<size_t> pivots;
+	const size_t rank = augmented.eliminate(columnCount, true, &pivots);
+	const size_t word = columnCount / 64;
+	const word_t mask = (word_t)1 << (columnCount % 64);
+	// A zero row of the matrix with a set right-hand side is the equation 0 = 1
+	for (size_t row = rank; row < rowCount; ++row)
+		if (augmented.rowData(row)[word] & mask) return false;
+	bitset_t::word_vector_t result(stride, 0);
+	for (size_t row = 0; row < rank; ++row)
+		if (augmented.rowData(row)[word] & mask) result[pivots[row] / 64] |= (word_t)1 << (pivots[row] % 64);
+	solution = bitset_t(std::move(result), columnCount);
+	return true;
+}
+
+
+
+//   ######   #######  ##     ## ########     ###    ########  ########
+//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+bool bitmatrix_t::operator==(const bitmatrix_t& other) const {
+	return rowCount == other.rowCount && columnCount == other.columnCount && words == other.words;
+}
+
+bool bitmatrix_t::operator!=(const bitmatrix_t& other) const {
+	return !(*this == other);
+}
+
+
+
+//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+std::string bitmatrix_t::toBinaryString() const {
+	std::string result;
+	for (size_t index = 0; index < rowCount; ++index) {
+		result += row(index).toBinaryString();
+		result += '\n';
+	}
+	return result;
+}
+
+std::ostream& operator<<(std::ostream& os, const bitmatrix_t& matrix) {
+	return os << matrix.toBinaryString();
+}
@@ -0,0 +1,366 @@
+/**
+ * @file bitmatrix.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `bitmatrix_t` class and of the 64 by 64 bit transpose kernel
+ */
+
+#ifndef bitlib___bitmatrix_h
+#define bitlib___bitmatrix_h
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_view.h"
+
+/**
+ * @brief Transposes the 64 by 64 bit matrix @p block in place
+ *
+ * @details Word @c i of @p block is row @c i, and bit @c j of it (from the least significant bit) is column @c j, as in `bitset_t`; afterwards bit @c j of word @c i holds what was bit @c i of word @c j. Swaps blocks of 32, 16, ... 1 bits between pairs of rows with masked shifts, 6 * 32 word swaps in all, instead of 4096 single-bit moves.
+ *
+ * @param [in,out] block Pointer to 64 words.
+ *
+ * Example usage:
+ * @code
+ *	uint64_t block[64] = {};
+ *	block[0] = 0x2;	// row 0, column 1
+ *	transposeBlock64(block);
+ *	// block[1] == 0x1, row 1, column 0
+ * @endcode
+ */
+void transposeBlock64(uint64_t* block);
+
+/**
+ * @brief Packed matrix over GF(2), the field of the bits with XOR as addition and AND as multiplication
+ *
+ * @details Rows are packed back to back, each in the layout of bitset_t::data() and padded to whole words (see rowWords()), so that a row is read as a @ref bitset_view_t without copying, and every row operation runs on whole words with the kernels selected by bitsetKernels(). Bits of the padding are always zero.
+ *
+ * Products use the Method of Four Russians: the rows of the right operand are taken eight at a time, all 256 of their sums are tabulated with one row XOR each, and every row of the left operand then adds one table entry per eight columns, instead of up to eight rows.
+ *
+ * Example usage:
+ * @code
+ *	// Parity-check matrix of the (7,4) Hamming code
+ *	bitmatrix_t check({bitset_t({1, 0, 1, 0, 1, 0, 1}), bitset_t({0, 1, 1, 0, 0, 1, 1}), bitset_t({0, 0, 0, 1, 1, 1, 1})});
+ *
+ *	// Syndrome of a received word, and the rank of the code
+ *	bitset_t syndrome = check * received;
+ *	size_t rank = check.rank();
+ * @endcode
+ */
+class bitmatrix_t {
+public:
+	/**
+	 * @brief Storage word type, same as @ref bitset_t::word_t
+	 */
+	typedef bitset_t::word_t word_t;
+private:
+	/**
+	 * @brief Rows of the matrix, @ref stride words each
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	std::vector<word_t> words;
+
+	size_t rowCount;
+	size_t columnCount;
+
+	/**
+	 * @brief Number of words per row
+	 */
+	size_t stride;
+
+	word_t* rowData(const size_t row) {
+		return words.data() + row * stride;
+	}
+
+	const word_t* rowData(const size_t row) const {
+		return words.data() + row * stride;
+	}
+
+	/**
+	 * @brief Brings the first @p columns columns into row echelon form, and returns the rank of these columns
+	 *
+	 * @details Rows below the rank are zero in these columns; with @p reduced, pivot columns are also zero above their pivot. @p pivots, if given, receives the pivot column of every row up to the rank.
+	 */
+	size_t eliminate(const size_t columns, const bool reduced, std::vector<size_t>* pivots);
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Default empty `bitmatrix_t` constructor
+	 *
+	 * @details Initialises a matrix of zero rows and zero columns.
+	 */
+	bitmatrix_t();
+
+	/**
+	 * @brief Dimensions `bitmatrix_t` constructor
+	 *
+	 * @details Initialises the zero matrix of @p rows rows and @p columns columns.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Generator matrix of a code of 32 data and 8 parity blocks
+	 *	bitmatrix_t generator(40, 32);
+	 * @endcode
+	 */
+	bitmatrix_t(const size_t rows, const size_t columns);
+
+	/**
+	 * @brief Rows `bitmatrix_t` constructor
+	 *
+	 * @details Initialises a matrix with copies of @p rows, all of which have the same length, the number of columns.
+	 *
+	 * @throw std::invalid_argument If the rows differ in length.
+	 */
+	explicit bitmatrix_t(const std::vector<bitset_t>& rows);
+
+	/**
+	 * @brief Returns the identity matrix of @p size rows and columns
+	 */
+	static bitmatrix_t identity(const size_t size);
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns the number of rows
+	 */
+	size_t rows() const;
+
+	/**
+	 * @brief Returns the number of columns, the length of every row
+	 */
+	size_t columns() const;
+
+	/**
+	 * @brief Returns the number of storage words of every row
+	 */
+	size_t rowWords() const;
+
+	/**
+	 * @brief Returns pointer to the packed rows
+	 *
+	 * @details Row @c i occupies the words [@c i * rowWords(), (@c i + 1) * rowWords()), in the bitset_t::data() layout; this is also the packed layout of hammingDistances().
+	 */
+	const word_t* data() const;
+
+	/**
+	 * @brief Returns the bit at @p row and @p column
+	 *
+	 * @throw std::out_of_range If @p row or @p column is out of the matrix.
+	 */
+	bit_t at(const size_t row, const size_t column) const;
+
+	/**
+	 * @brief Assigns @p value to the bit at @p row and @p column
+	 *
+	 * @throw std::out_of_range If @p row or @p column is out of the matrix.
+	 */
+	void set(const size_t row, const size_t column, const bool value = true);
+
+	/**
+	 * @brief Returns view of the row with @p index
+	 *
+	 * @throw std::out_of_range If @p index is not less than rows().
+	 *
+	 * @warning The view is invalidated by any operation which changes the dimensions of the matrix.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Copy a row out of the matrix
+	 *	bitset_t first = matrix.row(0);
+	 * @endcode
+	 */
+	bitset_view_t row(const size_t index) const;
+
+	/**
+	 * @brief Replaces the row with @p index by @p bits
+	 *
+	 * @throw std::out_of_range If @p index is not less than rows().
+	 * @throw std::invalid_argument If the length of @p bits differs from columns().
+	 */
+	void setRow(const size_t index, const bitset_view_t& bits);
+
+	/**
+	 * @brief Returns the transposed matrix
+	 *
+	 * @details Processes the matrix in tiles of 64 by 64 bits with transposeBlock64(), each read from 64 rows of the matrix and written to 64 rows of the result, so that every cache line is loaded once.
+	 */
+	bitmatrix_t transposed() const;
+
+
+
+	//     ###    ##        ######   ######## ########  ########     ###
+	//    ## ##   ##       ##    ##  ##       ##     ## ##     ##   ## ##
+	//   ##   ##  ##       ##        ##       ##     ## ##     ##  ##   ##
+	//  ##     ## ##       ##   #### ######   ########  ########  ##     ##
+	//  ######### ##       ##    ##  ##       ##     ## ##   ##   #########
+	//  ##     ## ##       ##    ##  ##       ##     ## ##    ##  ##     ##
+	//  ##     ## ########  ######   ######## ########  ##     ## ##     ##
+
+	/**
+	 * @brief Matrix-vector product
+	 *
+	 * @details Bit @c i of the result is the scalar product of row @c i and @p vector, the parity of the number of bits set in both, computed for 64 rows at a time with scalarProducts().
+	 *
+	 * @param [in] vector Column vector of columns() bits.
+	 *
+	 * @return Bitset of rows() bits.
+	 *
+	 * @throw std::invalid_argument If the length of @p vector differs from columns().
+	 */
+	bitset_t operator*(const bitset_view_t& vector) const;
+
+	/**
+	 * @brief Vector-matrix product
+	 *
+	 * @details The sum of the rows of @p matrix selected by the set bits of @p vector.
+	 *
+	 * @param [in] vector Row vector of @p matrix.rows() bits.
+	 * @param [in] matrix Matrix to multiply.
+	 *
+	 * @return Bitset of @p matrix.columns() bits.
+	 *
+	 * @throw std::invalid_argument If the length of @p vector differs from @p matrix.rows().
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Encode a message with a generator matrix
+	 *	bitset_t codeword = message * generator;
+	 * @endcode
+	 */
+	friend bitset_t operator*(const bitset_view_t& vector, const bitmatrix_t& matrix);
+
+	/**
+	 * @brief Matrix-matrix product, with the Method of Four Russians
+	 *
+	 * @return Matrix of rows() rows and @p other.columns() columns.
+	 *
+	 * @throw std::invalid_argument If columns() differs from @p other.rows().
+	 */
+	bitmatrix_t operator*(const bitmatrix_t& other) const;
+
+	/**
+	 * @brief Matrix sum, the XOR of the matrices
+	 *
+	 * @throw std::invalid_argument If the matrices differ in dimensions.
+	 */
+	bitmatrix_t operator^(const bitmatrix_t& other) const;
+
+	/**
+	 * @brief Adds @p other to the matrix
+	 *
+	 * @throw std::invalid_argument If the matrices differ in dimensions.
+	 */
+	bitmatrix_t& operator^=(const bitmatrix_t& other);
+
+
+
+	//  ######## ##       #### ##     ## #### ##    ##    ###    ######## ####  #######  ##    ##
+	//  ##       ##        ##  ###   ###  ##  ###   ##   ## ##      ##     ##  ##     ## ###   ##
+	//  ##       ##        ##  #### ####  ##  ####  ##  ##   ##     ##     ##  ##     ## ####  ##
+	//  ######   ##        ##  ## ### ##  ##  ## ## ## ##     ##    ##     ##  ##     ## ## ## ##
+	//  ##       ##        ##  ##     ##  ##  ##  #### #########    ##     ##  ##     ## ##  ####
+	//  ##       ##        ##  ##     ##  ##  ##   ### ##     ##    ##     ##  ##     ## ##   ###
+	//  ######## ######## #### ##     ## #### ##    ## ##     ##    ##    ####  #######  ##    ##
+
+	/**
+	 * @brief Brings the matrix into row echelon form by Gaussian elimination
+	 *
+	 * @details Every pivot is found by testing one bit per row, and eliminated from another row with one XOR of the remaining words of the rows.
+	 *
+	 * @param [in] reduced Whether to also clear the pivot columns above their pivots (reduced row echelon form).
+	 *
+	 * @return Rank of the matrix, the number of nonzero rows left.
+	 */
+	size_t echelonize(const bool reduced = false);
+
+	/**
+	 * @brief Returns the rank of the matrix
+	 *
+	 * @details Eliminates a copy of the matrix, see echelonize().
+	 */
+	size_t rank() const;
+
+	/**
+	 * @brief Solves the linear system `*this * solution == rhs`
+	 *
+	 * @details Eliminates the matrix augmented with @p rhs into reduced row echelon form. Of several solutions, the one with all free variables reset is returned.
+	 *
+	 * @param [in] rhs Right-hand side of rows() bits.
+	 * @param [out] solution Receives a solution of columns() bits, if there is one.
+	 *
+	 * @return Whether the system has a solution.
+	 *
+	 * @throw std::invalid_argument If the length of @p rhs differs from rows().
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Recover the data blocks from the received ones
+	 *	bitset_t data;
+	 *	if (!received.solve(blocks, data)) requestRetransmission();
+	 * @endcode
+	 */
+	bool solve(const bitset_view_t& rhs, bitset_t& solution) const;
+
+
+
+	//   ######   #######  ##     ## ########     ###    ########  ########
+	//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+	//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+	//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+	//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+	//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+	//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+	/**
+	 * @brief Equal to operator
+	 *
+	 * @details Matrices are equal when they have the same dimensions and the same bits set.
+	 */
+	bool operator==(const bitmatrix_t& other) const;
+
+	/**
+	 * @brief Not equal to operator
+	 */
+	bool operator!=(const bitmatrix_t& other) const;
+
+
+
+	//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+	//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+	//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+	//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+	//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+	//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+	//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+	/**
+	 * @brief Returns string with the binary representation of the rows, one per line
+	 */
+	std::string toBinaryString() const;
+
+	/**
+	 * @brief Inserts @p matrix binary representation into @p os, see toBinaryString()
+	 */
+	friend std::ostream& operator<<(std::ostream& os, const bitmatrix_t& matrix);
+};
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @file bitset_allocator.cpp
+ * @implements bitset_allocator.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `bitset_arena_t` and `bitset_pool_t` memory resources
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "bitset_allocator.h"
+
+const size_t bitset_memory_t::alignment;
+const size_t bitset_pool_t::classCount;
+const size_t bitset_pool_t::largestClass;
+
+// Rounds bytes up to a whole number of alignment units, so that every block handed out starts aligned
+static size_t roundUp(const size_t bytes) {
+	return (bytes + bitset_memory_t::alignment - 1) / bitset_memory_t::alignment * bitset_memory_t::alignment;
+}
+
+// Takes an aligned block from the global heap; the pointer returned by operator new is kept just before the block
+static void* alignedAllocate(const size_t bytes) {
+	const size_t alignment = bitset_memory_t::alignment;
+	char* raw = static_cast<char*>(::operator new(bytes + alignment));
+	char* head = raw + alignment - (size_t)((uintptr_t)raw % alignment);
+	std::memcpy(head - sizeof(char*), &raw, sizeof(char*));
+	return head;
+}
+
+static void alignedFree(void* pointer) {
+	char* raw = nullptr;
+	std::memcpy(&raw, static_cast<char*>(pointer) - sizeof(char*), sizeof(char*));
+	::operator delete(raw);
+}
+
+
+
+//     ###    ########  ######## ##    ##    ###
+//    ## ##   ##     ## ##       ###   ##   ## ##
+//   ##   ##  ##     ## ##       ####  ##  ##   ##
+//  ##     ## ########  ######   ## ## ## ##     ##
+//  ######### ##   ##   ##       ##  #### #########
+//  ##     ## ##    ##  ##       ##   ### ##     ##
+//  ##     ## ##     ## ######## ##    ## ##     ##
+
+bitset_arena_t::bitset_arena_t(const size_t blockBytes) : blocks(), blockBytes(roundUp(std::max<size_t>(blockBytes, 1))), cursor(nullptr), limit(nullptr), usedBytes(0) {
+	return;
+}
+
+bitset_arena_t::~bitset_arena_t() {
+	for (const block_t& block : blocks)
+		alignedFree(block.head);
+	return;
+}
+
+void* bitset_arena_t::allocate(const size_t bytes) {
+	const size_t rounded = roundUp(std::max<size_t>(bytes, 1));
+	if (rounded > (size_t)(limit - cursor)) {
+		const size_t size = std::max(rounded, blockBytes);
+		block_t block = { static_cast<char*>(alignedAllocate(size)), size };
+		blocks.push_back(block);
+		cursor = block.head;
+		limit = block.head + size;
+	}
+	char* head = cursor;
+	cursor += rounded;
+	usedBytes += rounded;
+	return head;
+}
+
+void bitset_arena_t::deallocate(void* pointer, const size_t bytes) {
+	const size_t rounded = roundUp(std::max<size_t>(bytes, 1));
+	char* head = static_cast<char*>(pointer);
+	usedBytes -= std::min(usedBytes, rounded);
+	// Only the most recent allocation of the current block can be handed out again
+	if (!blocks.empty() && head >= blocks.back().head && head + rounded == cursor) cursor = head;
+}
+
+void bitset_arena_t::release() {
+	if (blocks.empty()) return;
+	const block_t last = blocks.back();
+	for (size_t index = 0; index + 1 < blocks.size(); ++index)
+		alignedFree(blocks[index].head);
+	blocks.assign(1, last);
+	cursor = last.head;
+	limit = last.head + last.bytes;
+	usedBytes = 0;
+}
+
+size_t bitset_arena_t::used() const {
+	return usedBytes;
+}
+
+size_t bitset_arena_t::reserved() const {
+	size_t total = 0;
+	for (const block_t& block : blocks)
+		total += block.bytes;
+	return total;
+}
+
+
+
+//  ########   #######   #######  ##
+//  ##     ## ##     ## ##     ## ##
+//  ##     ## ##     ## ##     ## ##
+//  ########  ##     ## ##     ## ##
+//  ##        ##     ## ##     ## ##
+//  ##        ##     ## ##     ## ##
+//  ##         #######   #######  ########
+
+bitset_pool_t::bitset_pool_t(const size_t blockBytes) : freeLists(), arena(blockBytes), large() {
+	return;
+}
+
+bitset_pool_t::~bitset_pool_t() {
+	for (void* block : large)
+		alignedFree(block);
+	return;
+}
+
+size_t bitset_pool_t::classOf(const size_t bytes) {
+	size_t size = alignment, index = 0;
+	while (size < bytes && index < classCount) {
+		size <<= 1;
+		++index;
+	}
+	return index;
+}
+
+void* bitset_pool_t::allocate(const size_t bytes) {
+	const size_t index = classOf(bytes);
+	if (index == classCount) {
+		void* block = alignedAllocate(bytes);
+		try {
+			large.insert(block);
+		} catch (...) {
+			alignedFree(block);
+			throw;
+		}
+		return block;
+	}
+	if (freeLists[index] != nullptr) {
+		node_t* node = freeLists[index];
+		freeLists[index] = node->next;
+		return node;
+	}
+	return arena.allocate(alignment << index);
+}
+
+void bitset_pool_t::deallocate(void* pointer, const size_t bytes) {
+	if (pointer == nullptr) return;
+	const size_t index = classOf(bytes);
+	if (index == classCount) {
+		large.erase(pointer);
+		alignedFree(pointer);
+		return;
+	}
+	node_t* node = static_cast<node_t*>(pointer);
+	node->next = freeLists[index];
+	freeLists[index] = node;
+}
+
+void bitset_pool_t::release() {
+	std::fill(freeLists, freeLists + classCount, nullptr);
+	for (void* block : large)
+		alignedFree(block);
+	large.clear();
+	arena.release();
+}
@@ -0,0 +1,309 @@
+/**
+ * @file bitset_allocator.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `bitset_memory_t` interface, of the `bitset_arena_t` and `bitset_pool_t` memory resources, and of the `bitset_allocator_t` class
+ */
+
+#ifndef bitlib___bitset_allocator_h
+#define bitlib___bitset_allocator_h
+
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Memory resource the storage of bitsets is allocated from
+ *
+ * @details Every block returned by allocate() is aligned to @ref alignment bytes, a cache line, so that word kernels and the parallel split of bulk operations never straddle a line at the head of a bitset.
+ */
+class bitset_memory_t {
+public:
+	/**
+	 * @brief Alignment of every allocated block, in bytes
+	 */
+	static const size_t alignment = 64;
+
+	virtual ~bitset_memory_t() {
+		return;
+	}
+
+	/**
+	 * @brief Allocates a block of @p bytes bytes aligned to @ref alignment
+	 *
+	 * @throw std::bad_alloc If the memory cannot be allocated.
+	 */
+	virtual void* allocate(const size_t bytes) = 0;
+
+	/**
+	 * @brief Returns the block at @p pointer of @p bytes bytes, previously obtained from allocate() with the same size
+	 */
+	virtual void deallocate(void* pointer, const size_t bytes) = 0;
+};
+
+
+
+//     ###    ########  ######## ##    ##    ###
+//    ## ##   ##     ## ##       ###   ##   ## ##
+//   ##   ##  ##     ## ##       ####  ##  ##   ##
+//  ##     ## ########  ######   ## ## ## ##     ##
+//  ######### ##   ##   ##       ##  #### #########
+//  ##     ## ##    ##  ##       ##   ### ##     ##
+//  ##     ## ##     ## ######## ##    ## ##     ##
+
+/**
+ * @brief Bump-pointer memory resource, releasing all of its blocks at once
+ *
+ * @details Allocation advances a pointer through the current block and takes a new block only when it is exhausted, thus costs a few instructions. Individual blocks are not returned, except the most recent one, so that a vector growing at the end of the arena extends in place; all of the memory is returned at once by release() or by the destructor. An arena suits the temporaries of a single query: allocate them, compute, and release the arena.
+ *
+ * @warning Bitsets allocated from an arena <b>must be destroyed before release()</b>, and must not outlive the arena. An arena is not thread safe; use one arena per thread.
+ *
+ * Example usage:
+ * @code
+ *	bitset_arena_t arena;
+ *	for (const query_t& query : queries) {
+ *		{
+ *			bitset_t matches(arena), scratch(arena);
+ *			evaluateQuery(query, matches, scratch);
+ *			report(matches.count());
+ *		}
+ *		// Release the storage of every bitset of the query at once
+ *		arena.release();
+ *	}
+ * @endcode
+ */
+class bitset_arena_t : public bitset_memory_t {
+private:
+	/**
+	 * @brief Block of memory, aligned to @ref alignment
+	 */
+	struct block_t {
+		char* head;
+		size_t bytes;
+	};
+
+	std::vector<block_t> blocks;
+
+	/**
+	 * @brief Size of the blocks taken for allocations smaller than a block
+	 */
+	size_t blockBytes;
+
+	/**
+	 * @brief Next free byte, and end of the current block
+	 */
+	char* cursor;
+	char* limit;
+
+	/**
+	 * @brief Number of bytes handed out and not returned
+	 */
+	size_t usedBytes;
+public:
+	/**
+	 * @brief Arena constructor
+	 *
+	 * @param [in] blockBytes Size of the blocks the arena takes from the global heap; larger allocations take a block of their own.
+	 */
+	explicit bitset_arena_t(const size_t blockBytes = (size_t)1 << 20);
+
+	bitset_arena_t(const bitset_arena_t&) = delete;
+	bitset_arena_t& operator=(const bitset_arena_t&) = delete;
+
+	/**
+	 * @brief Returns all of the blocks to the global heap
+	 */
+	~bitset_arena_t();
+
+	void* allocate(const size_t bytes) override;
+	void deallocate(void* pointer, const size_t bytes) override;
+
+	/**
+	 * @brief Releases every allocation at once
+	 *
+	 * @details Returns every block but the last one to the global heap and rewinds the last one, so that an arena reused for query after query allocates from the global heap only when a query needs more than the previous ones.
+	 */
+	void release();
+
+	/**
+	 * @brief Returns the number of bytes allocated and not released
+	 */
+	size_t used() const;
+
+	/**
+	 * @brief Returns the number of bytes taken from the global heap
+	 */
+	size_t reserved() const;
+};
+
+
+
+//  ########   #######   #######  ##
+//  ##     ## ##     ## ##     ## ##
+//  ##     ## ##     ## ##     ## ##
+//  ########  ##     ## ##     ## ##
+//  ##        ##     ## ##     ## ##
+//  ##        ##     ## ##     ## ##
+//  ##         #######   #######  ########
+
+/**
+ * @brief Memory resource keeping returned blocks in size classes for reuse
+ *
+ * @details Sizes are rounded up to a power of two multiple of @ref alignment, from one cache line (8 words) to @ref largestClass bytes; a returned block is pushed on the free list of its class and handed out again by the next allocation of the class, both in constant time. Fresh blocks of a class are carved from an internal @ref bitset_arena_t. Larger blocks are taken from and returned to the global heap individually. release() returns everything at once.
+ *
+ * A pool suits workloads which repeatedly create and drop bitsets of a few lengths, such as a long-lived cache, where an arena would only grow.
+ *
+ * @warning Bitsets allocated from a pool <b>must be destroyed before release()</b>, and must not outlive the pool. A pool is not thread safe; use one pool per thread.
+ *
+ * Example usage:
+ * @code
+ *	bitset_pool_t pool;
+ *	std::vector<bitset_t> window;
+ *	for (const event_t& event : events) {
+ *		window.emplace_back(event.mask(), pool);
+ *		// Dropped bitsets return their storage to the pool for the next ones
+ *		if (window.size() > 1000) window.erase(window.begin());
+ *	}
+ * @endcode
+ */
+class bitset_pool_t : public bitset_memory_t {
+public:
+	/**
+	 * @brief Number of size classes
+	 */
+	static const size_t classCount = 14;
+
+	/**
+	 * @brief Size of the largest class, in bytes; larger blocks bypass the pool
+	 */
+	static const size_t largestClass = alignment << (classCount - 1);
+private:
+	/**
+	 * @brief Returned block, linked through its first bytes
+	 */
+	struct node_t {
+		node_t* next;
+	};
+
+	node_t* freeLists[classCount];
+	bitset_arena_t arena;
+
+	/**
+	 * @brief Blocks larger than @ref largestClass, taken from the global heap
+	 */
+	std::unordered_set<void*> large;
+
+	/**
+	 * @brief Returns the size class of @p bytes, or @ref classCount if it is too large for the pool
+	 */
+	static size_t classOf(const size_t bytes);
+public:
+	/**
+	 * @brief Pool constructor
+	 *
+	 * @param [in] blockBytes Size of the blocks the pool carves blocks of its classes from.
+	 */
+	explicit bitset_pool_t(const size_t blockBytes = (size_t)1 << 20);
+
+	bitset_pool_t(const bitset_pool_t&) = delete;
+	bitset_pool_t& operator=(const bitset_pool_t&) = delete;
+
+	/**
+	 * @brief Returns all of the memory to the global heap
+	 */
+	~bitset_pool_t();
+
+	void* allocate(const size_t bytes) override;
+	void deallocate(void* pointer, const size_t bytes) override;
+
+	/**
+	 * @brief Releases every allocation at once, see bitset_arena_t::release()
+	 */
+	void release();
+};
+
+
+
+//     ###    ##       ##        #######   ######     ###    ########  #######  ########
+//    ## ##   ##       ##       ##     ## ##    ##   ## ##      ##    ##     ## ##     ##
+//   ##   ##  ##       ##       ##     ## ##        ##   ##     ##    ##     ## ##     ##
+//  ##     ## ##       ##       ##     ## ##       ##     ##    ##    ##     ## ########
+//  ######### ##       ##       ##     ## ##       #########    ##    ##     ## ##   ##
+//  ##     ## ##       ##       ##     ## ##    ## ##     ##    ##    ##     ## ##    ##
+//  ##     ## ######## ########  #######   ######  ##     ##    ##     #######  ##     ##
+
+/**
+ * @brief Standard allocator allocating from a @ref bitset_memory_t, or from the global heap
+ *
+ * @details The allocator of the storage of `bitset_t` (see bitset_t::allocator_type), and usable with any standard container. A default-constructed allocator uses the global heap. The allocator moves and swaps along with the storage; copies of a container start again on the global heap, so that copying a bitset out of an arena gives a bitset which outlives the arena.
+ *
+ * Example usage:
+ * @code
+ *	bitset_arena_t arena;
+ *	std::vector<size_t, bitset_allocator_t<size_t>> positions(arena);
+ * @endcode
+ */
+template <class T>
+class bitset_allocator_t {
+	template <class U>
+	friend class bitset_allocator_t;
+private:
+	bitset_memory_t* memory;
+public:
+	typedef T value_type;
+	typedef std::true_type propagate_on_container_move_assignment;
+	typedef std::true_type propagate_on_container_swap;
+
+	bitset_allocator_t() noexcept : memory(nullptr) {
+		return;
+	}
+
+	/**
+	 * @brief Allocator constructor
+	 *
+	 * @param [in] memory Resource to allocate from, which must outlive every allocation.
+	 */
+	bitset_allocator_t(bitset_memory_t& memory) noexcept : memory(&memory) {
+		return;
+	}
+
+	template <class U>
+	bitset_allocator_t(const bitset_allocator_t<U>& other) noexcept : memory(other.memory) {
+		return;
+	}
+
+	/**
+	 * @brief Returns the resource allocated from, or `nullptr` for the global heap
+	 */
+	bitset_memory_t* resource() const noexcept {
+		return memory;
+	}
+
+	T* allocate(const size_t count) {
+		if (memory == nullptr) return static_cast<T*>(::operator new(count * sizeof(T)));
+		return static_cast<T*>(memory->allocate(count * sizeof(T)));
+	}
+
+	void deallocate(T* pointer, const size_t count) noexcept {
+		if (memory == nullptr) ::operator delete(pointer);
+		else memory->deallocate(pointer, count * sizeof(T));
+	}
+
+	bitset_allocator_t select_on_container_copy_construction() const noexcept {
+		return bitset_allocator_t();
+	}
+
+	template <class U>
+	bool operator==(const bitset_allocator_t<U>& other) const noexcept {
+		return memory == other.memory;
+	}
+
+	template <class U>
+	bool operator!=(const bitset_allocator_t<U>& other) const noexcept {
+		return memory != other.memory;
+	}
+};
+
+#endif
@@ -0,0 +1,233 @@
+/**
+ * @file bitset_codec.cpp
+ * @implements bitset_codec.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the bitset encoders and decoders
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "bitset_codec.h"
+
+
+
+//  ########  ####  ######   #### ########  ######
+//  ##     ##  ##  ##    ##   ##     ##    ##    ##
+//  ##     ##  ##  ##         ##     ##    ##
+//  ##     ##  ##  ##   ####  ##     ##     ######
+//  ##     ##  ##  ##    ##   ##     ##          ##
+//  ##     ##  ##  ##    ##   ##     ##    ##    ##
+//  ########  ####  ######   ####    ##     ######
+
+// Words encoded at once; a multiple of three, so that blocks hold whole base64 groups
+static const size_t blockWords = 48;
+
+static const char hexDigits[] = "0123456789abcdef";
+static const char base64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const uint64_t zeroDigits = 0x3030303030303030ULL;
+static const uint64_t lowBits = 0x0101010101010101ULL;
+
+// Expands the bits of @p byte into eight '0'/'1' characters, the lowest bit first
+static uint64_t binaryDigits(const uint64_t byte) {
+	// Byte k of spread keeps bit k of the byte, which the addition carries into the lowest bit of byte k
+	const uint64_t spread = (byte * lowBits) & 0x8040201008040201ULL;
+	return (((spread + 0x7F7F7F7F7F7F7F7FULL) >> 7) & lowBits) | zeroDigits;
+}
+
+static void storeDigits(const uint64_t digits, char* out, const size_t count) {
+	for (size_t index = 0; index < count; ++index)
+		out[index] = (char)(digits >> (8 * index));
+}
+
+static uint64_t loadDigits(const char* text) {
+	uint64_t digits = 0;
+	for (size_t index = 0; index < 8; ++index)
+		digits |= (uint64_t)(unsigned char)text[index] << (8 * index);
+	return digits;
+}
+
+static int hexValue(const char digit) {
+	if (digit >= '0' && digit <= '9') return digit - '0';
+	if (digit >= 'a' && digit <= 'f') return digit - 'a' + 10;
+	if (digit >= 'A' && digit <= 'F') return digit - 'A' + 10;
+	return -1;
+}
+
+static int base64Value(const char digit) {
+	if (digit >= 'A' && digit <= 'Z') return digit - 'A';
+	if (digit >= 'a' && digit <= 'z') return digit - 'a' + 26;
+	if (digit >= '0' && digit <= '9') return digit - '0' + 52;
+	if (digit == '+') return 62;
+	if (digit == '/') return 63;
+	return -1;
+}
+
+// Encodes words [first, last) of @p bits, at most blockWords of them starting at a multiple of blockWords; returns the end of the output
+static char* encodeWords(const bitset_view_t& bits, const size_t first, const size_t last, const bitset_format_t format, char* out) {
+	const size_t length = bits.length();
+	if (format == bitset_format_t::base64) {
+		uint8_t bytes[blockWords * 8];
+		const size_t count = std::min((last - first) * 8, (length + 7) / 8 - first * 8);
+		for (size_t word = first; word < last; ++word) {
+			const uint64_t value = bits.paddedWord(word);
+			for (size_t byte = (word - first) * 8; byte < std::min(count, (word - first + 1) * 8); ++byte)
+				bytes[byte] = (uint8_t)(value >> (8 * (byte % 8)));
+		}
+		size_t index = 0;
+		for (; index + 3 <= count; index += 3) {
+			const uint32_t group = ((uint32_t)bytes[index] << 16) | ((uint32_t)bytes[index + 1] << 8) | bytes[index + 2];
+			*out++ = base64Digits[group >> 18];
+			*out++ = base64Digits[(group >> 12) & 63];
+			*out++ = base64Digits[(group >> 6) & 63];
+			*out++ = base64Digits[group & 63];
+		}
+		if (index < count) {
+			const uint32_t group = ((uint32_t)bytes[index] << 16) | ((index + 1 < count) ? (uint32_t)bytes[index + 1] << 8 : 0);
+			*out++ = base64Digits[group >> 18];
+			*out++ = base64Digits[(group >> 12) & 63];
+			*out++ = (index + 1 < count) ? base64Digits[(group >> 6) & 63] : '=';
+			*out++ = '=';
+		}
+		return out;
+	}
+	for (size_t word = first; word < last; ++word) {
+		const uint64_t value = bits.paddedWord(word);
+		const size_t bitCount = std::min((size_t)64, length - word * 64);
+		if (format == bitset_format_t::binary) {
+			for (size_t shift = 0; shift < bitCount; shift += 8) {
+				storeDigits(binaryDigits((value >> shift) & 0xFF), out, std::min((size_t)8, bitCount - shift));
+				out += std::min((size_t)8, bitCount - shift);
+			}
+		} else {
+			for (size_t shift = 0; shift < bitCount; shift += 4)
+				*out++ = hexDigits[(value >> shift) & 15];
+		}
+	}
+	return out;
+}
+
+
+
+//  ######## ##    ##  ######   #######  ########  ########
+//  ##       ###   ## ##    ## ##     ## ##     ## ##
+//  ##       ####  ## ##       ##     ## ##     ## ##
+//  ######   ## ## ## ##       ##     ## ##     ## ######
+//  ##       ##  #### ##       ##     ## ##     ## ##
+//  ##       ##   ### ##    ## ##     ## ##     ## ##
+//  ######## ##    ##  ######   #######  ########  ########
+
+size_t encodedLength(const size_t length, const bitset_format_t format) {
+	switch (format) {
+		case bitset_format_t::hex:
+			return (length + 3) / 4;
+		case bitset_format_t::base64:
+			return ((length + 7) / 8 + 2) / 3 * 4;
+		default:
+			return length;
+	}
+}
+
+std::string encodeBitset(const bitset_view_t& bits, const bitset_format_t format) {
+	std::string text(encodedLength(bits.length(), format), '\0');
+	const size_t words = bits.wordCount();
+	char* out = text.empty() ? nullptr : &text[0];
+	for (size_t first = 0; first < words; first += blockWords)
+		out = encodeWords(bits, first, std::min(words, first + blockWords), format, out);
+	return text;
+}
+
+void writeBitset(std::ostream& os, const bitset_view_t& bits, const bitset_format_t format) {
+	char buffer[blockWords * 64];
+	const size_t words = bits.wordCount();
+	for (size_t first = 0; first < words; first += blockWords) {
+		const char* end = encodeWords(bits, first, std::min(words, first + blockWords), format, buffer);
+		os.write(buffer, end - buffer);
+	}
+}
+
+std::vector<uint8_t> encodeBytes(const bitset_view_t& bits) {
+	std::vector<uint8_t> bytes((bits.length() + 7) / 8);
+	for (size_t index = 0; index < bytes.size(); ++index)
+		bytes[index] = (uint8_t)(bits.paddedWord(index / 8) >> (8 * (index % 8)));
+	return bytes;
+}
+
+
+
+//  ########  ########  ######   #######  ########  ########
+//  ##     ## ##       ##    ## ##     ## ##     ## ##
+//  ##     ## ##       ##       ##     ## ##     ## ##
+//  ##     ## ######   ##       ##     ## ##     ## ######
+//  ##     ## ##       ##       ##     ## ##     ## ##
+//  ##     ## ##       ##    ## ##     ## ##     ## ##
+//  ########  ########  ######   #######  ########  ########
+
+bitset_t decodeBitset(const char* text, const size_t size, const bitset_format_t format, const size_t length) {
+	static const char* invalid = "decodeBitset: invalid character";
+	bitset_t::word_vector_t words;
+	size_t bitCount = 0;
+	if (format == bitset_format_t::binary) {
+		bitCount = size;
+		words.assign((size + 63) / 64, 0);
+		size_t index = 0;
+		for (; index + 8 <= size; index += 8) {
+			const uint64_t digits = loadDigits(text + index) ^ zeroDigits;
+			if ((digits & ~lowBits) != 0) throw std::invalid_argument(invalid);
+			// Gathers the lowest bit of every byte into the highest byte
+			words[index / 64] |= ((digits * 0x0102040810204080ULL) >> 56) << (index % 64);
+		}
+		for (; index < size; ++index) {
+			if (text[index] != '0' && text[index] != '1') throw std::invalid_argument(invalid);
+			if (text[index] == '1') words[index / 64] |= (uint64_t)1 << (index % 64);
+		}
+	} else if (format == bitset_format_t::hex) {
+		bitCount = size * 4;
+		words.assign((bitCount + 63) / 64, 0);
+		for (size_t index = 0; index < size; ++index) {
+			const int value = hexValue(text[index]);
+			if (value < 0) throw std::invalid_argument(invalid);
+			words[index / 16] |= (uint64_t)value << (4 * (index % 16));
+		}
+	} else {
+		size_t digits = size;
+		for (size_t padding = 0; padding < 2 && digits > 0 && text[digits - 1] == '='; ++padding)
+			--digits;
+		if (digits % 4 == 1) throw std::invalid_argument("decodeBitset: truncated base64");
+		const size_t byteCount = digits / 4 * 3 + ((digits % 4 != 0) ? digits % 4 - 1 : 0);
+		bitCount = byteCount * 8;
+		words.assign((bitCount + 63) / 64, 0);
+		uint32_t group = 0;
+		size_t byte = 0;
+		for (size_t index = 0; index < digits; ++index) {
+			const int value = base64Value(text[index]);
+			if (value < 0) throw std::invalid_argument(invalid);
+			group = (group << 6) | (uint32_t)value;
+			// Every digit completes a byte except the first of each group of four
+			if (index % 4 != 0) {
+				const uint64_t decoded = (group >> (2 * (3 - index % 4))) & 0xFF;
+				words[byte / 8] |= decoded << (8 * (byte % 8));
+				++byte;
+			}
+		}
+	}
+	const size_t result = (length == bitset_t::npos) ? bitCount : length;
+	const size_t granule = (format == bitset_format_t::binary) ? 1 : (format == bitset_format_t::hex) ? 4 : 8;
+	if (result > bitCount || result + granule <= bitCount)
+		throw std::invalid_argument("decodeBitset: length does not match the encoded bits");
+	words.resize((result + 63) / 64);
+	return bitset_t(std::move(words), result);
+}
+
+bitset_t decodeBitset(const std::string& text, const bitset_format_t format, const size_t length) {
+	return decodeBitset(text.data(), text.size(), format, length);
+}
+
+bitset_t decodeBytes(const uint8_t* bytes, const size_t length) {
+	bitset_t::word_vector_t words((length + 63) / 64, 0);
+	const size_t count = (length + 7) / 8;
+	for (size_t index = 0; index < count; ++index)
+		words[index / 8] |= (uint64_t)bytes[index] << (8 * (index % 8));
+	return bitset_t(std::move(words), length);
+}
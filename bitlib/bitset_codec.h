@@ -0,0 +1,125 @@
+/**
+ * @file bitset_codec.h
+ * @date October 16, 2026
+ * @brief Contains text and raw byte encoders and decoders of bitsets
+ */
+
+#ifndef bitlib___bitset_codec_h
+#define bitlib___bitset_codec_h
+
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_view.h"
+
+/**
+ * @brief Text representations of bitsets
+ *
+ * @details All representations list the bits from the bit `0` up:
+ *	| Format | Characters per bit | Contents                                                                     |
+ *	|:-------|:------------------:|:-----------------------------------------------------------------------------|
+ *	|binary  |1                   |`'0'` or `'1'` per bit, as bitset_t::toBinaryString()                         |
+ *	|hex     |1/4                 |a hexadecimal digit per four bits, bit @c 4i being the lowest bit of digit @c i |
+ *	|base64  |1/6                 |RFC 4648 base64, with padding, of the raw bytes returned by encodeBytes()     |
+ */
+enum class bitset_format_t {
+	binary,
+	hex,
+	base64
+};
+
+/**
+ * @brief Returns the number of characters of @p length bits encoded in @p format
+ */
+size_t encodedLength(const size_t length, const bitset_format_t format);
+
+/**
+ * @brief Encodes @p bits into a string
+ *
+ * @details The string is allocated once at its final size, and filled a word of the bitset at a time: every byte of the word is expanded into eight binary digits, or two hex digits, with a few register operations, without branches per bit.
+ *
+ * @param [in] bits Bitset or view to encode.
+ * @param [in] format Representation to encode into.
+ *
+ * @return Encoded bits.
+ *
+ * Example usage:
+ * @code
+ *	bitset_t someBitset({1, 0, 0, 0, 1, 1, 1, 1});
+ *	std::string hex = encodeBitset(someBitset, bitset_format_t::hex);	// "1f"
+ * @endcode
+ */
+std::string encodeBitset(const bitset_view_t& bits, const bitset_format_t format = bitset_format_t::binary);
+
+/**
+ * @brief Writes @p bits encoded in @p format into @p os
+ *
+ * @details Encodes the bitset a block at a time into a small buffer on the stack, so that no string of the whole representation is ever built.
+ *
+ * @param [in,out] os Stream to write into.
+ * @param [in] bits Bitset or view to encode.
+ * @param [in] format Representation to encode into.
+ *
+ * Example usage:
+ * @code
+ *	// Dump a mask of billions of bits for replication
+ *	std::ofstream dump("mask.b64");
+ *	writeBitset(dump, mask, bitset_format_t::base64);
+ * @endcode
+ */
+void writeBitset(std::ostream& os, const bitset_view_t& bits, const bitset_format_t format = bitset_format_t::binary);
+
+/**
+ * @brief Decodes a bitset from @p size characters at @p text
+ *
+ * @details Binary digits are validated and packed eight at a time; hex digits may be of either case, base64 padding is optional.
+ *
+ * @param [in] text Encoded bits.
+ * @param [in] size Number of characters.
+ * @param [in] format Representation to decode.
+ * @param [in] length Length of the bitset; by default all the encoded bits, i.e. four per hex digit and eight per base64 byte. Bits of the last digit or byte past @p length are ignored.
+ *
+ * @return Decoded bitset.
+ *
+ * @throw std::invalid_argument If @p text contains a character not valid in @p format, or @p length does not fit the number of encoded bits.
+ *
+ * Example usage:
+ * @code
+ *	// Reload a 5-bit mask from its hex representation
+ *	bitset_t mask = decodeBitset("1f", 2, bitset_format_t::hex, 5);
+ * @endcode
+ */
+bitset_t decodeBitset(const char* text, const size_t size, const bitset_format_t format = bitset_format_t::binary, const size_t length = bitset_t::npos);
+
+/**
+ * @brief Decodes a bitset from @p text, see decodeBitset(const char*, const size_t, const bitset_format_t, const size_t)
+ */
+bitset_t decodeBitset(const std::string& text, const bitset_format_t format = bitset_format_t::binary, const size_t length = bitset_t::npos);
+
+/**
+ * @brief Returns the raw bytes of @p bits
+ *
+ * @details Byte @c j holds bits @c 8j to @c 8j + 7, bit @c 8j being the least significant; the unused bits of the last byte are reset. This is the most compact form, with no dependency on the byte order of the host.
+ *
+ * Example usage:
+ * @code
+ *	std::vector<uint8_t> packet = encodeBytes(someBitset);
+ *	send(socket, packet.data(), packet.size(), 0);
+ * @endcode
+ */
+std::vector<uint8_t> encodeBytes(const bitset_view_t& bits);
+
+/**
+ * @brief Decodes a bitset of @p length bits from the raw bytes at @p bytes, see encodeBytes()
+ *
+ * @param [in] bytes Pointer to (@p length + 7) / 8 bytes.
+ * @param [in] length Length of the bitset.
+ *
+ * @return Decoded bitset.
+ */
+bitset_t decodeBytes(const uint8_t* bytes, const size_t length);
+
+#endif
@@ -0,0 +1,659 @@
+/**
+ * @file bitset_expression.h
+ * @date October 16, 2026
+ * @brief Contains definition of the lazy `bitset_t` expression templates
+ */
+
+#ifndef bitlib___bitset_expression_h
+#define bitlib___bitset_expression_h
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_kernels.h"
+#include "bitset_parallel.h"
+
+/**
+ * @brief Base class of the lazy bitset expressions
+ *
+ * @details Operators `^`, `&`, `|`, `~` and `!` applied to bitsets do not calculate anything: they return a small expression object, which refers to the operand bitsets and records the operations. The expression is evaluated when it is assigned to a `bitset_t` (or used to construct one), or when count() or any() is invoked on it or it is compared; at that point every word of the result is calculated at once, reading the corresponding word of each operand and applying all the operations in registers. Thus an expression of @c n operators makes no temporary bitsets, reads each operand once, and writes the result once, instead of making @c n temporaries.
+ *
+ * Every expression type @c E derived from `bitset_expression_t<E>` provides:
+ *	| Method           | Returns                                                                 |
+ *	|:-----------------|:------------------------------------------------------------------------|
+ *	|length()          |length of the result, the length of the leftmost operand                 |
+ *	|wordCount()       |number of words of the result                                            |
+ *	|commonWords()     |number of words every operand has                                        |
+ *	|word(i)           |word @c i of the result, for @c i below commonWords()                    |
+ *	|paddedWord(i)     |word @c i of the result, for @c i below wordCount()                      |
+ *	|wordLocal         |static constant, `true` if word @c i reads only word @c i of every operand |
+ * Expressions with wordLocal set are evaluated by several threads at once (see parallelForWords()), even into one of their operands. commonWords() counts only full words, so that the last word of the result and the words of an operand shorter than the leftmost one are evaluated with paddedWord(): it takes the missing bits of the right operand as reset, so that `^` and `|` keep the bits of the left operand past its end and `&` resets them, and keeps the bits past length() reset, so that inverted operands of any length do not leak into the result.
+ *
+ * Expressions also offer the read-only interface of `bitset_t` the operators returned before they became lazy: size(), at(), operator[](), operator*(), toBinaryString(), and comparison with `==` and `!=`. Expressions cannot be modified: assign them to a `bitset_t`, or call eval(), before calling shiftLeft(), invert(), resize() or the other modifying members of `bitset_t`.
+ *
+ * @warning Expressions refer to their operand bitsets: <b>do not store an expression</b> (e.g. in an `auto` variable) beyond the lifetime of its operands, and do not resize an operand before evaluating it. Write `auto x = (a ^ b).eval();` or `bitset_t x = a ^ b;` to keep the value.
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitsets
+ *	bitset_t a({0, 1, 1, 0}), b({1, 1, 0, 0}), c({0, 0, 1, 1}), d({1, 0, 0, 0});
+ *
+ *	// A single pass over a, b, c and d, without temporaries
+ *	bitset_t filter = ((a ^ b) & ~c) | d;
+ *
+ *	// Count matches without storing them
+ *	size_t matches = (a & b & ~c).count();
+ * @endcode
+ */
+template <class Expression>
+class bitset_expression_t {
+public:
+	/**
+	 * @brief Returns the expression as its actual type
+	 */
+	const Expression& self() const {
+		return static_cast<const Expression&>(*this);
+	}
+
+	/**
+	 * @brief Returns the number of set bits of the value of the expression
+	 *
+	 * @details Evaluates the expression into a small block on the stack, and counts the block with the popcount kernel selected by bitsetKernels(); the result is never stored.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Count rows matching the filter
+	 *	size_t rows = (visible & ~deleted).count();
+	 * @endcode
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Tests whether any bit of the value of the expression is set
+	 *
+	 * @details Stops at the first non-zero word.
+	 */
+	bool any() const;
+
+	/**
+	 * @brief Returns length of the value of the expression, see bitset_t::size()
+	 */
+	size_t size() const {
+		return self().length();
+	}
+
+	/**
+	 * @brief Returns the bit of the value of the expression at @p index, without bounds checking
+	 *
+	 * @details Evaluates only the word of the bit.
+	 */
+	bit_t operator[](const size_t index) const;
+
+	/**
+	 * @brief Returns the bit of the value of the expression at @p index
+	 *
+	 * @details Evaluates only the word of the bit.
+	 *
+	 * @throw std::out_of_range If @p index is not less than the length of the expression.
+	 */
+	bit_t at(const size_t index) const;
+
+	/**
+	 * @brief Scalar product of the value of the expression with @p other, see bitset_t::operator*()
+	 *
+	 * @details Evaluates the words of the expression one at a time; the result is never stored.
+	 */
+	bit_t operator*(const bitset_t& other) const;
+
+	/**
+	 * @brief Returns string with the binary representation of the value of the expression, see bitset_t::toBinaryString()
+	 *
+	 * @details Evaluates the expression into a temporary bitset.
+	 */
+	std::string toBinaryString() const;
+
+	/**
+	 * @brief Returns string with the binary representation of the value of the expression, with @p delimiter between the bits
+	 *
+	 * @details Evaluates the expression into a temporary bitset.
+	 */
+	std::string toBinaryString(const std::string delimiter) const;
+
+	/**
+	 * @brief Returns the value of the expression as a `bitset_t`
+	 *
+	 * @details Evaluates the expression into a new bitset, which no longer refers to the operands: call it to keep the value in an `auto` variable, or to call the members of `bitset_t` which expressions do not offer.
+	 *
+	 * Example usage:
+	 * @code
+	 *	auto changed = (before ^ after).eval();
+	 *	const size_t first = changed.findFirst();
+	 * @endcode
+	 */
+	bitset_t eval() const;
+};
+
+
+
+//   #######  ########  ######## ########     ###    ##    ## ########   ######
+//  ##     ## ##     ## ##       ##     ##   ## ##   ###   ## ##     ## ##    ##
+//  ##     ## ##     ## ##       ##     ##  ##   ##  ####  ## ##     ## ##
+//  ##     ## ########  ######   ########  ##     ## ## ## ## ##     ##  ######
+//  ##     ## ##        ##       ##   ##   ######### ##  #### ##     ##       ##
+//  ##     ## ##        ##       ##    ##  ##     ## ##   ### ##     ## ##    ##
+//   #######  ##        ######## ##     ## ##     ## ##    ## ########   ######
+
+/**
+ * @brief Returns the mask of the bits of word @p index within the first @p length bits
+ */
+inline uint64_t bitsetTailMask(const size_t length, const size_t index) {
+	return (index < length / 64) ? ~(uint64_t)0 : ~(uint64_t)0 >> (64 - length % 64);
+}
+
+/**
+ * @brief Leaf of an expression, refers to the storage of a `bitset_t`
+ */
+class bitset_operand_t : public bitset_expression_t<bitset_operand_t> {
+private:
+	const uint64_t* head;
+	size_t words;
+	size_t bitLength;
+public:
+	static const bool wordLocal = true;
+
+	explicit bitset_operand_t(const bitset_t& bits) : head(bits.data()), words(bits.wordCount()), bitLength(bits.length()) {
+		return;
+	}
+
+	size_t length() const {
+		return bitLength;
+	}
+
+	size_t wordCount() const {
+		return words;
+	}
+
+	size_t commonWords() const {
+		return words;
+	}
+
+	uint64_t word(const size_t index) const {
+		return head[index];
+	}
+
+	uint64_t paddedWord(const size_t index) const {
+		return head[index];
+	}
+};
+
+/**
+ * @brief Inversion of an expression
+ */
+template <class Operand>
+class bitset_not_t : public bitset_expression_t<bitset_not_t<Operand> > {
+private:
+	Operand operand;
+public:
+	static const bool wordLocal = Operand::wordLocal;
+
+	explicit bitset_not_t(const Operand& operand) : operand(operand) {
+		return;
+	}
+
+	size_t length() const {
+		return operand.length();
+	}
+
+	size_t wordCount() const {
+		return operand.wordCount();
+	}
+
+	size_t commonWords() const {
+		return std::min(operand.commonWords(), length() / 64);
+	}
+
+	uint64_t word(const size_t index) const {
+		return ~operand.word(index);
+	}
+
+	uint64_t paddedWord(const size_t index) const {
+		return ~operand.paddedWord(index) & bitsetTailMask(length(), index);
+	}
+};
+
+/**
+ * @brief Bitwise @p Operation of two expressions
+ */
+template <class Left, class Right, class Operation>
+class bitset_binary_t : public bitset_expression_t<bitset_binary_t<Left, Right, Operation> > {
+private:
+	Left left;
+	Right right;
+public:
+	static const bool wordLocal = Left::wordLocal && Right::wordLocal;
+
+	bitset_binary_t(const Left& left, const Right& right) : left(left), right(right) {
+		return;
+	}
+
+	size_t length() const {
+		return left.length();
+	}
+
+	size_t wordCount() const {
+		return left.wordCount();
+	}
+
+	size_t commonWords() const {
+		return std::min(std::min(left.commonWords(), right.commonWords()), length() / 64);
+	}
+
+	uint64_t word(const size_t index) const {
+		return Operation::apply(left.word(index), right.word(index));
+	}
+
+	uint64_t paddedWord(const size_t index) const {
+		// Bits past the end of the right operand are taken as reset
+		const uint64_t value = Operation::apply(left.paddedWord(index), (index < right.wordCount()) ? right.paddedWord(index) : 0);
+		return value & bitsetTailMask(length(), index);
+	}
+};
+
+/**
+ * @brief Word operations of the binary expressions
+ */
+struct bitset_xor_t {
+	static uint64_t apply(const uint64_t left, const uint64_t right) {
+		return left ^ right;
+	}
+};
+
+struct bitset_and_t {
+	static uint64_t apply(const uint64_t left, const uint64_t right) {
+		return left & right;
+	}
+};
+
+struct bitset_or_t {
+	static uint64_t apply(const uint64_t left, const uint64_t right) {
+		return left | right;
+	}
+};
+
+/**
+ * @brief Maps an operator argument to the type stored in the expression: bitsets are referred to by a @ref bitset_operand_t, expressions are stored by value
+ *
+ * @details Has no `type` for other arguments, so that the operators do not participate in overload resolution for them.
+ */
+template <class Type, class Enable = void>
+struct bitset_operand_of {
+};
+
+template <>
+struct bitset_operand_of<bitset_t> {
+	typedef bitset_operand_t type;
+
+	static type wrap(const bitset_t& bits) {
+		return bitset_operand_t(bits);
+	}
+};
+
+template <class Type>
+struct bitset_operand_of<Type, typename std::enable_if<std::is_base_of<bitset_expression_t<Type>, Type>::value>::type> {
+	typedef Type type;
+
+	static const type& wrap(const Type& expression) {
+		return expression;
+	}
+};
+
+
+
+//  ##     ## ##    ##    ###    ########  ##    ##
+//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ## ####  ##  ##   ##  ##     ##   ####
+//  ##     ## ## ## ## ##     ## ########     ##
+//  ##     ## ##  #### ######### ##   ##      ##
+//  ##     ## ##   ### ##     ## ##    ##     ##
+//   #######  ##    ## ##     ## ##     ##    ##
+
+/**
+ * @brief Calculates inverted bitset value
+ *
+ * @details Does not modify @p operand.
+ *
+ * @param [in] operand `bitset_t` or an expression.
+ *
+ * @return Lazy expression of the inverted value, evaluated when assigned to a `bitset_t` or on count()/any().
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitset
+ *	bitset_t someBitset({0,0,1,0});
+ *
+ *	// Assign inverted bitset to the other bitset
+ *	bitset_t someOtherBitset = !someBitset;
+ * @endcode
+ *
+ * @see operator~(const Operand&)
+ */
+template <class Operand>
+bitset_not_t<typename bitset_operand_of<Operand>::type> operator!(const Operand& operand) {
+	return bitset_not_t<typename bitset_operand_of<Operand>::type>(bitset_operand_of<Operand>::wrap(operand));
+}
+
+/**
+ * @brief Calculates inverted bitset value
+ *
+ * @details Does not modify @p operand.
+ *
+ * @param [in] operand `bitset_t` or an expression.
+ *
+ * @return Lazy expression of the inverted value, evaluated when assigned to a `bitset_t` or on count()/any().
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitset
+ *	bitset_t someBitset({0,0,1,0});
+ *
+ *	// Assign inverted bitset to the other bitset
+ *	bitset_t someOtherBitset = ~someBitset;
+ * @endcode
+ *
+ * @see operator!(const Operand&)
+ */
+template <class Operand>
+bitset_not_t<typename bitset_operand_of<Operand>::type> operator~(const Operand& operand) {
+	return bitset_not_t<typename bitset_operand_of<Operand>::type>(bitset_operand_of<Operand>::wrap(operand));
+}
+
+
+
+//  ########  #### ##    ##    ###    ########  ##    ##
+//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
+//  ########   ##  ## ## ## ##     ## ########     ##
+//  ##     ##  ##  ##  #### ######### ##   ##      ##
+//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
+//  ########  #### ##    ## ##     ## ##     ##    ##
+
+/**
+ * @brief Exclusive OR operator
+ *
+ * @details Overloaded bitwise exclusive OR (XOR, \f$ \oplus \f$) operator, considered equal to addition modulo 2, has the following truth table:
+ *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1\oplus x_2\f$ |
+ *	|:---------:|:---------:|:---------------------:|
+ *	|0          |0          |0                      |
+ *	|0          |1          |1                      |
+ *	|1          |0          |1                      |
+ *	|1          |1          |0                      |
+ *	XOR can be expressed in terms of NOT (\f$\neg\f$), OR (\f$\vee\f$) and AND (\f$\wedge\f$) as follows: \f$ f = x_1 \oplus x_2 = (x_1 \vee x_2) \wedge \neg(x_1 \wedge x_2) \f$. Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \oplus X_2 \iff \forall i : Y^i = X_1^i \oplus X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
+ *
+ * @param [in] left First operand \f$X_1\f$, a `bitset_t` or an expression.
+ * @param [in] right Second operand \f$X_2\f$, a `bitset_t` or an expression.
+ *
+ * @return Lazy expression of \f$ Y = f(X_1, X_2) \f$, evaluated when assigned to a `bitset_t` or on count()/any().
+ *
+ * @warning If \f$X_1\f$ (@p left) and \f$X_2\f$ (@p right) differ in length, the result takes the length of \f$X_1\f$: bits of \f$X_1\f$ past the end of \f$X_2\f$ are kept, and bits of \f$X_2\f$ past the end of \f$X_1\f$ are ignored.
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitset_t values
+ *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
+ *
+ *	// Calculate Y = xor(X1, X2)
+ *	Y = X1 ^ X2;
+ * @endcode
+ */
+template <class Left, class Right>
+bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_xor_t> operator^(const Left& left, const Right& right) {
+	return bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_xor_t>(bitset_operand_of<Left>::wrap(left), bitset_operand_of<Right>::wrap(right));
+}
+
+/**
+ * @brief Conjunction operator
+ *
+ * @details Overloaded bitwise conjuction (AND, \f$\&\f$, \f$\wedge\f$) operator, only returns `true` when both operands are `true`, and `false` otherwise; has the following truth table:
+ *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1\wedge x_2\f$ |
+ *	|:---------:|:---------:|:---------------------:|
+ *	|0          |0          |0                      |
+ *	|0          |1          |0                      |
+ *	|1          |0          |0                      |
+ *	|1          |1          |1                      |
+ *	Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \wedge X_2 \iff \forall i : Y^i = X_1^i \wedge X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
+ *
+ * @param [in] left First operand \f$X_1\f$, a `bitset_t` or an expression.
+ * @param [in] right Second operand \f$X_2\f$, a `bitset_t` or an expression.
+ *
+ * @return Lazy expression of \f$ Y = f(X_1, X_2) \f$, evaluated when assigned to a `bitset_t` or on count()/any().
+ *
+ * @warning If \f$X_1\f$ (@p left) and \f$X_2\f$ (@p right) differ in length, the result takes the length of \f$X_1\f$: bits of \f$X_1\f$ past the end of \f$X_2\f$ are reset, as if \f$X_2\f$ were padded with zeros, and bits of \f$X_2\f$ past the end of \f$X_1\f$ are ignored.
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitset_t values
+ *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
+ *
+ *	// Calculate Y = X1 & X2
+ *	Y = X1 & X2;
+ * @endcode
+ */
+template <class Left, class Right>
+bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_and_t> operator&(const Left& left, const Right& right) {
+	return bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_and_t>(bitset_operand_of<Left>::wrap(left), bitset_operand_of<Right>::wrap(right));
+}
+
+/**
+ * @brief Disjunction operator
+ *
+ * @details Overloaded bitwise disjuction (OR, \f$\vert\f$, \f$\vee\f$) operator, only returns `false` when both operands are `false`, and `true` otherwise; has the following truth table:
+ *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1 \vee x_2\f$  |
+ *	|:---------:|:---------:|:---------------------:|
+ *	|0          |0          |0                      |
+ *	|0          |1          |1                      |
+ *	|1          |0          |1                      |
+ *	|1          |1          |1                      |
+ *	Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \vee X_2 \iff \forall i : Y^i = X_1^i \vee X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
+ *
+ * @param [in] left First operand \f$X_1\f$, a `bitset_t` or an expression.
+ * @param [in] right Second operand \f$X_2\f$, a `bitset_t` or an expression.
+ *
+ * @return Lazy expression of \f$ Y = f(X_1, X_2) \f$, evaluated when assigned to a `bitset_t` or on count()/any().
+ *
+ * @warning If \f$X_1\f$ (@p left) and \f$X_2\f$ (@p right) differ in length, the result takes the length of \f$X_1\f$: bits of \f$X_1\f$ past the end of \f$X_2\f$ are kept, and bits of \f$X_2\f$ past the end of \f$X_1\f$ are ignored.
+ *
+ * Example usage:
+ * @code
+ *	// Initialise bitset_t values
+ *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
+ *
+ *	// Calculate Y = X1 | X2
+ *	Y = X1 | X2;
+ * @endcode
+ */
+template <class Left, class Right>
+bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_or_t> operator|(const Left& left, const Right& right) {
+	return bitset_binary_t<typename bitset_operand_of<Left>::type, typename bitset_operand_of<Right>::type, bitset_or_t>(bitset_operand_of<Left>::wrap(left), bitset_operand_of<Right>::wrap(right));
+}
+
+
+
+//   ######   #######  ##     ## ########     ###    ########  ####  ######   #######  ##    ##
+//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ##  ##  ##    ## ##     ## ###   ##
+//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ##  ##  ##       ##     ## ####  ##
+//  ##       ##     ## ## ### ## ########  ##     ## ########   ##   ######  ##     ## ## ## ##
+//  ##       ##     ## ##     ## ##        ######### ##   ##    ##        ## ##     ## ##  ####
+//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##   ##  ##    ## ##     ## ##   ###
+//   ######   #######  ##     ## ##        ##     ## ##     ## ####  ######   #######  ##    ##
+
+/**
+ * @brief Equal to operator of expressions and bitsets
+ *
+ * @details Compares the values word by word without storing them, and stops at the first differing word; the values are equal when they have the same length and the same bits set. Overloads bitset_t::operator==() for the expressions, so that `(a ^ b) == c` compares as it did when the operators returned `bitset_t`.
+ *
+ * @param [in] left `bitset_t` or an expression.
+ * @param [in] right `bitset_t` or an expression; at least one of the operands is an expression.
+ *
+ * Example usage:
+ * @code
+ *	// Check that the two filters select the same rows
+ *	if ((visible & ~deleted) == selected) reuseCache();
+ * @endcode
+ */
+template <class Left, class Right, class LeftOperand = typename bitset_operand_of<Left>::type, class RightOperand = typename bitset_operand_of<Right>::type>
+typename std::enable_if<!(std::is_same<Left, bitset_t>::value && std::is_same<Right, bitset_t>::value), bool>::type operator==(const Left& left, const Right& right) {
+	const LeftOperand& leftValue = bitset_operand_of<Left>::wrap(left);
+	const RightOperand& rightValue = bitset_operand_of<Right>::wrap(right);
+	if (leftValue.length() != rightValue.length()) return false;
+	for (size_t index = 0; index < leftValue.wordCount(); ++index)
+		if (leftValue.paddedWord(index) != rightValue.paddedWord(index)) return false;
+	return true;
+}
+
+/**
+ * @brief Not equal to operator of expressions and bitsets, see the equal to operator
+ */
+template <class Left, class Right, class LeftOperand = typename bitset_operand_of<Left>::type, class RightOperand = typename bitset_operand_of<Right>::type>
+typename std::enable_if<!(std::is_same<Left, bitset_t>::value && std::is_same<Right, bitset_t>::value), bool>::type operator!=(const Left& left, const Right& right) {
+	return !(left == right);
+}
+
+
+
+//  ######## ##     ##    ###    ##       ##     ##    ###    ######## ####  #######  ##    ##
+//  ##       ##     ##   ## ##   ##       ##     ##   ## ##      ##     ##  ##     ## ###   ##
+//  ##       ##     ##  ##   ##  ##       ##     ##  ##   ##     ##     ##  ##     ## ####  ##
+//  ######   ##     ## ##     ## ##       ##     ## ##     ##    ##     ##  ##     ## ## ## ##
+//  ##        ##   ##  ######### ##       ##     ## #########    ##     ##  ##     ## ##  ####
+//  ##         ## ##   ##     ## ##       ##     ## ##     ##    ##     ##  ##     ## ##   ###
+//  ########    ###    ##     ## ########  #######  ##     ##    ##    ####  #######  ##    ##
+
+// Words evaluated at once by count() and any(), small enough to stay on the stack
+static const size_t bitsetExpressionBlock = 256;
+
+template <class Expression>
+size_t bitset_expression_t<Expression>::count() const {
+	const Expression& expression = self();
+	const size_t words = expression.wordCount(), common = std::min(words, expression.commonWords());
+	return parallelForWords(nullptr, words, [&](const size_t begin, const size_t end) {
+		uint64_t block[bitsetExpressionBlock];
+		size_t total = 0;
+		for (size_t first = begin; first < end; first += bitsetExpressionBlock) {
+			const size_t last = std::min(end, first + bitsetExpressionBlock), fast = std::max(first, std::min(last, common));
+			for (size_t index = first; index < fast; ++index)
+				block[index - first] = expression.word(index);
+			for (size_t index = fast; index < last; ++index)
+				block[index - first] = expression.paddedWord(index);
+			total += bitsetKernels().popcountWords(block, last - first);
+		}
+		return total;
+	});
+}
+
+template <class Expression>
+bool bitset_expression_t<Expression>::any() const {
+	const Expression& expression = self();
+	const size_t words = expression.wordCount(), common = std::min(words, expression.commonWords());
+	for (size_t index = 0; index < common; ++index)
+		if (expression.word(index) != 0) return true;
+	for (size_t index = common; index < words; ++index)
+		if (expression.paddedWord(index) != 0) return true;
+	return false;
+}
+
+template <class Expression>
+bit_t bitset_expression_t<Expression>::operator[](const size_t index) const {
+	return bit_t(((self().paddedWord(index / 64) >> (index % 64)) & 1) != 0);
+}
+
+template <class Expression>
+bit_t bitset_expression_t<Expression>::at(const size_t index) const {
+	if (index >= self().length())
+		throw std::out_of_range("bitset_expression_t::at: index is out of range");
+	return (*this)[index];
+}
+
+template <class Expression>
+bit_t bitset_expression_t<Expression>::operator*(const bitset_t& other) const {
+	const Expression& expression = self();
+	const size_t words = std::min(expression.wordCount(), other.wordCount());
+	// Bits past the length of the shorter operand are zero in its words, thus contribute nothing
+	uint64_t parity = 0;
+	for (size_t index = 0; index < words; ++index)
+		parity ^= expression.paddedWord(index) & other.data()[index];
+	return bit_t((popcountWord(parity) & 1) != 0);
+}
+
+template <class Expression>
+std::string bitset_expression_t<Expression>::toBinaryString() const {
+	return bitset_t(*this).toBinaryString();
+}
+
+template <class Expression>
+std::string bitset_expression_t<Expression>::toBinaryString(const std::string delimiter) const {
+	return bitset_t(*this).toBinaryString(delimiter);
+}
+
+template <class Expression>
+bitset_t bitset_expression_t<Expression>::eval() const {
+	return bitset_t(*this);
+}
+
+template <class Expression>
+void bitset_t::evaluate(const Expression& expression) {
+	const size_t count = expression.wordCount(), common = std::min(count, expression.commonWords());
+	// Growing beyond the capacity would move the storage an operand may refer to
+	storage_t fresh(words.allocator());
+	if (count > words.capacity()) fresh.resize(count);
+	else words.resize(count);
+	word_t* target = fresh.empty() ? words.data() : fresh.data();
+	const auto fill = [&](const size_t first, const size_t last) {
+		for (size_t index = first; index < std::min(last, common); ++index)
+			target[index] = expression.word(index);
+		for (size_t index = std::max(first, common); index < last; ++index)
+			target[index] = expression.paddedWord(index);
+		return (size_t)0;
+	};
+	// Words of other expressions (views of this bitset) may be read after another thread has overwritten them
+	if (Expression::wordLocal) parallelForWords(target, count, fill);
+	else fill(0, count);
+	if (!fresh.empty()) words.swap(fresh);
+	bitLength = expression.length();
+}
+
+template <class Expression>
+bitset_t::bitset_t(const bitset_expression_t<Expression>& expression) : words(), bitLength(0) {
+	evaluate(expression.self());
+	return;
+}
+
+template <class Expression>
+bitset_t& bitset_t::operator=(const bitset_expression_t<Expression>& expression) {
+	evaluate(expression.self());
+	return *this;
+}
+
+template <class Expression>
+bitset_t& bitset_t::operator^=(const bitset_expression_t<Expression>& expression) {
+	evaluate(bitset_binary_t<bitset_operand_t, Expression, bitset_xor_t>(bitset_operand_t(*this), expression.self()));
+	return *this;
+}
+
+template <class Expression>
+bitset_t& bitset_t::operator&=(const bitset_expression_t<Expression>& expression) {
+	evaluate(bitset_binary_t<bitset_operand_t, Expression, bitset_and_t>(bitset_operand_t(*this), expression.self()));
+	return *this;
+}
+
+template <class Expression>
+bitset_t& bitset_t::operator|=(const bitset_expression_t<Expression>& expression) {
+	evaluate(bitset_binary_t<bitset_operand_t, Expression, bitset_or_t>(bitset_operand_t(*this), expression.self()));
+	return *this;
+}
+
+#endif
@@ -0,0 +1,784 @@
+/**
+ * @file bitset_kernels.cpp
+ * @implements bitset_kernels.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the bulk word kernels and of their runtime dispatch
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "bitset_kernels.h"
+#include "bit_c11_operators.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BITLIB_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define BITLIB_TARGET(isa)
+#else
+#define BITLIB_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+
+
+//   ######   ######     ###    ##          ###    ########
+//  ##    ## ##    ##   ## ##   ##         ## ##   ##     ##
+//  ##       ##        ##   ##  ##        ##   ##  ##     ##
+//   ######  ##       ##     ## ##       ##     ## ########
+//        ## ##       ######### ##       ######### ##   ##
+//  ##    ## ##    ## ##     ## ##       ##     ## ##    ##
+//   ######   ######  ##     ## ######## ##     ## ##     ##
+
+template <class BinaryOperation>
+static void scalarTransformWords(uint64_t* target, const uint64_t* source, const size_t count) {
+	BinaryOperation operation;
+	for (size_t index = 0; index < count; ++index)
+		target[index] = operation(target[index], source[index]);
+}
+
+static void scalarInvertWords(uint64_t* target, const size_t count) {
+	for (size_t index = 0; index < count; ++index)
+		target[index] = ~target[index];
+}
+
+static void scalarFillWords(uint64_t* target, const size_t count, const uint64_t value) {
+	for (size_t index = 0; index < count; ++index)
+		target[index] = value;
+}
+
+// Funnel shifts of neighbouring words, compiled to SHRD/SHLD; shift is never 0 so that 64 - shift is a valid count
+
+static void scalarFunnelDownWords(uint64_t* target, const uint64_t* source, const size_t count, const unsigned shift) {
+	for (size_t index = 0; index < count; ++index)
+		target[index] = (source[index] >> shift) | (source[index + 1] << (64 - shift));
+}
+
+static void scalarFunnelUpWords(uint64_t* target, const uint64_t* source, const size_t count, const unsigned shift) {
+	for (size_t index = count; index > 0; --index)
+		target[index - 1] = (source[index - 1] << shift) | (source[index - 2] >> (64 - shift));
+}
+
+static bool scalarEqualWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	for (size_t index = 0; index < count; ++index)
+		if (left[index] != right[index]) return false;
+	return true;
+}
+
+// Portable bit-parallel population count of a single word
+
+static inline uint64_t scalarPopcount(uint64_t word) {
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (word * 0x0101010101010101ULL) >> 56;
+}
+
+// Popcount kernels are instantiated twice: for the words themselves and for the xor of two word arrays,
+// the latter is how the Hamming distance is computed without materialising the xor
+
+template <bool Xor>
+static inline uint64_t loadWord(const uint64_t* left, const uint64_t* right, const size_t index) {
+	return Xor ? (left[index] ^ right[index]) : left[index];
+}
+
+template <bool Xor>
+static size_t scalarCountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	size_t total = 0;
+	for (size_t index = 0; index < count; ++index)
+		total += scalarPopcount(loadWord<Xor>(left, right, index));
+	return total;
+}
+
+static size_t scalarPopcountWords(const uint64_t* words, const size_t count) {
+	return scalarCountWords<false>(words, nullptr, count);
+}
+
+static size_t scalarXorPopcountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	return scalarCountWords<true>(left, right, count);
+}
+
+static void scalarXorPopcountRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, size_t* distances) {
+	for (size_t row = 0; row < count; ++row)
+		distances[row] = scalarCountWords<true>(query, rows[row], words);
+}
+
+// The parity of the set bits of several words is the parity of their xor, thus scalar products over GF(2) fold
+// the conjunctions with xor and count the bits of a single word
+
+static inline bool wordParity(uint64_t word) {
+	word ^= word >> 32;
+	word ^= word >> 16;
+	word ^= word >> 8;
+	word ^= word >> 4;
+	word ^= word >> 2;
+	word ^= word >> 1;
+	return (word & 1) != 0;
+}
+
+static uint64_t scalarAndFold(const uint64_t* left, const uint64_t* right, const size_t count) {
+	uint64_t sum = 0;
+	for (size_t index = 0; index < count; ++index)
+		sum ^= left[index] & right[index];
+	return sum;
+}
+
+static bool scalarAndParityWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	return wordParity(scalarAndFold(left, right, count));
+}
+
+static void scalarAndParityRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, uint64_t* parities) {
+	for (size_t first = 0; first < count; first += 64) {
+		uint64_t packed = 0;
+		for (size_t row = first; row < count && row < first + 64; ++row)
+			packed |= (uint64_t)wordParity(scalarAndFold(query, rows[row], words)) << (row - first);
+		parities[first / 64] = packed;
+	}
+}
+
+
+
+//  ##    ## ######## ########  ##    ## ######## ##        ######
+//  ##   ##  ##       ##     ## ###   ## ##       ##       ##    ##
+//  ##  ##   ##       ##     ## ####  ## ##       ##       ##
+//  #####    ######   ########  ## ## ## ######   ##        ######
+//  ##  ##   ##       ##   ##   ##  #### ##       ##             ##
+//  ##   ##  ##       ##    ##  ##   ### ##       ##       ##    ##
+//  ##    ## ######## ##     ## ##    ## ######## ########  ######
+
+#ifdef BITLIB_X86
+
+// Every vector instruction set provides the same set of primitives (<isa>Load, <isa>Store, <isa>Xor, <isa>And,
+// <isa>Or, <isa>Nand, <isa>Nor, <isa>Not, <isa>ShiftDown, <isa>ShiftUp, <isa>Broadcast and <isa>IsZero), compiled for its own target, so that
+// a single binary contains every kernel and the CPU features are only required once the kernel is selected.
+// Scalar products need no popcount instruction, thus every table takes those of its vector instruction set.
+
+#define BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, op, functor) \
+	BITLIB_TARGET(target) static void isa##op##Words(uint64_t* left, const uint64_t* right, const size_t count) { \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			isa##Store(left + index, isa##op(isa##Load(left + index), isa##Load(right + index))); \
+		functor operation; \
+		for (; index < count; ++index) \
+			left[index] = operation(left[index], right[index]); \
+	}
+
+#define BITLIB_VECTOR_KERNELS(isa, target, lanes) \
+	BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, Xor, bitwise_xor) \
+	BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, And, bitwise_and) \
+	BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, Or, bitwise_or) \
+	BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, Nand, bitwise_nand) \
+	BITLIB_VECTOR_BINARY_KERNEL(isa, target, lanes, Nor, bitwise_nor) \
+	BITLIB_TARGET(target) static void isa##InvertWords(uint64_t* words, const size_t count) { \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			isa##Store(words + index, isa##Not(isa##Load(words + index))); \
+		for (; index < count; ++index) \
+			words[index] = ~words[index]; \
+	} \
+	BITLIB_TARGET(target) static void isa##FillWords(uint64_t* words, const size_t count, const uint64_t value) { \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			isa##Store(words + index, isa##Broadcast(value)); \
+		for (; index < count; ++index) \
+			words[index] = value; \
+	} \
+	BITLIB_TARGET(target) static bool isa##EqualWords(const uint64_t* left, const uint64_t* right, const size_t count) { \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			if (!isa##IsZero(isa##Xor(isa##Load(left + index), isa##Load(right + index)))) return false; \
+		for (; index < count; ++index) \
+			if (left[index] != right[index]) return false; \
+		return true; \
+	} \
+	BITLIB_TARGET(target) static void isa##FunnelDownWords(uint64_t* words, const uint64_t* source, const size_t count, const unsigned shift) { \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			isa##Store(words + index, isa##Or(isa##ShiftDown(isa##Load(source + index), shift), isa##ShiftUp(isa##Load(source + index + 1), 64 - shift))); \
+		for (; index < count; ++index) \
+			words[index] = (source[index] >> shift) | (source[index + 1] << (64 - shift)); \
+	} \
+	BITLIB_TARGET(target) static void isa##FunnelUpWords(uint64_t* words, const uint64_t* source, const size_t count, const unsigned shift) { \
+		size_t index = count; \
+		for (; index >= lanes; index -= lanes) \
+			isa##Store(words + index - lanes, isa##Or(isa##ShiftUp(isa##Load(source + index - lanes), shift), isa##ShiftDown(isa##Load(source + index - lanes - 1), 64 - shift))); \
+		for (; index > 0; --index) \
+			words[index - 1] = (source[index - 1] << shift) | (source[index - 2] >> (64 - shift)); \
+	} \
+	BITLIB_TARGET(target) static inline uint64_t isa##AndFold(const uint64_t* left, const uint64_t* right, const size_t count) { \
+		auto sum = isa##Broadcast(0); \
+		size_t index = 0; \
+		for (; index + lanes <= count; index += lanes) \
+			sum = isa##Xor(sum, isa##And(isa##Load(left + index), isa##Load(right + index))); \
+		uint64_t folded[lanes], word = 0; \
+		isa##Store(folded, sum); \
+		for (size_t lane = 0; lane < lanes; ++lane) \
+			word ^= folded[lane]; \
+		for (; index < count; ++index) \
+			word ^= left[index] & right[index]; \
+		return word; \
+	} \
+	BITLIB_TARGET(target) static bool isa##AndParityWords(const uint64_t* left, const uint64_t* right, const size_t count) { \
+		return wordParity(isa##AndFold(left, right, count)); \
+	} \
+	BITLIB_TARGET(target) static void isa##AndParityRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, uint64_t* parities) { \
+		for (size_t first = 0; first < count; first += 64) { \
+			uint64_t packed = 0; \
+			for (size_t row = first; row < count && row < first + 64; ++row) \
+				packed |= (uint64_t)wordParity(isa##AndFold(query, rows[row], words)) << (row - first); \
+			parities[first / 64] = packed; \
+		} \
+	}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Load(const uint64_t* words) {
+	return _mm_loadu_si128((const __m128i*)words);
+}
+
+BITLIB_TARGET("sse2") static inline void sse2Store(uint64_t* words, const __m128i value) {
+	_mm_storeu_si128((__m128i*)words, value);
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Xor(const __m128i left, const __m128i right) {
+	return _mm_xor_si128(left, right);
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2And(const __m128i left, const __m128i right) {
+	return _mm_and_si128(left, right);
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Or(const __m128i left, const __m128i right) {
+	return _mm_or_si128(left, right);
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Not(const __m128i value) {
+	return _mm_xor_si128(value, _mm_set1_epi32(-1));
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Nand(const __m128i left, const __m128i right) {
+	return sse2Not(_mm_and_si128(left, right));
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Nor(const __m128i left, const __m128i right) {
+	return sse2Not(_mm_or_si128(left, right));
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2ShiftDown(const __m128i value, const unsigned shift) {
+	return _mm_srl_epi64(value, _mm_cvtsi32_si128((int)shift));
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2ShiftUp(const __m128i value, const unsigned shift) {
+	return _mm_sll_epi64(value, _mm_cvtsi32_si128((int)shift));
+}
+
+BITLIB_TARGET("sse2") static inline __m128i sse2Broadcast(const uint64_t value) {
+	return _mm_set1_epi64x((long long)value);
+}
+
+BITLIB_TARGET("sse2") static inline bool sse2IsZero(const __m128i value) {
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) == 0xFFFF;
+}
+
+BITLIB_VECTOR_KERNELS(sse2, "sse2", 2)
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Load(const uint64_t* words) {
+	return _mm256_loadu_si256((const __m256i*)words);
+}
+
+BITLIB_TARGET("avx2") static inline void avx2Store(uint64_t* words, const __m256i value) {
+	_mm256_storeu_si256((__m256i*)words, value);
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Xor(const __m256i left, const __m256i right) {
+	return _mm256_xor_si256(left, right);
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2And(const __m256i left, const __m256i right) {
+	return _mm256_and_si256(left, right);
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Or(const __m256i left, const __m256i right) {
+	return _mm256_or_si256(left, right);
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Not(const __m256i value) {
+	return _mm256_xor_si256(value, _mm256_set1_epi32(-1));
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Nand(const __m256i left, const __m256i right) {
+	return avx2Not(_mm256_and_si256(left, right));
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Nor(const __m256i left, const __m256i right) {
+	return avx2Not(_mm256_or_si256(left, right));
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2ShiftDown(const __m256i value, const unsigned shift) {
+	return _mm256_srl_epi64(value, _mm_cvtsi32_si128((int)shift));
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2ShiftUp(const __m256i value, const unsigned shift) {
+	return _mm256_sll_epi64(value, _mm_cvtsi32_si128((int)shift));
+}
+
+BITLIB_TARGET("avx2") static inline __m256i avx2Broadcast(const uint64_t value) {
+	return _mm256_set1_epi64x((long long)value);
+}
+
+BITLIB_TARGET("avx2") static inline bool avx2IsZero(const __m256i value) {
+	return _mm256_testz_si256(value, value) != 0;
+}
+
+BITLIB_VECTOR_KERNELS(avx2, "avx2", 4)
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Load(const uint64_t* words) {
+	return _mm512_loadu_si512((const void*)words);
+}
+
+BITLIB_TARGET("avx512f") static inline void avx512Store(uint64_t* words, const __m512i value) {
+	_mm512_storeu_si512((void*)words, value);
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Xor(const __m512i left, const __m512i right) {
+	return _mm512_xor_si512(left, right);
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512And(const __m512i left, const __m512i right) {
+	return _mm512_and_si512(left, right);
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Or(const __m512i left, const __m512i right) {
+	return _mm512_or_si512(left, right);
+}
+
+// Ternary logic immediates are the truth tables of the functions of (left, right, right)
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Not(const __m512i value) {
+	return _mm512_ternarylogic_epi64(value, value, value, 0x55);
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Nand(const __m512i left, const __m512i right) {
+	return _mm512_ternarylogic_epi64(left, right, right, 0x3F);
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Nor(const __m512i left, const __m512i right) {
+	return _mm512_ternarylogic_epi64(left, right, right, 0x03);
+}
+
+// Zero-masked forms, the unmasked ones merge into an undefined register which GCC reports as uninitialised
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512ShiftDown(const __m512i value, const unsigned shift) {
+	return _mm512_maskz_srlv_epi64((__mmask8)0xFF, value, _mm512_set1_epi64((long long)shift));
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512ShiftUp(const __m512i value, const unsigned shift) {
+	return _mm512_maskz_sllv_epi64((__mmask8)0xFF, value, _mm512_set1_epi64((long long)shift));
+}
+
+BITLIB_TARGET("avx512f") static inline __m512i avx512Broadcast(const uint64_t value) {
+	return _mm512_set1_epi64((long long)value);
+}
+
+BITLIB_TARGET("avx512f") static inline bool avx512IsZero(const __m512i value) {
+	return _mm512_test_epi64_mask(value, value) == 0;
+}
+
+BITLIB_VECTOR_KERNELS(avx512, "avx512f", 8)
+
+//  ########   #######  ########   ######   #######  ##     ## ##    ## ########
+//  ##     ## ##     ## ##     ## ##    ## ##     ## ##     ## ###   ##    ##
+//  ##     ## ##     ## ##     ## ##       ##     ## ##     ## ####  ##    ##
+//  ########  ##     ## ########  ##       ##     ## ##     ## ## ## ##    ##
+//  ##        ##     ## ##        ##       ##     ## ##     ## ##  ####    ##
+//  ##        ##     ## ##        ##    ## ##     ## ##     ## ##   ###    ##
+//  ##         #######  ##         ######   #######   #######  ##    ##    ##
+
+// Three popcount strategies are used depending on the host: the POPCNT instruction over separate accumulators
+// (hides the instruction latency), the Harley-Seal carry-save adder tree over AVX2 vectors (counts 16 vectors
+// with a single vector popcount, see Mula, Kurz, Lemire, "Faster Population Counts Using AVX2 Instructions"),
+// and the AVX-512 VPOPCNTDQ instruction, counting eight words at once.
+
+BITLIB_TARGET("popcnt") static inline uint64_t popcnt64(const uint64_t word) {
+#if defined(__x86_64__) || defined(_M_X64)
+	return (uint64_t)_mm_popcnt_u64(word);
+#else
+	return (uint64_t)_mm_popcnt_u32((uint32_t)word) + (uint64_t)_mm_popcnt_u32((uint32_t)(word >> 32));
+#endif
+}
+
+template <bool Xor>
+BITLIB_TARGET("popcnt") static size_t popcntCountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	uint64_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+	size_t index = 0;
+	for (; index + 4 <= count; index += 4) {
+		sum0 += popcnt64(loadWord<Xor>(left, right, index));
+		sum1 += popcnt64(loadWord<Xor>(left, right, index + 1));
+		sum2 += popcnt64(loadWord<Xor>(left, right, index + 2));
+		sum3 += popcnt64(loadWord<Xor>(left, right, index + 3));
+	}
+	for (; index < count; ++index)
+		sum0 += popcnt64(loadWord<Xor>(left, right, index));
+	return (size_t)(sum0 + sum1 + sum2 + sum3);
+}
+
+template <bool Xor>
+BITLIB_TARGET("avx2") static inline __m256i avx2LoadWords(const uint64_t* left, const uint64_t* right, const size_t index) {
+	return Xor ? avx2Xor(avx2Load(left + index), avx2Load(right + index)) : avx2Load(left + index);
+}
+
+// Returns population counts of the four 64-bit lanes, via 4-bit lookup table
+BITLIB_TARGET("avx2") static inline __m256i avx2Popcount(const __m256i value) {
+	const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+						0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i nibbles = _mm256_set1_epi8(0x0F);
+	const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, nibbles));
+	const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi64(value, 4), nibbles));
+	return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+}
+
+// Carry-save adder: adds three vectors of bits, producing vectors of sum (low) and carry (high) bits
+BITLIB_TARGET("avx2") static inline void avx2Csa(__m256i& high, __m256i& low, const __m256i first, const __m256i second) {
+	const __m256i partial = _mm256_xor_si256(low, first);
+	high = _mm256_or_si256(_mm256_and_si256(low, first), _mm256_and_si256(partial, second));
+	low = _mm256_xor_si256(partial, second);
+}
+
+template <bool Xor>
+BITLIB_TARGET("avx2,popcnt") static size_t avx2CountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	if (count < 16) return popcntCountWords<Xor>(left, right, count);
+	__m256i total = _mm256_setzero_si256();
+	__m256i ones = total, twos = total, fours = total, eights = total, sixteens = total;
+	__m256i twosA, twosB, foursA, foursB, eightsA, eightsB;
+	size_t index = 0;
+	for (; index + 64 <= count; index += 64) {
+		twosA = ones; avx2Csa(twosA, ones, avx2LoadWords<Xor>(left, right, index), avx2LoadWords<Xor>(left, right, index + 4));
+		twosB = ones; avx2Csa(twosB, ones, avx2LoadWords<Xor>(left, right, index + 8), avx2LoadWords<Xor>(left, right, index + 12));
+		foursA = twos; avx2Csa(foursA, twos, twosA, twosB);
+		twosA = ones; avx2Csa(twosA, ones, avx2LoadWords<Xor>(left, right, index + 16), avx2LoadWords<Xor>(left, right, index + 20));
+		twosB = ones; avx2Csa(twosB, ones, avx2LoadWords<Xor>(left, right, index + 24), avx2LoadWords<Xor>(left, right, index + 28));
+		foursB = twos; avx2Csa(foursB, twos, twosA, twosB);
+		eightsA = fours; avx2Csa(eightsA, fours, foursA, foursB);
+		twosA = ones; avx2Csa(twosA, ones, avx2LoadWords<Xor>(left, right, index + 32), avx2LoadWords<Xor>(left, right, index + 36));
+		twosB = ones; avx2Csa(twosB, ones, avx2LoadWords<Xor>(left, right, index + 40), avx2LoadWords<Xor>(left, right, index + 44));
+		foursA = twos; avx2Csa(foursA, twos, twosA, twosB);
+		twosA = ones; avx2Csa(twosA, ones, avx2LoadWords<Xor>(left, right, index + 48), avx2LoadWords<Xor>(left, right, index + 52));
+		twosB = ones; avx2Csa(twosB, ones, avx2LoadWords<Xor>(left, right, index + 56), avx2LoadWords<Xor>(left, right, index + 60));
+		foursB = twos; avx2Csa(foursB, twos, twosA, twosB);
+		eightsB = fours; avx2Csa(eightsB, fours, foursA, foursB);
+		sixteens = eights; avx2Csa(sixteens, eights, eightsA, eightsB);
+		total = _mm256_add_epi64(total, avx2Popcount(sixteens));
+	}
+	total = _mm256_slli_epi64(total, 4);
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(avx2Popcount(eights), 3));
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(avx2Popcount(fours), 2));
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(avx2Popcount(twos), 1));
+	total = _mm256_add_epi64(total, avx2Popcount(ones));
+	for (; index + 4 <= count; index += 4)
+		total = _mm256_add_epi64(total, avx2Popcount(avx2LoadWords<Xor>(left, right, index)));
+	uint64_t lanes[4];
+	_mm256_storeu_si256((__m256i*)lanes, total);
+	return (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + popcntCountWords<Xor>(left + index, Xor ? right + index : right, count - index);
+}
+
+template <bool Xor>
+BITLIB_TARGET("avx512f,avx512vpopcntdq") static size_t avx512CountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	__m512i total = _mm512_setzero_si512();
+	size_t index = 0;
+	for (; index + 8 <= count; index += 8) {
+		__m512i words = avx512Load(left + index);
+		if (Xor) words = avx512Xor(words, avx512Load(right + index));
+		total = _mm512_add_epi64(total, _mm512_popcnt_epi64(words));
+	}
+	if (index < count) {
+		const __mmask8 mask = (__mmask8)((1u << (count - index)) - 1);
+		__m512i words = _mm512_maskz_loadu_epi64(mask, left + index);
+		if (Xor) words = avx512Xor(words, _mm512_maskz_loadu_epi64(mask, right + index));
+		total = _mm512_add_epi64(total, _mm512_popcnt_epi64(words));
+	}
+	uint64_t lanes[8];
+	_mm512_storeu_si512((void*)lanes, total);
+	return (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7]);
+}
+
+static size_t popcntPopcountWords(const uint64_t* words, const size_t count) {
+	return popcntCountWords<false>(words, nullptr, count);
+}
+
+static size_t popcntXorPopcountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	return popcntCountWords<true>(left, right, count);
+}
+
+static size_t avx2PopcountWords(const uint64_t* words, const size_t count) {
+	return avx2CountWords<false>(words, nullptr, count);
+}
+
+static size_t avx2XorPopcountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	return avx2CountWords<true>(left, right, count);
+}
+
+static size_t avx512PopcountWords(const uint64_t* words, const size_t count) {
+	return avx512CountWords<false>(words, nullptr, count);
+}
+
+static size_t avx512XorPopcountWords(const uint64_t* left, const uint64_t* right, const size_t count) {
+	return avx512CountWords<true>(left, right, count);
+}
+
+// Row kernels keep the per-row count inlined, so that short fingerprints do not pay for an indirect call each
+
+BITLIB_TARGET("popcnt") static void popcntXorPopcountRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, size_t* distances) {
+	for (size_t row = 0; row < count; ++row)
+		distances[row] = popcntCountWords<true>(query, rows[row], words);
+}
+
+BITLIB_TARGET("avx2,popcnt") static void avx2XorPopcountRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, size_t* distances) {
+	for (size_t row = 0; row < count; ++row)
+		distances[row] = avx2CountWords<true>(query, rows[row], words);
+}
+
+BITLIB_TARGET("avx512f,avx512vpopcntdq") static void avx512XorPopcountRows(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, size_t* distances) {
+	for (size_t row = 0; row < count; ++row)
+		distances[row] = avx512CountWords<true>(query, rows[row], words);
+}
+
+#endif
+
+
+
+//  ########    ###    ########  ##       ########  ######
+//     ##      ## ##   ##     ## ##       ##       ##    ##
+//     ##     ##   ##  ##     ## ##       ##       ##
+//     ##    ##     ## ########  ##       ######    ######
+//     ##    ######### ##     ## ##       ##             ##
+//     ##    ##     ## ##     ## ##       ##       ##    ##
+//     ##    ##     ## ########  ######## ########  ######
+
+static const bitset_kernels_t scalarKernels = {
+	isa_t::scalar,
+	scalarTransformWords<bitwise_xor>,
+	scalarTransformWords<bitwise_and>,
+	scalarTransformWords<bitwise_or>,
+	scalarTransformWords<bitwise_nand>,
+	scalarTransformWords<bitwise_nor>,
+	scalarInvertWords,
+	scalarFillWords,
+	scalarEqualWords,
+	scalarFunnelDownWords,
+	scalarFunnelUpWords,
+	scalarPopcountWords,
+	scalarXorPopcountWords,
+	scalarXorPopcountRows,
+	scalarAndParityWords,
+	scalarAndParityRows
+};
+
+#ifdef BITLIB_X86
+
+static const bitset_kernels_t sse2Kernels = {
+	isa_t::sse2,
+	sse2XorWords,
+	sse2AndWords,
+	sse2OrWords,
+	sse2NandWords,
+	sse2NorWords,
+	sse2InvertWords,
+	sse2FillWords,
+	sse2EqualWords,
+	sse2FunnelDownWords,
+	sse2FunnelUpWords,
+	popcntPopcountWords,
+	popcntXorPopcountWords,
+	popcntXorPopcountRows,
+	sse2AndParityWords,
+	sse2AndParityRows
+};
+
+static const bitset_kernels_t avx2Kernels = {
+	isa_t::avx2,
+	avx2XorWords,
+	avx2AndWords,
+	avx2OrWords,
+	avx2NandWords,
+	avx2NorWords,
+	avx2InvertWords,
+	avx2FillWords,
+	avx2EqualWords,
+	avx2FunnelDownWords,
+	avx2FunnelUpWords,
+	avx2PopcountWords,
+	avx2XorPopcountWords,
+	avx2XorPopcountRows,
+	avx2AndParityWords,
+	avx2AndParityRows
+};
+
+// VPOPCNTDQ is a separate AVX-512 extension, hosts without it count with AVX2 Harley-Seal kernels
+
+static const bitset_kernels_t avx512Kernels = {
+	isa_t::avx512,
+	avx512XorWords,
+	avx512AndWords,
+	avx512OrWords,
+	avx512NandWords,
+	avx512NorWords,
+	avx512InvertWords,
+	avx512FillWords,
+	avx512EqualWords,
+	avx512FunnelDownWords,
+	avx512FunnelUpWords,
+	avx2PopcountWords,
+	avx2XorPopcountWords,
+	avx2XorPopcountRows,
+	avx512AndParityWords,
+	avx512AndParityRows
+};
+
+static const bitset_kernels_t avx512PopcntKernels = {
+	isa_t::avx512,
+	avx512XorWords,
+	avx512AndWords,
+	avx512OrWords,
+	avx512NandWords,
+	avx512NorWords,
+	avx512InvertWords,
+	avx512FillWords,
+	avx512EqualWords,
+	avx512FunnelDownWords,
+	avx512FunnelUpWords,
+	avx512PopcountWords,
+	avx512XorPopcountWords,
+	avx512XorPopcountRows,
+	avx512AndParityWords,
+	avx512AndParityRows
+};
+
+#endif
+
+
+
+//  ########  ####  ######  ########     ###    ########  ######  ##     ##
+//  ##     ##  ##  ##    ## ##     ##   ## ##      ##    ##    ## ##     ##
+//  ##     ##  ##  ##       ##     ##  ##   ##     ##    ##       ##     ##
+//  ##     ##  ##   ######  ########  ##     ##    ##    ##       #########
+//  ##     ##  ##        ## ##        #########    ##    ##       ##     ##
+//  ##     ##  ##  ##    ## ##        ##     ##    ##    ##    ## ##     ##
+//  ########  ####  ######  ##        ##     ##    ##     ######  ##     ##
+
+/**
+ * @brief CPU features relevant to kernel selection, usable by the operating system
+ */
+struct cpu_features_t {
+	bool sse2;
+	bool popcnt;
+	bool avx2;
+	bool avx512;
+	bool vpopcntdq;
+};
+
+static cpu_features_t queryFeatures() {
+	cpu_features_t features = {false, false, false, false, false};
+#if defined(BITLIB_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	features.sse2 = __builtin_cpu_supports("sse2") != 0;
+	features.popcnt = __builtin_cpu_supports("popcnt") != 0;
+	features.avx2 = __builtin_cpu_supports("avx2") != 0;
+	features.avx512 = __builtin_cpu_supports("avx512f") != 0;
+	features.vpopcntdq = __builtin_cpu_supports("avx512vpopcntdq") != 0;
+#elif defined(BITLIB_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	const int leaves = info[0];
+	__cpuid(info, 1);
+	features.sse2 = (info[3] & (1 << 26)) != 0;
+	features.popcnt = (info[2] & (1 << 23)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+	if (leaves >= 7) {
+		__cpuidex(info, 7, 0);
+		features.avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x06) == 0x06;
+		features.avx512 = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+		features.vpopcntdq = features.avx512 && (info[2] & (1 << 14)) != 0;
+	}
+#endif
+	return features;
+}
+
+static const cpu_features_t& cpuFeatures() {
+	static const cpu_features_t features = queryFeatures();
+	return features;
+}
+
+static isa_t queryIsa() {
+	const cpu_features_t& features = cpuFeatures();
+	if (!features.sse2 || !features.popcnt) return isa_t::scalar;
+	if (features.avx512 && features.avx2) return isa_t::avx512;
+	if (features.avx2) return isa_t::avx2;
+	return isa_t::sse2;
+}
+
+static const bitset_kernels_t* kernelsFor(const isa_t isa) {
+#ifdef BITLIB_X86
+	switch (isa) {
+	case isa_t::avx512:
+		return cpuFeatures().vpopcntdq ? &avx512PopcntKernels : &avx512Kernels;
+	case isa_t::avx2:
+		return &avx2Kernels;
+	case isa_t::sse2:
+		return &sse2Kernels;
+	default:
+		break;
+	}
+#endif
+	(void)isa;
+	return &scalarKernels;
+}
+
+static const bitset_kernels_t* startupKernels() {
+	isa_t isa = detectIsa();
+	const char* requested = std::getenv("BITLIB_ISA");
+	if (requested != nullptr) {
+		for (isa_t candidate : {isa_t::scalar, isa_t::sse2, isa_t::avx2, isa_t::avx512})
+			if (std::strcmp(requested, isaName(candidate)) == 0 && candidate <= isa)
+				isa = candidate;
+	}
+	return kernelsFor(isa);
+}
+
+static std::atomic<const bitset_kernels_t*>& activeKernels() {
+	static std::atomic<const bitset_kernels_t*> kernels(startupKernels());
+	return kernels;
+}
+
+isa_t detectIsa() {
+	static const isa_t isa = queryIsa();
+	return isa;
+}
+
+isa_t activeIsa() {
+	return bitsetKernels().isa;
+}
+
+bool forceIsa(const isa_t isa) {
+	if (isa > detectIsa()) return false;
+	activeKernels().store(kernelsFor(isa), std::memory_order_relaxed);
+	return true;
+}
+
+const char* isaName(const isa_t isa) {
+	switch (isa) {
+	case isa_t::sse2:
+		return "sse2";
+	case isa_t::avx2:
+		return "avx2";
+	case isa_t::avx512:
+		return "avx512";
+	default:
+		return "scalar";
+	}
+}
+
+const bitset_kernels_t& bitsetKernels() {
+	return *activeKernels().load(std::memory_order_relaxed);
+}
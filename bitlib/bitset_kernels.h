@@ -0,0 +1,287 @@
+/**
+ * @file bitset_kernels.h
+ * @date October 16, 2026
+ * @brief Contains definition of the bulk word kernels used by `bitset_t`
+ */
+
+#ifndef bitlib___bitset_kernels_h
+#define bitlib___bitset_kernels_h
+
+#include <cstdint>
+#include <cstddef>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Instruction set level of the bulk word kernels
+ *
+ * @details Levels are ordered by vector width, every level is a superset of the previous one on x86 hosts.
+ */
+enum class isa_t {
+	scalar,	///< Portable C++ loops, available on every host
+	sse2,	///< 128-bit SSE2 vectors and the POPCNT instruction
+	avx2,	///< 256-bit AVX2 vectors
+	avx512	///< 512-bit AVX-512F vectors
+};
+
+/**
+ * @brief Table of bulk word kernels
+ *
+ * @details Every kernel processes @p count consecutive `uint64_t` words. Binary kernels store the result into @p target, which is also the left operand. Kernels do not know anything about the bitset length, thus it is up to the caller to clear unused tail bits of the last word afterwards.
+ *
+ * One table exists per @ref isa_t level; the table for the widest level supported by the host is selected on the first call to bitsetKernels().
+ *
+ * Example usage:
+ * @code
+ *	// Xor two word arrays with the best kernel available on this host
+ *	uint64_t x[4] = {1, 2, 3, 4}, y[4] = {4, 3, 2, 1};
+ *	bitsetKernels().xorWords(x, y, 4);
+ * @endcode
+ */
+struct bitset_kernels_t {
+	/**
+	 * @brief Instruction set level the kernels were compiled for
+	 */
+	isa_t isa;
+
+	/**
+	 * @brief Calculates @p target = @p target ^ @p source word by word
+	 */
+	void (*xorWords)(uint64_t* target, const uint64_t* source, const size_t count);
+
+	/**
+	 * @brief Calculates @p target = @p target & @p source word by word
+	 */
+	void (*andWords)(uint64_t* target, const uint64_t* source, const size_t count);
+
+	/**
+	 * @brief Calculates @p target = @p target | @p source word by word
+	 */
+	void (*orWords)(uint64_t* target, const uint64_t* source, const size_t count);
+
+	/**
+	 * @brief Calculates @p target = ~(@p target & @p source) word by word
+	 */
+	void (*nandWords)(uint64_t* target, const uint64_t* source, const size_t count);
+
+	/**
+	 * @brief Calculates @p target = ~(@p target | @p source) word by word
+	 */
+	void (*norWords)(uint64_t* target, const uint64_t* source, const size_t count);
+
+	/**
+	 * @brief Calculates @p target = ~@p target word by word
+	 */
+	void (*invertWords)(uint64_t* target, const size_t count);
+
+	/**
+	 * @brief Assigns @p value to every word of @p target
+	 */
+	void (*fillWords)(uint64_t* target, const size_t count, const uint64_t value);
+
+	/**
+	 * @brief Tests whether all words of @p left and @p right are equal
+	 */
+	bool (*equalWords)(const uint64_t* left, const uint64_t* right, const size_t count);
+
+	/**
+	 * @brief Calculates @p target[i] = (@p source[i] >> @p shift) | (@p source[i + 1] << (64 - @p shift)) for every i below @p count
+	 *
+	 * @details Reads @p count + 1 words of @p source; @p shift must be in [1, 63]. Words are processed from the first one, thus @p target may be @p source or precede it.
+	 */
+	void (*funnelDownWords)(uint64_t* target, const uint64_t* source, const size_t count, const unsigned shift);
+
+	/**
+	 * @brief Calculates @p target[i] = (@p source[i] << @p shift) | (@p source[i - 1] >> (64 - @p shift)) for every i below @p count
+	 *
+	 * @details Reads @p count + 1 words of @p source, starting from @p source[-1]; @p shift must be in [1, 63]. Words are processed from the last one, thus @p target may be @p source or follow it.
+	 */
+	void (*funnelUpWords)(uint64_t* target, const uint64_t* source, const size_t count, const unsigned shift);
+
+	/**
+	 * @brief Returns the number of set bits in the words of @p words
+	 */
+	size_t (*popcountWords)(const uint64_t* words, const size_t count);
+
+	/**
+	 * @brief Returns the number of set bits in @p left ^ @p right, without storing the xor anywhere
+	 */
+	size_t (*xorPopcountWords)(const uint64_t* left, const uint64_t* right, const size_t count);
+
+	/**
+	 * @brief Stores the number of set bits in @p query ^ @p rows[i] into @p distances[i] for each of @p count rows of @p words words
+	 */
+	void (*xorPopcountRows)(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, size_t* distances);
+
+	/**
+	 * @brief Returns the parity of the number of set bits in @p left & @p right, their scalar product over GF(2)
+	 */
+	bool (*andParityWords)(const uint64_t* left, const uint64_t* right, const size_t count);
+
+	/**
+	 * @brief Stores the scalar product of @p query and @p rows[i] into bit i % 64 of @p parities[i / 64] for each of @p count rows of @p words words
+	 *
+	 * @details Writes all of the (@p count + 63) / 64 words of @p parities, with the bits past @p count reset.
+	 */
+	void (*andParityRows)(const uint64_t* query, const uint64_t* const* rows, const size_t count, const size_t words, uint64_t* parities);
+};
+
+
+
+//  ########  ####  ######  ########     ###    ########  ######  ##     ##
+//  ##     ##  ##  ##    ## ##     ##   ## ##      ##    ##    ## ##     ##
+//  ##     ##  ##  ##       ##     ##  ##   ##     ##    ##       ##     ##
+//  ##     ##  ##   ######  ########  ##     ##    ##    ##       #########
+//  ##     ##  ##        ## ##        #########    ##    ##       ##     ##
+//  ##     ##  ##  ##    ## ##        ##     ##    ##    ##    ## ##     ##
+//  ########  ####  ######  ##        ##     ##    ##     ######  ##     ##
+
+/**
+ * @brief Returns the widest instruction set level supported by the host
+ *
+ * @details Queries CPUID (and the operating system support of the extended vector registers) once and caches the result.
+ *
+ * @return Widest @ref isa_t level the host can run.
+ */
+isa_t detectIsa();
+
+/**
+ * @brief Returns the instruction set level of the active kernels
+ *
+ * @return @ref isa_t level of the table returned by bitsetKernels().
+ */
+isa_t activeIsa();
+
+/**
+ * @brief Forces the kernels of a particular instruction set level
+ *
+ * @details Makes bitsetKernels() return the table for @p isa, so that every code path can be tested on a single machine. The active level can also be forced at startup by setting the `BITLIB_ISA` environment variable to one of `scalar`, `sse2`, `avx2` or `avx512`.
+ *
+ * @param [in] isa Instruction set level to use.
+ *
+ * @retval true The kernels were switched to @p isa.
+ * @retval false The host does not support @p isa, active kernels are left intact.
+ *
+ * @warning Switching kernels is not synchronised with bitset operations running in other threads. It is intended for tests and benchmarks only.
+ *
+ * Example usage:
+ * @code
+ *	// Run the same operation with every supported kernel
+ *	for (isa_t isa : {isa_t::scalar, isa_t::sse2, isa_t::avx2, isa_t::avx512})
+ *		if (forceIsa(isa))
+ *			result = X1 ^ X2;
+ * @endcode
+ */
+bool forceIsa(const isa_t isa);
+
+/**
+ * @brief Returns the name of the instruction set level
+ *
+ * @param [in] isa Instruction set level.
+ *
+ * @return One of `"scalar"`, `"sse2"`, `"avx2"` or `"avx512"`.
+ */
+const char* isaName(const isa_t isa);
+
+/**
+ * @brief Returns the active kernel table
+ *
+ * @details On the first call the table for the widest level supported by the host (or the one requested by the `BITLIB_ISA` environment variable) is selected; later calls return the same table until forceIsa() is invoked.
+ *
+ * @return Reference to the active kernel table.
+ */
+const bitset_kernels_t& bitsetKernels();
+
+
+
+//   ######   ######     ###    ##    ##
+//  ##    ## ##    ##   ## ##   ###   ##
+//  ##       ##        ##   ##  ####  ##
+//   ######  ##       ##     ## ## ## ##
+//        ## ##       ######### ##  ####
+//  ##    ## ##    ## ##     ## ##   ###
+//   ######   ######  ##     ## ##    ##
+
+/**
+ * @brief Returns the index of the lowest set bit of @p word
+ *
+ * @details Compiles to a single TZCNT/BSF (or RBIT+CLZ) instruction on GCC, Clang and MSVC.
+ *
+ * @param [in] word Word to scan.
+ *
+ * @return Number of trailing zero bits of @p word.
+ *
+ * @warning @p word <b>must not be zero</b>.
+ *
+ * Example usage:
+ * @code
+ *	// Visit every set bit of the word
+ *	for (uint64_t rest = word; rest != 0; rest &= rest - 1)
+ *		visit(trailingZeros(rest));
+ * @endcode
+ */
+inline size_t trailingZeros(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)__builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return (size_t)index;
+#else
+	size_t index = 0;
+	for (uint64_t rest = word; (rest & 1) == 0; rest >>= 1)
+		++index;
+	return index;
+#endif
+}
+
+/**
+ * @brief Returns the number of zero bits above the highest set bit of @p word
+ *
+ * @details Compiles to a single LZCNT/BSR (or CLZ) instruction on GCC, Clang and MSVC; the index of the highest set bit is `63 - leadingZeros(word)`.
+ *
+ * @param [in] word Word to scan.
+ *
+ * @return Number of leading zero bits of @p word.
+ *
+ * @warning @p word <b>must not be zero</b>.
+ */
+inline size_t leadingZeros(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)__builtin_clzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, word);
+	return 63 - (size_t)index;
+#else
+	size_t count = 0;
+	for (uint64_t rest = word; (rest >> 63) == 0; rest <<= 1)
+		++count;
+	return count;
+#endif
+}
+
+/**
+ * @brief Returns the number of set bits of @p word
+ *
+ * @details Compiles to a single POPCNT (or CNT) instruction when the target supports it, and to a SWAR bit count otherwise. Meant for a few scattered words; use bitset_kernels_t::popcountWords for arrays.
+ *
+ * @param [in] word Word to count.
+ *
+ * @return Number of set bits of @p word.
+ */
+inline size_t popcountWord(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)__builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return (size_t)__popcnt64(word);
+#else
+	uint64_t count = word - ((word >> 1) & 0x5555555555555555ULL);
+	count = (count & 0x3333333333333333ULL) + ((count >> 2) & 0x3333333333333333ULL);
+	count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (size_t)((count * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+#endif
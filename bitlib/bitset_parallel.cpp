@@ -0,0 +1,217 @@
+/**
+ * @file bitset_parallel.cpp
+ * @implements bitset_parallel.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `work_pool_t` class and of the parallel split of bulk bitset operations
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include "bitset_parallel.h"
+
+// Set while a thread runs grains, so that jobs submitted from a grain run inline instead of waiting for the pool
+static thread_local bool insidePool = false;
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+work_pool_t::work_pool_t(const size_t threads) : workers(), ranges(), jobLock(), stateLock(), wake(), done(), task(nullptr), generation(0), active(0), stopping(false), failure() {
+	const size_t count = (threads != 0) ? threads : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	ranges.reset(new range_t[count]);
+	for (size_t index = 0; index < count; ++index)
+		ranges[index].next = ranges[index].last = 0;
+	workers.reserve(count - 1);
+	for (size_t index = 0; index + 1 < count; ++index)
+		workers.emplace_back(&work_pool_t::workerLoop, this, index);
+	return;
+}
+
+work_pool_t::~work_pool_t() {
+	{
+		std::lock_guard<std::mutex> guard(stateLock);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+	return;
+}
+
+
+
+//   ######   ######  ##     ## ######## ########  ##     ## ##       ########
+//  ##    ## ##    ## ##     ## ##       ##     ## ##     ## ##       ##
+//  ##       ##       ##     ## ##       ##     ## ##     ## ##       ##
+//   ######  ##       ######### ######   ##     ## ##     ## ##       ######
+//        ## ##       ##     ## ##       ##     ## ##     ## ##       ##
+//  ##    ## ##    ## ##     ## ##       ##     ## ##     ## ##       ##
+//   ######   ######  ##     ## ######## ########   #######  ######## ########
+
+size_t work_pool_t::threads() const {
+	return workers.size() + 1;
+}
+
+void work_pool_t::participate(const size_t self) {
+	const size_t count = threads();
+	const bool nested = insidePool;
+	insidePool = true;
+	for (;;) {
+		size_t grain = 0;
+		bool found = false;
+		{
+			std::lock_guard<std::mutex> guard(ranges[self].lock);
+			if (ranges[self].next < ranges[self].last) {
+				grain = ranges[self].next++;
+				found = true;
+			}
+		}
+		// Steal from the back, the grains their owner would run last
+		for (size_t step = 1; !found && step < count; ++step) {
+			range_t& victim = ranges[(self + step) % count];
+			std::lock_guard<std::mutex> guard(victim.lock);
+			if (victim.next < victim.last) {
+				grain = --victim.last;
+				found = true;
+			}
+		}
+		if (!found) break;
+		try {
+			(*task)(grain);
+		} catch (...) {
+			std::lock_guard<std::mutex> guard(stateLock);
+			if (!failure) failure = std::current_exception();
+		}
+	}
+	insidePool = nested;
+}
+
+void work_pool_t::workerLoop(const size_t self) {
+	size_t seen = 0;
+	std::unique_lock<std::mutex> guard(stateLock);
+	for (;;) {
+		wake.wait(guard, [&]() { return stopping || generation != seen; });
+		if (stopping) return;
+		seen = generation;
+		guard.unlock();
+		participate(self);
+		guard.lock();
+		if (--active == 0) done.notify_all();
+	}
+}
+
+void work_pool_t::run(const size_t grains, const std::function<void(size_t grain)>& task) {
+	if (insidePool || workers.empty() || grains <= 1) {
+		for (size_t grain = 0; grain < grains; ++grain)
+			task(grain);
+		return;
+	}
+	std::lock_guard<std::mutex> job(jobLock);
+	const size_t count = threads();
+	for (size_t index = 0; index < count; ++index) {
+		std::lock_guard<std::mutex> guard(ranges[index].lock);
+		ranges[index].next = grains * index / count;
+		ranges[index].last = grains * (index + 1) / count;
+	}
+	{
+		std::lock_guard<std::mutex> guard(stateLock);
+		this->task = &task;
+		failure = nullptr;
+		active = workers.size();
+		++generation;
+	}
+	wake.notify_all();
+	participate(count - 1);
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> guard(stateLock);
+		done.wait(guard, [&]() { return active == 0; });
+		this->task = nullptr;
+		error = failure;
+		failure = nullptr;
+	}
+	if (error) std::rethrow_exception(error);
+}
+
+
+
+//   ######  ########  ##       #### ########
+//  ##    ## ##     ## ##        ##     ##
+//  ##       ##     ## ##        ##     ##
+//   ######  ########  ##        ##     ##
+//        ## ##        ##        ##     ##
+//  ##    ## ##        ##        ##     ##
+//   ######  ##        ######## ####    ##
+
+// Words per cache line; ranges start at line boundaries
+static const size_t lineWords = 64 / sizeof(uint64_t);
+
+// Ranges per thread, so that threads finishing early have grains left to steal
+static const size_t grainsPerThread = 4;
+
+// Smallest range, below which the scheduling costs more than the words
+static const size_t minimumGrainWords = 2048;
+
+static std::atomic<size_t> configuredThreads(0);
+static std::atomic<size_t> parallelThreshold((size_t)1 << 16);
+
+static std::mutex sharedPoolLock;
+static std::shared_ptr<work_pool_t> sharedPool;
+
+// Jobs hold the pool they run on, so that a pool replaced after a change of bitsetThreads() is destroyed by its last job
+static std::shared_ptr<work_pool_t> pool() {
+	std::lock_guard<std::mutex> guard(sharedPoolLock);
+	const size_t threads = bitsetThreads();
+	if (sharedPool == nullptr || sharedPool->threads() != threads)
+		sharedPool = std::make_shared<work_pool_t>(threads);
+	return sharedPool;
+}
+
+size_t bitsetThreads() {
+	const size_t threads = configuredThreads.load();
+	return (threads != 0) ? threads : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void setBitsetThreads(const size_t threads) {
+	configuredThreads.store(threads);
+}
+
+size_t bitsetParallelThreshold() {
+	return parallelThreshold.load();
+}
+
+void setBitsetParallelThreshold(const size_t words) {
+	parallelThreshold.store(words);
+}
+
+bool splitsAcrossThreads(const size_t count) {
+	return count >= std::max(bitsetParallelThreshold(), 2 * minimumGrainWords) && bitsetThreads() > 1 && !insidePool;
+}
+
+size_t splitWords(const void* base, const size_t count, const std::function<size_t(const size_t first, const size_t last)>& task, const size_t weight) {
+	const std::shared_ptr<work_pool_t> shared = pool();
+	work_pool_t& workers = *shared;
+	// Words before the first line boundary of base; they go to the first range
+	const size_t skew = std::min(count, (lineWords - (size_t)((uintptr_t)base / sizeof(uint64_t)) % lineWords) % lineWords);
+	size_t grainWords = std::max(std::max<size_t>(minimumGrainWords / std::max<size_t>(weight, 1), 1), count / (workers.threads() * grainsPerThread));
+	grainWords = (grainWords + lineWords - 1) / lineWords * lineWords;
+	const size_t grains = std::max<size_t>((count - skew + grainWords - 1) / grainWords, 1);
+	// A line per grain, so that workers storing their sums do not write the same line
+	std::vector<size_t> partial(grains * lineWords, 0);
+	workers.run(grains, [&](const size_t grain) {
+		const size_t first = (grain == 0) ? 0 : skew + grain * grainWords;
+		const size_t last = std::min(count, skew + (grain + 1) * grainWords);
+		partial[grain * lineWords] = task(first, last);
+	});
+	size_t total = 0;
+	for (size_t grain = 0; grain < grains; ++grain)
+		total += partial[grain * lineWords];
+	return total;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file bitset_parallel.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `work_pool_t` class and of the parallel split of bulk bitset operations
+ */
+
+#ifndef bitlib___bitset_parallel_h
+#define bitlib___bitset_parallel_h
+
+#include <cstdint>
+#include <cstddef>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool of worker threads running the grains of a job with work stealing
+ *
+ * @details A job of @c n grains is split into contiguous ranges, one per participant (every worker and the calling thread). Each participant runs the grains of its range from the front; once its range is exhausted it steals grains from the back of the ranges of the others, so that participants slowed down by other load do not delay the job. Workers sleep between jobs. Jobs submitted from several threads run one after the other, and jobs submitted from a grain run in the submitting thread.
+ *
+ * Example usage:
+ * @code
+ *	work_pool_t pool(8);
+ *	std::vector<size_t> sizes(files.size());
+ *	pool.run(files.size(), [&](const size_t grain) { sizes[grain] = fileSize(files[grain]); });
+ * @endcode
+ */
+class work_pool_t {
+private:
+	/**
+	 * @brief Grains [@ref next, @ref last) left to a participant
+	 */
+	struct range_t {
+		std::mutex lock;
+		size_t next;
+		size_t last;
+	};
+
+	std::vector<std::thread> workers;
+
+	/**
+	 * @brief Ranges of the workers, followed by the range of the calling thread
+	 */
+	std::unique_ptr<range_t[]> ranges;
+
+	/**
+	 * @brief Serializes jobs submitted from several threads
+	 */
+	std::mutex jobLock;
+
+	std::mutex stateLock;
+	std::condition_variable wake;
+	std::condition_variable done;
+	const std::function<void(size_t)>* task;
+	size_t generation;
+	size_t active;
+	bool stopping;
+	std::exception_ptr failure;
+
+	/**
+	 * @brief Runs grains of the current job, first from range @p self, then stolen from the others, until none is left
+	 */
+	void participate(const size_t self);
+
+	void workerLoop(const size_t self);
+public:
+	/**
+	 * @brief Work pool constructor
+	 *
+	 * @param [in] threads Number of threads running a job, including the calling thread; `0` uses every hardware thread.
+	 */
+	explicit work_pool_t(const size_t threads);
+
+	work_pool_t(const work_pool_t&) = delete;
+	work_pool_t& operator=(const work_pool_t&) = delete;
+
+	/**
+	 * @brief Stops and joins the workers
+	 */
+	~work_pool_t();
+
+	/**
+	 * @brief Returns the number of threads running a job, including the calling thread
+	 */
+	size_t threads() const;
+
+	/**
+	 * @brief Runs @p task once for every grain in [0, @p grains), and returns once all have completed
+	 *
+	 * @throw Rethrows the first exception thrown by @p task, after the other grains have completed.
+	 */
+	void run(const size_t grains, const std::function<void(size_t grain)>& task);
+};
+
+/**
+ * @brief Returns the number of threads bulk bitset operations are split across
+ */
+size_t bitsetThreads();
+
+/**
+ * @brief Sets the number of threads bulk bitset operations are split across
+ *
+ * @details The operations are binary operators and their expressions, invert(), setAll(), resetAll(), fillWith(), count(), hammingDistance(), the shifts and the rotations of `bitset_t`, and the batched hammingDistances(), hammingDistanceMatrix() and scalarProducts(). The default is every hardware thread.
+ *
+ * May be called while bitset operations run in other threads: operations already split finish on the threads they started with, and the next ones start on a pool of the new size.
+ *
+ * @param [in] threads Number of threads, including the calling thread; `0` uses every hardware thread, `1` keeps every operation in the calling thread.
+ *
+ * Example usage:
+ * @code
+ *	// Leave a core to the I/O threads
+ *	setBitsetThreads(std::thread::hardware_concurrency() - 1);
+ * @endcode
+ */
+void setBitsetThreads(const size_t threads);
+
+/**
+ * @brief Returns the number of words from which bulk bitset operations are split across threads
+ */
+size_t bitsetParallelThreshold();
+
+/**
+ * @brief Sets the number of words from which bulk bitset operations are split across threads
+ *
+ * @details Waking the workers costs a few microseconds, thus smaller bitsets are processed faster by the calling thread alone. The default is 65536 words, i.e. 4M bits.
+ */
+void setBitsetParallelThreshold(const size_t words);
+
+/**
+ * @brief Tests whether an operation on @p count words is split across threads
+ */
+bool splitsAcrossThreads(const size_t count);
+
+/**
+ * @brief Runs @p task over the words [0, @p count), split across the threads of the shared pool
+ *
+ * @details Ranges other than the first start at a cache line boundary of @p base, so that no two threads write the same cache line of the words at @p base. Operations on fewer words than bitsetParallelThreshold() run @p task over all of them in the calling thread.
+ *
+ * @param [in] base Pointer to the words written by @p task, or `nullptr` if it writes none.
+ * @param [in] count Number of words.
+ * @param [in] task Function of the first and past-the-last word of a range.
+ * @param [in] weight Number of words read by @p task per word of the range, e.g. 64 rows of @c n words for a word of scalar products; the threshold and the size of the ranges count these words.
+ *
+ * @return Sum of the values returned by @p task.
+ *
+ * Example usage:
+ * @code
+ *	size_t total = parallelForWords(nullptr, count, [&](const size_t first, const size_t last) {
+ *		return bitsetKernels().popcountWords(words + first, last - first);
+ *	});
+ * @endcode
+ */
+template <class Task>
+size_t parallelForWords(const void* base, const size_t count, const Task& task, const size_t weight = 1);
+
+/**
+ * @brief Splits the words [0, @p count) across the threads of the shared pool, see parallelForWords()
+ *
+ * @details Always splits; parallelForWords() calls it only above the threshold, so that operations on small bitsets never wrap @p task in a `std::function`.
+ */
+size_t splitWords(const void* base, const size_t count, const std::function<size_t(const size_t first, const size_t last)>& task, const size_t weight = 1);
+
+template <class Task>
+size_t parallelForWords(const void* base, const size_t count, const Task& task, const size_t weight) {
+	if (!splitsAcrossThreads(count * weight)) return task((size_t)0, count);
+	return splitWords(base, count, task, weight);
+}
+
+#endif
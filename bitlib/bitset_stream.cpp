@@ -0,0 +1,267 @@
+/**
+ * @file bitset_stream.cpp
+ * @implements bitset_stream.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `bitset_stream_t` class, its sources and sinks
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
+
+#include "bitset_stream.h"
+#include "bitset_kernels.h"
+#include "mapped_bitset.h"
+
+static size_t wordsOf(const size_t length) {
+	return length / 64 + (length % 64 != 0);
+}
+
+
+
+//   ######   #######  ##     ## ########   ######  ########  ######
+//  ##    ## ##     ## ##     ## ##     ## ##    ## ##       ##    ##
+//  ##       ##     ## ##     ## ##     ## ##       ##       ##
+//   ######  ##     ## ##     ## ########  ##       ######    ######
+//        ## ##     ## ##     ## ##   ##   ##       ##             ##
+//  ##    ## ##     ## ##     ## ##    ##  ##    ## ##       ##    ##
+//   ######   #######   #######  ##     ##  ######  ########  ######
+
+view_source_t::view_source_t(const bitset_view_t& bits) : bits(bits), position(0) {
+	return;
+}
+
+size_t view_source_t::length() const {
+	return bits.length();
+}
+
+size_t view_source_t::read(uint64_t* words, const size_t count) {
+	const size_t result = std::min(count, bits.wordCount() - position);
+	for (size_t index = 0; index < result; ++index)
+		words[index] = bits.paddedWord(position + index);
+	position += result;
+	return result;
+}
+
+file_source_t::file_source_t(const std::string& path) : file(path.c_str(), std::ios::binary), bitLength(0), remaining(0) {
+	bitset_file_header_t header = {};
+	if (!file || !file.read((char*)&header, sizeof(header)))
+		throw std::runtime_error("file_source_t::file_source_t: cannot open " + path);
+	const char* reason = nullptr;
+	if (header.magic != bitset_file_header_t::magicValue) reason = "not a bitset file: ";
+	else if (header.byteOrder != bitset_file_header_t::byteOrderValue) reason = "byte order differs from the host: ";
+	else if (header.version != bitset_file_header_t::currentVersion) reason = "unsupported version: ";
+	else if (!file.seekg((std::streamoff)header.payloadOffset)) reason = "truncated payload: ";
+	if (reason != nullptr)
+		throw std::runtime_error(std::string("file_source_t::file_source_t: ") + reason + path);
+	bitLength = (size_t)header.bitLength;
+	remaining = wordsOf(bitLength);
+	return;
+}
+
+size_t file_source_t::length() const {
+	return bitLength;
+}
+
+size_t file_source_t::read(uint64_t* words, const size_t count) {
+	const size_t result = std::min(count, remaining);
+	if (!file.read((char*)words, (std::streamsize)(result * sizeof(uint64_t))))
+		throw std::runtime_error("file_source_t::read: truncated payload");
+	remaining -= result;
+	return result;
+}
+
+generator_source_t::generator_source_t(const size_t length, const generator_t& generator) : generator(generator), bitLength(length), position(0) {
+	return;
+}
+
+size_t generator_source_t::length() const {
+	return bitLength;
+}
+
+size_t generator_source_t::read(uint64_t* words, const size_t count) {
+	const size_t result = std::min(count, wordsOf(bitLength) - position);
+	if (result != 0) generator(words, position, result);
+	position += result;
+	return result;
+}
+
+
+
+//   ######  #### ##    ## ##    ##  ######
+//  ##    ##  ##  ###   ## ##   ##  ##    ##
+//  ##        ##  ####  ## ##  ##   ##
+//   ######   ##  ## ## ## #####     ######
+//        ##  ##  ##  #### ##  ##         ##
+//  ##    ##  ##  ##   ### ##   ##  ##    ##
+//   ######  #### ##    ## ##    ##  ######
+
+bitset_collector_t::bitset_collector_t() : words(), bitLength(0) {
+	return;
+}
+
+void bitset_collector_t::write(const uint64_t* words, const size_t count) {
+	this->words.insert(this->words.end(), words, words + count);
+}
+
+void bitset_collector_t::finish(const size_t length) {
+	bitLength = length;
+}
+
+bitset_t bitset_collector_t::release() {
+	const size_t length = bitLength;
+	bitLength = 0;
+	return bitset_t(std::move(words), length);
+}
+
+file_sink_t::file_sink_t(const std::string& path) : file(), path(path), temporary(path + ".tmp") {
+	// Room for the header, which is only known once all the words have been written
+	const bitset_file_header_t header = {};
+	file.open(temporary.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file || !file.write((const char*)&header, sizeof(header))) {
+		std::remove(temporary.c_str());
+		throw std::runtime_error("file_sink_t::file_sink_t: cannot create " + temporary);
+	}
+	return;
+}
+
+file_sink_t::~file_sink_t() {
+	if (!temporary.empty()) {
+		file.close();
+		std::remove(temporary.c_str());
+	}
+	return;
+}
+
+void file_sink_t::write(const uint64_t* words, const size_t count) {
+	if (!file.write((const char*)words, (std::streamsize)(count * sizeof(uint64_t))))
+		throw std::runtime_error("file_sink_t::write: cannot write " + temporary);
+}
+
+void file_sink_t::finish(const size_t length) {
+	bitset_file_header_t header = {};
+	header.magic = bitset_file_header_t::magicValue;
+	header.byteOrder = bitset_file_header_t::byteOrderValue;
+	header.version = bitset_file_header_t::currentVersion;
+	header.bitLength = length;
+	header.payloadOffset = sizeof(bitset_file_header_t);
+	file.seekp(0);
+	file.write((const char*)&header, sizeof(header));
+	file.close();
+	if (!file)
+		throw std::runtime_error("file_sink_t::finish: cannot write " + temporary);
+	if (std::rename(temporary.c_str(), path.c_str()) != 0)
+		throw std::runtime_error("file_sink_t::finish: cannot replace " + path);
+	temporary.clear();
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+bitset_stream_t::bitset_stream_t(const size_t chunkWords) : chunkWords(chunkWords) {
+	if (chunkWords == 0)
+		throw std::invalid_argument("bitset_stream_t::bitset_stream_t: chunks must hold at least one word");
+	return;
+}
+
+
+
+//   ######  ######## ########  ########    ###    ##     ##
+//  ##    ##    ##    ##     ## ##         ## ##   ###   ###
+//  ##          ##    ##     ## ##        ##   ##  #### ####
+//   ######     ##    ########  ######   ##     ## ## ### ##
+//        ##    ##    ##   ##   ##       ######### ##     ##
+//  ##    ##    ##    ##    ##  ##       ##     ## ##     ##
+//   ######     ##    ##     ## ######## ##     ## ##     ##
+
+size_t bitset_stream_t::process(const std::vector<bitset_source_t*>& sources, bitset_sink_t* sink, const std::function<void(uint64_t* const* chunks, const size_t words)>& step) const {
+	const size_t length = sources[0]->length();
+	for (size_t index = 1; index < sources.size(); ++index)
+		if (sources[index]->length() != length)
+			throw std::invalid_argument("bitset_stream_t: sources differ in length");
+	const size_t totalWords = wordsOf(length), count = sources.size();
+
+	// Two slots of one chunk per source: one is read in the background while the other is computed
+	const size_t stride = std::min(chunkWords, totalWords);
+	std::vector<uint64_t> storage(2 * count * stride);
+	std::vector<uint64_t*> chunks(2 * count);
+	for (size_t index = 0; index < chunks.size(); ++index)
+		chunks[index] = storage.data() + index * stride;
+	const std::function<size_t(size_t, size_t)> fetch = [&](const size_t slot, const size_t first) {
+		const size_t words = std::min(stride, totalWords - first);
+		for (size_t index = 0; index < count; ++index)
+			if (sources[index]->read(chunks[slot * count + index], words) != words)
+				throw std::runtime_error("bitset_stream_t: source ended early");
+		return words;
+	};
+
+	const bitset_kernels_t& kernels = bitsetKernels();
+	size_t total = 0;
+	std::future<size_t> pending;
+	if (totalWords != 0) pending = std::async(std::launch::async, fetch, 0, 0);
+	for (size_t first = 0, slot = 0; first < totalWords; slot ^= 1) {
+		const size_t words = pending.get();
+		if (first + words < totalWords) pending = std::async(std::launch::async, fetch, slot ^ 1, first + words);
+		uint64_t* const* current = chunks.data() + slot * count;
+		step(current, words);
+		first += words;
+		if (first == totalWords) current[0][words - 1] &= bitsetTailMask(length, totalWords - 1);
+		total += kernels.popcountWords(current[0], words);
+		if (sink != nullptr) sink->write(current[0], words);
+	}
+	if (sink != nullptr) sink->finish(length);
+	return total;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t bitset_stream_t::combine(bitset_source_t& left, bitset_source_t& right, const operation_t operation, bitset_sink_t* sink) const {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	void (*kernel)(uint64_t*, const uint64_t*, const size_t) = kernels.andWords;
+	switch (operation) {
+		case operation_t::xorWords: kernel = kernels.xorWords; break;
+		case operation_t::orWords: kernel = kernels.orWords; break;
+		case operation_t::nandWords: kernel = kernels.nandWords; break;
+		case operation_t::norWords: kernel = kernels.norWords; break;
+		default: break;
+	}
+	const bool invertRight = operation == operation_t::andNotWords;
+	std::vector<bitset_source_t*> sources = {&left, &right};
+	return process(sources, sink, [&](uint64_t* const* chunks, const size_t words) {
+		if (invertRight) kernels.invertWords(chunks[1], words);
+		kernel(chunks[0], chunks[1], words);
+	});
+}
+
+size_t bitset_stream_t::invert(bitset_source_t& source, bitset_sink_t* sink) const {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	std::vector<bitset_source_t*> sources = {&source};
+	return process(sources, sink, [&](uint64_t* const* chunks, const size_t words) {
+		kernels.invertWords(chunks[0], words);
+	});
+}
+
+size_t bitset_stream_t::count(bitset_source_t& source) const {
+	std::vector<bitset_source_t*> sources = {&source};
+	return process(sources, nullptr, [](uint64_t* const*, const size_t) {});
+}
+
+size_t bitset_stream_t::hammingDistance(bitset_source_t& left, bitset_source_t& right) const {
+	return combine(left, right, operation_t::xorWords);
+}
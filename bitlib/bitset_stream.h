@@ -0,0 +1,315 @@
+/**
+ * @file bitset_stream.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `bitset_stream_t` class, its sources and sinks
+ */
+
+#ifndef bitlib___bitset_stream_h
+#define bitlib___bitset_stream_h
+
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_view.h"
+
+/**
+ * @brief Source of the words of a bitset read sequentially
+ *
+ * @details Words are laid out as in `bitset_t` (see bitset_t::data()); the bits of the last word past length() may hold anything, they are ignored.
+ */
+class bitset_source_t {
+public:
+	virtual ~bitset_source_t() {
+		return;
+	}
+
+	/**
+	 * @brief Returns length of the bitset, in bits
+	 */
+	virtual size_t length() const = 0;
+
+	/**
+	 * @brief Reads the next @p count words into @p words
+	 *
+	 * @return Number of words read, less than @p count only at the end of the bitset.
+	 *
+	 * @throw std::runtime_error If the words cannot be read.
+	 */
+	virtual size_t read(uint64_t* words, const size_t count) = 0;
+};
+
+/**
+ * @brief Destination of the words of a bitset written sequentially
+ */
+class bitset_sink_t {
+public:
+	virtual ~bitset_sink_t() {
+		return;
+	}
+
+	/**
+	 * @brief Appends @p count words at @p words
+	 *
+	 * @throw std::runtime_error If the words cannot be written.
+	 */
+	virtual void write(const uint64_t* words, const size_t count) = 0;
+
+	/**
+	 * @brief Completes the bitset of @p length bits, after all of its words have been written
+	 */
+	virtual void finish(const size_t length) = 0;
+};
+
+
+
+//   ######   #######  ##     ## ########   ######  ########  ######
+//  ##    ## ##     ## ##     ## ##     ## ##    ## ##       ##    ##
+//  ##       ##     ## ##     ## ##     ## ##       ##       ##
+//   ######  ##     ## ##     ## ########  ##       ######    ######
+//        ## ##     ## ##     ## ##   ##   ##       ##             ##
+//  ##    ## ##     ## ##     ## ##    ##  ##    ## ##       ##    ##
+//   ######   #######   #######  ##     ##  ######  ########  ######
+
+/**
+ * @brief Source reading a bitset or a view in memory
+ *
+ * Example usage:
+ * @code
+ *	view_source_t source(someBitset);
+ * @endcode
+ */
+class view_source_t : public bitset_source_t {
+private:
+	bitset_view_t bits;
+	size_t position;
+public:
+	explicit view_source_t(const bitset_view_t& bits);
+	size_t length() const override;
+	size_t read(uint64_t* words, const size_t count) override;
+};
+
+/**
+ * @brief Source reading a bitset file (see mapped_bitset_t::write()) sequentially, without mapping it
+ *
+ * @throw std::runtime_error If the file cannot be opened or is not a bitset file of this version and byte order.
+ *
+ * Example usage:
+ * @code
+ *	file_source_t deny("deny.bits");
+ * @endcode
+ */
+class file_source_t : public bitset_source_t {
+private:
+	std::ifstream file;
+	size_t bitLength;
+	size_t remaining;
+public:
+	explicit file_source_t(const std::string& path);
+	size_t length() const override;
+	size_t read(uint64_t* words, const size_t count) override;
+};
+
+/**
+ * @brief Source producing the words of a bitset with a function
+ *
+ * @details @c generator is called with the destination, the index of the first word to produce and the number of words; it is called from the prefetch thread of the stream.
+ *
+ * Example usage:
+ * @code
+ *	// Every third bit of a 200-billion-bit bitset, never materialized
+ *	generator_source_t thirds(200000000000ULL, [](uint64_t* words, size_t first, size_t count) {
+ *		for (size_t index = 0; index < count; ++index)
+ *			words[index] = 0x9249249249249249ULL >> ((first + index) * 64 % 3);
+ *	});
+ * @endcode
+ */
+class generator_source_t : public bitset_source_t {
+public:
+	typedef std::function<void(uint64_t* words, const size_t first, const size_t count)> generator_t;
+private:
+	generator_t generator;
+	size_t bitLength;
+	size_t position;
+public:
+	generator_source_t(const size_t length, const generator_t& generator);
+	size_t length() const override;
+	size_t read(uint64_t* words, const size_t count) override;
+};
+
+
+
+//   ######  #### ##    ## ##    ##  ######
+//  ##    ##  ##  ###   ## ##   ##  ##    ##
+//  ##        ##  ####  ## ##  ##   ##
+//   ######   ##  ## ## ## #####     ######
+//        ##  ##  ##  #### ##  ##        ##
+//  ##    ##  ##  ##   ### ##   ##  ##    ##
+//   ######  #### ##    ## ##    ##  ######
+
+/**
+ * @brief Sink collecting the bitset in memory
+ *
+ * Example usage:
+ * @code
+ *	bitset_collector_t collector;
+ *	stream.combine(left, right, bitset_stream_t::operation_t::andWords, &collector);
+ *	bitset_t result = collector.release();
+ * @endcode
+ */
+class bitset_collector_t : public bitset_sink_t {
+private:
+	bitset_t::word_vector_t words;
+	size_t bitLength;
+public:
+	bitset_collector_t();
+	void write(const uint64_t* words, const size_t count) override;
+	void finish(const size_t length) override;
+
+	/**
+	 * @brief Returns the collected bitset, leaving the collector empty
+	 */
+	bitset_t release();
+};
+
+/**
+ * @brief Sink writing a bitset file (see mapped_bitset_t), readable by file_source_t and mapped_bitset_t
+ *
+ * @details The file is written aside as `path + ".tmp"` and renamed over @p path by finish(), which also writes the header once the length is known; a sink destroyed before finish() removes its partial file. The file has no checksum and no rank index.
+ *
+ * @throw std::runtime_error If the file cannot be created.
+ *
+ * Example usage:
+ * @code
+ *	file_sink_t combined("combined.bits");
+ * @endcode
+ */
+class file_sink_t : public bitset_sink_t {
+private:
+	std::ofstream file;
+	std::string path;
+	std::string temporary;
+public:
+	explicit file_sink_t(const std::string& path);
+	~file_sink_t();
+	void write(const uint64_t* words, const size_t count) override;
+	void finish(const size_t length) override;
+};
+
+
+
+//   ######  ######## ########  ########    ###    ##     ##
+//  ##    ##    ##    ##     ## ##         ## ##   ###   ###
+//  ##          ##    ##     ## ##        ##   ##  #### ####
+//   ######     ##    ########  ######   ##     ## ## ### ##
+//        ##    ##    ##   ##   ##       ######### ##     ##
+//  ##    ##    ##    ##    ##  ##       ##     ## ##     ##
+//   ######     ##    ##     ## ######## ##     ## ##     ##
+
+/**
+ * @brief Applies bitset operations chunk by chunk to bitsets which do not fit in memory
+ *
+ * @details Reads the operands from @ref bitset_source_t objects a chunk of words at a time, applies the operation with the kernels selected by bitsetKernels(), counts the set bits of the result, and passes the result to an optional @ref bitset_sink_t. Two sets of chunk buffers are used in turn: while a chunk is computed and written, the next one is read by a background task, so that reading overlaps the computation. Memory use is thus bounded by `2 * sources * chunkWords` words, regardless of the length of the bitsets.
+ *
+ * @warning Sources of one operation <b>must be of equal length</b>. A source is read from the prefetch thread, and a sink is written from the calling thread.
+ *
+ * Example usage:
+ * @code
+ *	// Combine two 200 GB masks on disk into a third, with 2 x 2 MiB of buffers
+ *	bitset_stream_t stream(1 << 17);
+ *	file_source_t allow("allow.bits"), deny("deny.bits");
+ *	file_sink_t result("effective.bits");
+ *	size_t permitted = stream.combine(allow, deny, bitset_stream_t::operation_t::andNotWords, &result);
+ * @endcode
+ */
+class bitset_stream_t {
+public:
+	/**
+	 * @brief Binary operation applied by combine()
+	 */
+	enum class operation_t {
+		xorWords,	///< Exclusive OR
+		andWords,	///< Conjunction
+		orWords,	///< Disjunction
+		nandWords,	///< Inverted conjunction
+		norWords,	///< Inverted disjunction
+		andNotWords	///< Conjunction with the inverted right operand
+	};
+private:
+	/**
+	 * @brief Number of words of every chunk buffer
+	 */
+	size_t chunkWords;
+
+	/**
+	 * @brief Streams @p sources chunk by chunk, reduces every chunk with @p step into its first buffer, and counts and writes the result
+	 */
+	size_t process(const std::vector<bitset_source_t*>& sources, bitset_sink_t* sink, const std::function<void(uint64_t* const* chunks, const size_t words)>& step) const;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Stream constructor
+	 *
+	 * @param [in] chunkWords Number of words per chunk buffer; larger chunks reduce the per-chunk overhead, smaller ones the memory use.
+	 *
+	 * @throw std::invalid_argument If @p chunkWords is zero.
+	 */
+	explicit bitset_stream_t(const size_t chunkWords = (size_t)1 << 17);
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Combines @p left and @p right with @p operation
+	 *
+	 * @param [in,out] left Source of the first operand.
+	 * @param [in,out] right Source of the second operand.
+	 * @param [in] operation Operation to apply to every pair of corresponding bits.
+	 * @param [in,out] sink Destination of the result, or `nullptr` to only count it.
+	 *
+	 * @return Number of set bits of the result.
+	 *
+	 * @throw std::invalid_argument If the sources differ in length.
+	 * @throw std::runtime_error If a source ends early, or reading or writing fails.
+	 */
+	size_t combine(bitset_source_t& left, bitset_source_t& right, const operation_t operation, bitset_sink_t* sink = nullptr) const;
+
+	/**
+	 * @brief Inverts @p source
+	 *
+	 * @return Number of set bits of the result.
+	 */
+	size_t invert(bitset_source_t& source, bitset_sink_t* sink = nullptr) const;
+
+	/**
+	 * @brief Returns the number of set bits of @p source
+	 */
+	size_t count(bitset_source_t& source) const;
+
+	/**
+	 * @brief Returns the number of bits at which @p left and @p right differ, see hammingDistance()
+	 *
+	 * @throw std::invalid_argument If the sources differ in length.
+	 */
+	size_t hammingDistance(bitset_source_t& left, bitset_source_t& right) const;
+};
+
+#endif
@@ -1,10 +1,14 @@
 #include <iostream>
 #include <algorithm>
-#include <numeric>
 #include <functional>
+#include <stdexcept>
 
 #include "bitset_type.h"
-#include "bit_c11_operators.h"
+#include "bitset_kernels.h"
+#include "bitset_parallel.h"
+#include "bitset_codec.h"
+
+const size_t bitset_t::npos;
 
 
 //   ######  ##    ##  ######  ######## ########   ######
@@ -15,31 +19,78 @@
 //  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
 //   ######  ##    ##  ######     ##    ##     ##  ######
 
-bitset_t::bitset_t() : set() {
+bitset_t::bitset_t() : words(), bitLength(0) {
+	return;
+}
+
+bitset_t::bitset_t(const allocator_type& allocator) : words(allocator), bitLength(0) {
+	return;
+}
+
+bitset_t::bitset_t(const std::initializer_list<bit_t> bits) : words(), bitLength(0) {
+	pack(bits.begin(), bits.size());
+	return;
+}
+
+bitset_t::bitset_t(const std::initializer_list<bool> bits) : words(), bitLength(0) {
+	pack(bits.begin(), bits.size());
+	return;
+}
+
+bitset_t::bitset_t(const bitset_t& bits) : words(bits.words), bitLength(bits.bitLength) {
+	return;
+}
+
+bitset_t::bitset_t(const bitset_t& bits, const allocator_type& allocator) : words(allocator), bitLength(bits.bitLength) {
+	words.assign(bits.words.begin(), bits.words.end());
+	return;
+}
+
+bitset_t::bitset_t(bitset_t&& bits) noexcept : words(std::move(bits.words)), bitLength(bits.bitLength) {
+	bits.words.clear();
+	bits.bitLength = 0;
 	return;
 }
 
-bitset_t::bitset_t(const std::initializer_list<bit_t> bits) : set(bits) {
+bitset_t::bitset_t(const std::vector<bit_t>& bits) : words(), bitLength(0) {
+	pack(bits.begin(), bits.size());
 	return;
 }
 
-bitset_t::bitset_t(const std::initializer_list<bool> bits) : set(bits.begin(), bits.end()) {
+bitset_t::bitset_t(const std::vector<bool>& bits) : words(), bitLength(0) {
+	pack(bits.begin(), bits.size());
 	return;
 }
 
-bitset_t::bitset_t(const bitset_t& bits) : set(bits.set) {
+bitset_t::bitset_t(const bool* head, const size_t length) : words(), bitLength(0) {
+	pack(head, length);
 	return;
 }
 
-bitset_t::bitset_t(const std::vector<bit_t>& bits) : set(bits) {
+bitset_t::bitset_t(word_vector_t&& storage, const size_t length) : words(), bitLength(0) {
+	if (storage.size() != wordsFor(length))
+		throw std::invalid_argument("bitset_t::bitset_t: storage does not match the length");
+	words.adopt(std::move(storage));
+	bitLength = length;
+	clearTail();
 	return;
 }
 
-bitset_t::bitset_t(const std::vector<bool>& bits) : set(bits.begin(), bits.end()) {
+bitset_t::bitset_t(const std::vector<word_t>& storage, const size_t length) : words(), bitLength(0) {
+	if (storage.size() != wordsFor(length))
+		throw std::invalid_argument("bitset_t::bitset_t: storage does not match the length");
+	words.assign(storage.data(), storage.data() + storage.size());
+	bitLength = length;
+	clearTail();
 	return;
 }
 
-bitset_t::bitset_t(const bool* head, const size_t length) : set(head, head + length) {
+template <class InputIt>
+void bitset_t::pack(InputIt head, const size_t length) {
+	words.assign(wordsFor(length), 0);
+	bitLength = length;
+	for (size_t index = 0; index < length; ++index, ++head)
+		if ((bool)bit_t(*head)) words[index / wordBits] |= bitMask(index);
 	return;
 }
 
@@ -53,8 +104,8 @@ bitset_t::bitset_t(const bool* head, const size_t length) : set(head, head + len
 //  ##    ## ##     ## ##    ##    ##
 //   ######  ##     ##  ######     ##
 
-bitset_t::operator std::vector<bit_t>() {
-	return set;
+bitset_t::operator std::vector<bit_t>() const {
+	return std::vector<bit_t>(begin(), end());
 }
 
 
@@ -67,33 +118,85 @@ bitset_t::operator std::vector<bit_t>() {
 //   ##     ##    ##       ##    ##     ##    ##   ### ##    ##
 //  ####    ##    ######## ##     ##    ##    ##    ##  ######
 
-std::vector<bit_t>::iterator bitset_t::begin() {
-	return set.begin();
+bitset_t::iterator bitset_t::begin() {
+	return iterator(words.data(), 0);
 }
 
-std::vector<bit_t>::const_iterator bitset_t::begin() const {
-	return set.begin();
+bitset_t::const_iterator bitset_t::begin() const {
+	return const_iterator(words.data(), 0);
 }
 
-std::vector<bit_t>::iterator bitset_t::end() {
-	return set.end();
+bitset_t::iterator bitset_t::end() {
+	return iterator(words.data(), bitLength);
 }
 
-std::vector<bit_t>::const_iterator bitset_t::end() const {
-	return set.end();
+bitset_t::const_iterator bitset_t::end() const {
+	return const_iterator(words.data(), bitLength);
+}
+
+bitset_t::position_range bitset_t::positions() const {
+	return position_range(words.data(), words.size());
 }
 
 size_t bitset_t::length() const {
-	return set.size();
+	return bitLength;
 }
 
 void bitset_t::resize(const size_t length) {
-	set.resize(length);
+	resize(length, bit_t(false));
 	return;
 }
 
 void bitset_t::resize(const size_t length, const bit_t& value) {
-	set.resize(length, value);
+	const size_t previous = bitLength;
+	words.resize(wordsFor(length), 0);
+	bitLength = length;
+	if (length > previous)
+		fillRange(previous, length, value == bit_t(true));
+	clearTail();
+	return;
+}
+
+const bitset_t::word_t* bitset_t::data() const {
+	return words.data();
+}
+
+size_t bitset_t::wordCount() const {
+	return words.size();
+}
+
+bitset_t::allocator_type bitset_t::allocator() const {
+	return words.allocator();
+}
+
+void bitset_t::swap(bitset_t& other) noexcept {
+	words.swap(other.words);
+	std::swap(bitLength, other.bitLength);
+}
+
+void swap(bitset_t& left, bitset_t& right) noexcept {
+	left.swap(right);
+}
+
+void bitset_t::clearTail() {
+	if (bitLength % wordBits)
+		words.back() &= ~(word_t)0 >> (wordBits - bitLength % wordBits);
+	return;
+}
+
+void bitset_t::fillRange(const size_t first, const size_t last, const bool value) {
+	if (first >= last) return;
+	const size_t head = first / wordBits, tail = (last - 1) / wordBits;
+	const word_t headMask = ~(word_t)0 << (first % wordBits);
+	const word_t tailMask = ~(word_t)0 >> (wordBits - 1 - (last - 1) % wordBits);
+	if (head == tail) {
+		const word_t mask = headMask & tailMask;
+		words[head] = value ? (words[head] | mask) : (words[head] & ~mask);
+		return;
+	}
+	words[head] = value ? (words[head] | headMask) : (words[head] & ~headMask);
+	std::fill(words.begin() + head + 1, words.begin() + tail, value ? ~(word_t)0 : (word_t)0);
+	words[tail] = value ? (words[tail] | tailMask) : (words[tail] & ~tailMask);
 	return;
 }
 
@@ -107,33 +210,107 @@ void bitset_t::resize(const size_t length, const bit_t& value) {
 //  ########  #######   ######   ####  ######
 
 void bitset_t::setAll() {
-	fill(set.begin(), set.end(), true);
+	word_t* head = words.data();
+	parallelForWords(head, words.size(), [=](const size_t first, const size_t last) {
+		bitsetKernels().fillWords(head + first, last - first, ~(word_t)0);
+		return (size_t)0;
+	});
+	clearTail();
 	return;
 }
 
 void bitset_t::resetAll() {
-	fill(set.begin(), set.end(), false);
+	word_t* head = words.data();
+	parallelForWords(head, words.size(), [=](const size_t first, const size_t last) {
+		bitsetKernels().fillWords(head + first, last - first, (word_t)0);
+		return (size_t)0;
+	});
 	return;
 }
 
 void bitset_t::fillWith(const bit_t value) {
-	fill(set.begin(), set.end(), value);
+	if (value == bit_t(true))
+		setAll();
+	else
+		resetAll();
 	return;
 }
 
 void bitset_t::invert() {
-	for (bit_t& bit : set)
-		bit.invert();
+	word_t* head = words.data();
+	parallelForWords(head, words.size(), [=](const size_t first, const size_t last) {
+		bitsetKernels().invertWords(head + first, last - first);
+		return (size_t)0;
+	});
+	clearTail();
 	return;
 }
 
-size_t hammingDistance(const bitset_t left, const bitset_t right) {
-	return std::inner_product(left.begin(),
-					  left.end(),
-					  right.begin(),
-					  0,
-					  std::plus<size_t>(),
-					  bitwise_nequal());
+size_t bitset_t::count() const {
+	const word_t* head = words.data();
+	return parallelForWords(nullptr, words.size(), [=](const size_t first, const size_t last) {
+		return bitsetKernels().popcountWords(head + first, last - first);
+	});
+}
+
+bool bitset_t::any() const {
+	return std::any_of(words.begin(), words.end(), [](const word_t word) { return word != 0; });
+}
+
+size_t hammingDistance(const bitset_t& left, const bitset_t& right) {
+	const bitset_t::word_t* leftHead = left.words.data();
+	const bitset_t::word_t* rightHead = right.words.data();
+	return parallelForWords(nullptr, std::min(left.words.size(), right.words.size()), [=](const size_t first, const size_t last) {
+		return bitsetKernels().xorPopcountWords(leftHead + first, rightHead + first, last - first);
+	});
+}
+
+
+
+//   ######  ########    ###    ########   ######  ##     ##
+//  ##    ## ##         ## ##   ##     ## ##    ## ##     ##
+//  ##       ##        ##   ##  ##     ## ##       ##     ##
+//   ######  ######   ##     ## ########  ##       #########
+//        ## ##       ######### ##   ##   ##       ##     ##
+//  ##    ## ##       ##     ## ##    ##  ##    ## ##     ##
+//   ######  ######## ##     ## ##     ##  ######  ##     ##
+
+size_t bitset_t::findFirst() const {
+	for (size_t word = 0; word < words.size(); ++word)
+		if (words[word] != 0)
+			return word * wordBits + trailingZeros(words[word]);
+	return npos;
+}
+
+size_t bitset_t::findNext(const size_t index) const {
+	if (index >= bitLength || index + 1 == bitLength) return npos;
+	size_t word = (index + 1) / wordBits;
+	word_t rest = words[word] & (~(word_t)0 << ((index + 1) % wordBits));
+	while (rest == 0) {
+		if (++word == words.size()) return npos;
+		rest = words[word];
+	}
+	return word * wordBits + trailingZeros(rest);
+}
+
+size_t bitset_t::findLast() const {
+	for (size_t word = words.size(); word-- > 0; )
+		if (words[word] != 0)
+			return word * wordBits + (wordBits - 1 - leadingZeros(words[word]));
+	return npos;
+}
+
+size_t bitset_t::findPrev(const size_t index) const {
+	if (index >= bitLength) return findLast();
+	if (index == 0) return npos;
+	size_t word = (index - 1) / wordBits;
+	const size_t offset = (index - 1) % wordBits;
+	word_t rest = words[word] & ((offset == wordBits - 1) ? ~(word_t)0 : (((word_t)1 << (offset + 1)) - 1));
+	while (rest == 0) {
+		if (word-- == 0) return npos;
+		rest = words[word];
+	}
+	return word * wordBits + (wordBits - 1 - leadingZeros(rest));
 }
 
 
@@ -146,46 +323,126 @@ size_t hammingDistance(const bitset_t left, const bitset_t right) {
 //  ##    ## ##     ##  ##  ##          ##     ##  ##   ### ##    ##
 //   ######  ##     ## #### ##          ##    #### ##    ##  ######
 
-void bitset_t::rotateLeft(const size_t shift) {
-	std::rotate(set.begin(), set.begin() + shift, set.end());
+// Copies count bits from offset on out of the words at head into the words at target, with the bits past count reset
+static void extractBits(const bitset_t::word_t* head, const size_t size, const size_t offset, const size_t count, bitset_t::word_t* target) {
+	const size_t first = offset / bitset_t::wordBits, length = (count + bitset_t::wordBits - 1) / bitset_t::wordBits;
+	const unsigned bitShift = (unsigned)(offset % bitset_t::wordBits);
+	for (size_t index = 0; index < length; ++index) {
+		bitset_t::word_t word = head[first + index] >> bitShift;
+		if (bitShift != 0 && first + index + 1 < size) word |= head[first + index + 1] << (bitset_t::wordBits - bitShift);
+		target[index] = word;
+	}
+	if (count % bitset_t::wordBits != 0) target[length - 1] &= ((bitset_t::word_t)1 << (count % bitset_t::wordBits)) - 1;
 }
 
-void bitset_t::rotateRight(const size_t shift) {
-	std::rotate(set.begin(), set.end() - shift, set.end());
+// Sets the bits of the words at source into the words at head from offset on, where the bits were reset
+static void insertBits(bitset_t::word_t* head, const size_t size, const size_t offset, const bitset_t::word_t* source, const size_t length) {
+	const size_t first = offset / bitset_t::wordBits;
+	const unsigned bitShift = (unsigned)(offset % bitset_t::wordBits);
+	for (size_t index = 0; index < length; ++index) {
+		head[first + index] |= source[index] << bitShift;
+		if (bitShift != 0 && first + index + 1 < size) head[first + index + 1] |= source[index] >> (bitset_t::wordBits - bitShift);
+	}
 }
 
-void bitset_t::shiftLeft(const size_t shift) {
-	reverse(set.begin(), set.end());
-	reverse(set.begin(), set.end() - shift);
-	fill(set.end() - shift, set.end(), false);
+void bitset_t::rotateLeft(const size_t shift) {
+	if (bitLength == 0 || shift % bitLength == 0) return;
+	const size_t rotation = shift % bitLength;
+	// The shorter way round keeps the bits which wrap, the only ones set aside, below half of the bitset
+	if (rotation > bitLength / 2) {
+		rotateRight(bitLength - rotation);
+		return;
+	}
+	storage_t wrapped(words.allocator());
+	wrapped.resize((rotation + wordBits - 1) / wordBits);
+	extractBits(words.data(), words.size(), 0, rotation, wrapped.data());
+	shiftLeft(rotation);
+	insertBits(words.data(), words.size(), bitLength - rotation, wrapped.data(), wrapped.size());
 }
 
-void bitset_t::shiftRight(const size_t shift) {
-	reverse(set.begin(), set.end());
-	fill(set.begin(), set.begin() + shift, false);
-	reverse(set.begin() + shift, set.end());
+void bitset_t::rotateRight(const size_t shift) {
+	if (bitLength == 0 || shift % bitLength == 0) return;
+	const size_t rotation = shift % bitLength;
+	if (rotation > bitLength / 2) {
+		rotateLeft(bitLength - rotation);
+		return;
+	}
+	storage_t wrapped(words.allocator());
+	wrapped.resize((rotation + wordBits - 1) / wordBits);
+	extractBits(words.data(), words.size(), bitLength - rotation, rotation, wrapped.data());
+	shiftRight(rotation);
+	insertBits(words.data(), words.size(), 0, wrapped.data(), wrapped.size());
 }
 
-
-
-//  ##     ## ##    ##    ###    ########  ##    ##
-//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
-//  ##     ## ####  ##  ##   ##  ##     ##   ####
-//  ##     ## ## ## ## ##     ## ########     ##
-//  ##     ## ##  #### ######### ##   ##      ##
-//  ##     ## ##   ### ##     ## ##    ##     ##
-//   #######  ##    ## ##     ## ##     ##    ##
-
-bitset_t bitset_t::operator!() const {
-	bitset_t bits = *this;
-	bits.invert();
-	return bits;
+void bitset_t::shiftLeft(const size_t shift) {
+	if (shift == 0) return;
+	if (shift >= bitLength) {
+		std::fill(words.begin(), words.end(), 0);
+		return;
+	}
+	// Bit i + shift moves to i, that is towards the least significant end of the words
+	const size_t wordShift = shift / wordBits, kept = words.size() - wordShift;
+	const unsigned bitShift = (unsigned)(shift % wordBits);
+	word_t* head = words.data();
+	if (splitsAcrossThreads(kept)) {
+		// Ranges of an in-place shift would read words another thread has already moved, thus the words are moved aside
+		storage_t moved(words.allocator());
+		moved.resize(words.size());
+		word_t* target = moved.data();
+		parallelForWords(target, kept - 1, [=](const size_t first, const size_t last) {
+			if (bitShift == 0)
+				std::copy(head + wordShift + first, head + wordShift + last, target + first);
+			else
+				bitsetKernels().funnelDownWords(target + first, head + wordShift + first, last - first, bitShift);
+			return (size_t)0;
+		});
+		target[kept - 1] = head[words.size() - 1] >> bitShift;
+		words.swap(moved);
+		return;
+	}
+	if (bitShift == 0) {
+		std::copy(head + wordShift, head + words.size(), head);
+	} else {
+		bitsetKernels().funnelDownWords(head, head + wordShift, kept - 1, bitShift);
+		head[kept - 1] = head[words.size() - 1] >> bitShift;
+	}
+	std::fill(head + kept, head + words.size(), 0);
 }
 
-bitset_t bitset_t::operator~() const {
-	bitset_t bits = *this;
-	bits.invert();
-	return bits;
+void bitset_t::shiftRight(const size_t shift) {
+	if (shift == 0) return;
+	if (shift >= bitLength) {
+		std::fill(words.begin(), words.end(), 0);
+		return;
+	}
+	// Bit i moves to i + shift, that is towards the most significant end of the words
+	const size_t wordShift = shift / wordBits, kept = words.size() - wordShift;
+	const unsigned bitShift = (unsigned)(shift % wordBits);
+	word_t* head = words.data();
+	if (splitsAcrossThreads(kept)) {
+		storage_t moved(words.allocator());
+		moved.resize(words.size());
+		word_t* target = moved.data() + wordShift;
+		parallelForWords(target + 1, kept - 1, [=](const size_t first, const size_t last) {
+			if (bitShift == 0)
+				std::copy(head + 1 + first, head + 1 + last, target + 1 + first);
+			else
+				bitsetKernels().funnelUpWords(target + 1 + first, head + 1 + first, last - first, bitShift);
+			return (size_t)0;
+		});
+		target[0] = head[0] << bitShift;
+		words.swap(moved);
+		clearTail();
+		return;
+	}
+	if (bitShift == 0) {
+		std::copy_backward(head, head + kept, head + words.size());
+	} else {
+		bitsetKernels().funnelUpWords(head + wordShift + 1, head + 1, kept - 1, bitShift);
+		head[wordShift] = head[0] << bitShift;
+	}
+	std::fill(head, head + wordShift, 0);
+	clearTail();
 }
 
 
@@ -198,43 +455,32 @@ bitset_t bitset_t::operator~() const {
 //  ##     ##  ##  ##   ### ##     ## ##    ##     ##
 //  ########  #### ##    ## ##     ## ##     ##    ##
 
-bitset_t bitset_t::operator^(const bitset_t& other) const {
-	bitset_t temp = *this;
-	std::transform(temp.set.begin(), temp.set.end(), other.set.begin(), temp.set.begin(), bitwise_xor());
-	return temp;
-}
-
-bitset_t bitset_t::operator&(const bitset_t& other) const {
-	bitset_t temp = *this;
-	std::transform(temp.set.begin(), temp.set.end(), other.set.begin(), temp.set.begin(), bitwise_and());
-	return temp;
-}
-
-bitset_t bitset_t::operator|(const bitset_t& other) const {
-	bitset_t temp = *this;
-	std::transform(temp.set.begin(), temp.set.end(), other.set.begin(), temp.set.begin(), bitwise_or());
-	return temp;
+void bitset_t::transformWords(const bitset_t& other, void (*kernel)(word_t*, const word_t*, const size_t)) {
+	word_t* head = words.data();
+	const word_t* source = other.words.data();
+	parallelForWords(head, std::min(words.size(), other.words.size()), [=](const size_t first, const size_t last) {
+		kernel(head + first, source + first, last - first);
+		return (size_t)0;
+	});
+	clearTail();
+	return;
 }
 
-bitset_t nand(bitset_t& left, bitset_t& right) {
-	bitset_t temp;
-	std::transform(left.begin(), left.end(), right.begin(), temp.begin(), bitwise_nand());
+bitset_t nand(const bitset_t& left, const bitset_t& right) {
+	bitset_t temp = left;
+	temp.transformWords(right, bitsetKernels().nandWords);
 	return temp;
 }
 
-bitset_t nor(bitset_t& left, bitset_t& right) {
-	bitset_t temp;
-	std::transform(left.begin(), left.end(), right.begin(), temp.begin(), bitwise_nor());
+bitset_t nor(const bitset_t& left, const bitset_t& right) {
+	bitset_t temp = left;
+	temp.transformWords(right, bitsetKernels().norWords);
 	return temp;
 }
 
 bit_t bitset_t::operator*(const bitset_t& other) const {
-	return std::inner_product(this->begin(),
-					  this->end(),
-					  other.begin(),
-					  0,
-					  bitwise_and(),
-					  bitwise_nequal());
+	// Bits past the length of the shorter bitset are zero in its storage, thus contribute nothing
+	return bit_t(bitsetKernels().andParityWords(words.data(), other.words.data(), std::min(words.size(), other.words.size())));
 }
 
 
@@ -247,40 +493,57 @@ bit_t bitset_t::operator*(const bitset_t& other) const {
 //  ##     ## ##    ## ##    ## ##    ##  ##   ### ##     ## ##   ###    ##
 //  ##     ##  ######   ######   ######   ##    ## ##     ## ##    ##    ##
 
-bitset_t& bitset_t::operator=(const bitset_t other) {
-	set = other.set;
+bitset_t& bitset_t::operator=(const bitset_t& other) {
+	if (this == &other) return *this;
+	// Copies into the existing storage, reallocating only when it is too short
+	words.assign(other.words.begin(), other.words.end());
+	bitLength = other.bitLength;
+	return *this;
+}
+
+bitset_t& bitset_t::operator=(bitset_t&& other) noexcept {
+	if (this == &other) return *this;
+	words = std::move(other.words);
+	bitLength = other.bitLength;
+	other.words.clear();
+	other.bitLength = 0;
 	return *this;
 }
 
 bitset_t& bitset_t::operator^=(const bitset_t& other) {
-	std::transform(set.begin(), set.end(), other.set.begin(), set.begin(), bitwise_xor());
+	transformWords(other, bitsetKernels().xorWords);
 	return *this;
 }
 
 bitset_t& bitset_t::operator&=(const bitset_t& other) {
-	std::transform(set.begin(), set.end(), other.set.begin(), set.begin(), bitwise_and());
+	transformWords(other, bitsetKernels().andWords);
+	// Bits past the end of other are taken as reset, as by operator&()
+	if (other.words.size() < words.size())
+		bitsetKernels().fillWords(words.data() + other.words.size(), words.size() - other.words.size(), (word_t)0);
 	return *this;
 }
 
 bitset_t& bitset_t::operator|=(const bitset_t& other) {
-	std::transform(set.begin(), set.end(), other.set.begin(), set.begin(), bitwise_or());
+	transformWords(other, bitsetKernels().orWords);
 	return *this;
 }
 
-std::vector<bit_t>::reference bitset_t::operator[] (const size_t index) {
-	return set[index];
+bitset_t::reference bitset_t::operator[] (const size_t index) {
+	return reference(&words[index / wordBits], bitMask(index));
 }
 
-std::vector<bit_t>::const_reference bitset_t::operator[] (const size_t index) const {
-	return set[index];
+bitset_t::const_reference bitset_t::operator[] (const size_t index) const {
+	return bit_t((words[index / wordBits] & bitMask(index)) != 0);
 }
 
-std::vector<bit_t>::reference bitset_t::at(const size_t index) {
-	return set.at(index);
+bitset_t::reference bitset_t::at(const size_t index) {
+	if (index >= bitLength) throw std::out_of_range("bitset_t::at");
+	return (*this)[index];
 }
 
-std::vector<bit_t>::const_reference bitset_t::at(const size_t index) const {
-	return set.at(index);
+bitset_t::const_reference bitset_t::at(const size_t index) const {
+	if (index >= bitLength) throw std::out_of_range("bitset_t::at");
+	return (*this)[index];
 }
 
 
@@ -292,12 +555,12 @@ std::vector<bit_t>::const_reference bitset_t::at(const size_t index) const {
 //  ##    ## ##     ## ##     ## ##        ##    ##  ##    ## ##   ###
 //   ######   #######  ##     ## ##        ##     ##  ######  ##    ##
 
-bool bitset_t::operator== (bitset_t& other) {
-	return (hammingDistance(*this, other) == 0);
+bool bitset_t::operator== (const bitset_t& other) const {
+	return (bitLength == other.bitLength) && bitsetKernels().equalWords(words.data(), other.words.data(), words.size());
 }
 
-bool bitset_t::operator!= (bitset_t& other) {
-	return (hammingDistance(*this, other) != 0);
+bool bitset_t::operator!= (const bitset_t& other) const {
+	return !(*this == other);
 }
 
 
@@ -311,19 +574,25 @@ bool bitset_t::operator!= (bitset_t& other) {
 //  #### ##    ##    ##    ##     ## ##       ##     ##  ######  ########
 
 std::string bitset_t::toBinaryString() const {
-	return toBinaryString("");
+	return encodeBitset(*this);
 }
 
 std::string bitset_t::toBinaryString(const std::string delimiter) const {
-	std::string temp = "";
-	for (bit_t bit : set)
-		temp += bit.toBinaryString() + delimiter;
-	if (!delimiter.empty()) temp.pop_back();
+	if (delimiter.empty() || bitLength == 0) return encodeBitset(*this);
+	const std::string digits = encodeBitset(*this);
+	std::string temp;
+	temp.reserve(bitLength + (bitLength - 1) * delimiter.size());
+	temp += digits[0];
+	for (size_t index = 1; index < bitLength; ++index) {
+		temp += delimiter;
+		temp += digits[index];
+	}
 	return temp;
 }
 
 std::ostream& operator<<(std::ostream& os, const bitset_t& bits) {
-	return os << bits.toBinaryString();
+	writeBitset(os, bits);
+	return os;
 }
 
 
@@ -7,15 +7,32 @@
 #ifndef bitlib___bitset_type_h
 #define bitlib___bitset_type_h
 
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <string>
 #include <vector>
 #include "bit_type.h"
+#include "bitset_allocator.h"
+#include "bitset_kernels.h"
+
+/**
+ * @brief Number of bits a `bitset_t` stores within the object, without allocating; a multiple of 64, `0` disables the inline storage
+ */
+#ifndef BITLIB_INLINE_BITS
+#define BITLIB_INLINE_BITS 256
+#endif
+
+template <class Expression>
+class bitset_expression_t;
 
 /**
  * @brief Bitset type, stores a set of `bit_t` values
  *
  * @details This class stores a set of boolean (`bit_t`) values of dynamic length and provides means to perform most routine operations over bitsets.
  *
- * @note `std::vector<bit_t>` type is used as an underlying bitset value type.
+ * @note Bits are packed into 64-bit words, so a bitset takes one bit of memory per stored bit; individual bits are accessed through the @ref bitset_t::reference proxy. Bitsets of up to @ref BITLIB_INLINE_BITS bits keep their words within the object, and make no allocation.
  * @note Bitset class implements those operations which <b>do not depend</b> on the endianess of the bitset. For example, increment/decrement operators are not overloaded since their implementation depends on the position of the least significant bit in the bitset.
  *
  * Example usage:
@@ -41,13 +58,818 @@
  * @endcode
  */
 class bitset_t {
+public:
+
+	//  ######## ##    ## ########  ########  ######
+	//     ##     ##  ##  ##     ## ##       ##    ##
+	//     ##      ####   ##     ## ##       ##
+	//     ##       ##    ########  ######    ######
+	//     ##       ##    ##        ##             ##
+	//     ##       ##    ##        ##       ##    ##
+	//     ##       ##    ##        ########  ######
+
+	/**
+	 * @brief Storage word type
+	 *
+	 * @details Bits are packed into words of this type, the bit with index @c i is stored in the word @c i / @ref wordBits at the position @c i % @ref wordBits (counting from the least significant bit).
+	 */
+	typedef uint64_t word_t;
+
+	/**
+	 * @brief Number of bits stored in a single `word_t`
+	 */
+	static const size_t wordBits = 64;
+
+	/**
+	 * @brief Allocator of the storage words
+	 *
+	 * @details Allocates from the global heap unless constructed from a @ref bitset_arena_t, a @ref bitset_pool_t or another @ref bitset_memory_t. Bitsets short enough to store their words within the object (see @ref BITLIB_INLINE_BITS) never allocate.
+	 */
+	typedef bitset_allocator_t<word_t> allocator_type;
+
+	/**
+	 * @brief Vector of storage words, taken over by the packed words constructor
+	 */
+	typedef std::vector<word_t, allocator_type> word_vector_t;
+
+	/**
+	 * @brief Proxy reference to a single bit of the bitset
+	 *
+	 * @details Since bits are packed into words, there is no addressable `bit_t` object for every bit of the bitset. Instead, @ref operator[](), @ref at() and iterators return this proxy class, which remembers the storage word and the mask of the referenced bit, and behaves like a `bit_t&`: it can be read as `bit_t`, assigned to, and modified with `bit_t` operators.
+	 *
+	 * @warning The reference is invalidated by any operation which changes the length of the bitset.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise bitset
+	 *	bitset_t bitset({0,1,1,0});
+	 *
+	 *	// Read, write and modify bits through the proxy
+	 *	bit_t bit = bitset[1];
+	 *	bitset[0] = bit;
+	 *	bitset[3] ^= bit;
+	 * @endcode
+	 */
+	class reference {
+		friend class bitset_t;
+	private:
+		/**
+		 * @brief Pointer to the storage word containing the referenced bit
+		 */
+		word_t* word;
+
+		/**
+		 * @brief Mask of the referenced bit in the storage word
+		 */
+		word_t mask;
+
+		reference(word_t* word, const word_t mask) : word(word), mask(mask) {
+			return;
+		}
+
+		void assign(const bool value) {
+			if (value)
+				*word |= mask;
+			else
+				*word &= ~mask;
+		}
+	public:
+		/**
+		 * @brief Casts referenced bit to `bit_t`
+		 */
+		operator bit_t() const {
+			return bit_t((*word & mask) != 0);
+		}
+
+		/**
+		 * @brief Casts referenced bit to `bool`
+		 *
+		 * @note The cast is explicit, so that the proxy is never ambiguously converted either to `bit_t` or `bool`. It is still applied implicitly in conditions.
+		 */
+		explicit operator bool() const {
+			return (*word & mask) != 0;
+		}
+
+		/**
+		 * @brief Assigns @p value to the referenced bit
+		 */
+		reference& operator=(bit_t value) {
+			assign(value);
+			return *this;
+		}
+
+		/**
+		 * @brief Assigns the value of the bit referenced by @p other to the referenced bit
+		 */
+		reference& operator=(const reference& other) {
+			assign((*other.word & other.mask) != 0);
+			return *this;
+		}
+
+		/**
+		 * @brief Sets referenced bit to `true` value
+		 */
+		void set() {
+			*word |= mask;
+		}
+
+		/**
+		 * @brief Resets referenced bit to `false` value
+		 */
+		void reset() {
+			*word &= ~mask;
+		}
+
+		/**
+		 * @brief Inverts referenced bit value
+		 */
+		void invert() {
+			*word ^= mask;
+		}
+
+		/**
+		 * @brief Calculates inverted value of the referenced bit
+		 */
+		bit_t operator!() const {
+			return bit_t((*word & mask) == 0);
+		}
+
+		/**
+		 * @brief Calculates inverted value of the referenced bit
+		 */
+		bit_t operator~() const {
+			return bit_t((*word & mask) == 0);
+		}
+
+		/**
+		 * @brief Exclusive OR operator, see bit_t::operator^()
+		 */
+		bit_t operator^(const bit_t& other) const {
+			return bit_t(*this) ^ other;
+		}
+
+		/**
+		 * @brief Conjunction operator, see bit_t::operator&()
+		 */
+		bit_t operator&(const bit_t& other) const {
+			return bit_t(*this) & other;
+		}
+
+		/**
+		 * @brief Disjunction operator, see bit_t::operator|()
+		 */
+		bit_t operator|(const bit_t& other) const {
+			return bit_t(*this) | other;
+		}
+
+		/**
+		 * @brief Exclusive OR compound assignment operator, see bit_t::operator^=()
+		 */
+		reference& operator^=(bit_t other) {
+			if (other) invert();
+			return *this;
+		}
+
+		/**
+		 * @brief Conjunction compound assignment operator, see bit_t::operator&=()
+		 */
+		reference& operator&=(bit_t other) {
+			if (!other) reset();
+			return *this;
+		}
+
+		/**
+		 * @brief Disjunction compound assignment operator, see bit_t::operator|=()
+		 */
+		reference& operator|=(bit_t other) {
+			if (other) set();
+			return *this;
+		}
+
+		/**
+		 * @brief Equality test operator, see bit_t::operator==()
+		 */
+		bool operator==(const bit_t& other) const {
+			return bit_t(*this) == other;
+		}
+
+		/**
+		 * @brief Unequality test operator, see bit_t::operator!=()
+		 */
+		bool operator!=(const bit_t& other) const {
+			return bit_t(*this) != other;
+		}
+
+		/**
+		 * @brief Returns string with the binary representation of the referenced bit
+		 */
+		std::string toBinaryString() const {
+			return ((*word & mask) ? "1" : "0");
+		}
+
+		/**
+		 * @brief Inserts the referenced bit binary representation into @p os
+		 */
+		friend std::ostream& operator<<(std::ostream& os, const reference& bit) {
+			return os << bit.toBinaryString();
+		}
+
+		/**
+		 * @brief Exchanges the values of the referenced bits
+		 *
+		 * @note Proxies are swapped by value, so that standard algorithms (`std::reverse`, `std::rotate`, etc.) work over bitset iterators.
+		 */
+		friend void swap(reference left, reference right) {
+			const bool value = (*left.word & left.mask) != 0;
+			left.assign((*right.word & right.mask) != 0);
+			right.assign(value);
+		}
+	};
+
+	/**
+	 * @brief Value returned when a bit of a `const` bitset is accessed
+	 */
+	typedef bit_t const_reference;
+
+	/**
+	 * @brief Random access iterator over the bits of the bitset
+	 *
+	 * @details Dereferencing the iterator yields a @ref reference proxy to the bit.
+	 */
+	class iterator {
+		friend class bitset_t;
+		friend class const_iterator;
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef bit_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef void pointer;
+		typedef bitset_t::reference reference;
+	private:
+		/**
+		 * @brief Pointer to the first storage word of the bitset
+		 */
+		word_t* head;
+
+		/**
+		 * @brief Index of the bit the iterator points to
+		 */
+		size_t index;
+
+		iterator(word_t* head, const size_t index) : head(head), index(index) {
+			return;
+		}
+	public:
+		iterator() : head(nullptr), index(0) {
+			return;
+		}
+
+		reference operator*() const {
+			return reference(head + index / wordBits, bitMask(index));
+		}
+
+		reference operator[](const difference_type offset) const {
+			return *(*this + offset);
+		}
+
+		iterator& operator++() {
+			++index;
+			return *this;
+		}
+
+		iterator& operator--() {
+			--index;
+			return *this;
+		}
+
+		iterator operator++(int) {
+			iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		iterator operator--(int) {
+			iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		iterator& operator+=(const difference_type offset) {
+			index += offset;
+			return *this;
+		}
+
+		iterator& operator-=(const difference_type offset) {
+			index -= offset;
+			return *this;
+		}
+
+		iterator operator+(const difference_type offset) const {
+			return iterator(head, index + offset);
+		}
+
+		iterator operator-(const difference_type offset) const {
+			return iterator(head, index - offset);
+		}
+
+		friend iterator operator+(const difference_type offset, const iterator& it) {
+			return it + offset;
+		}
+
+		difference_type operator-(const iterator& other) const {
+			return (difference_type)index - (difference_type)other.index;
+		}
+
+		bool operator==(const iterator& other) const {
+			return index == other.index;
+		}
+
+		bool operator!=(const iterator& other) const {
+			return index != other.index;
+		}
+
+		bool operator<(const iterator& other) const {
+			return index < other.index;
+		}
+
+		bool operator>(const iterator& other) const {
+			return index > other.index;
+		}
+
+		bool operator<=(const iterator& other) const {
+			return index <= other.index;
+		}
+
+		bool operator>=(const iterator& other) const {
+			return index >= other.index;
+		}
+	};
+
+	/**
+	 * @brief Random access (`const`) iterator over the bits of the bitset
+	 *
+	 * @details Dereferencing the iterator yields the `bit_t` value of the bit.
+	 */
+	class const_iterator {
+		friend class bitset_t;
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef bit_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef void pointer;
+		typedef bitset_t::const_reference reference;
+	private:
+		/**
+		 * @brief Pointer to the first storage word of the bitset
+		 */
+		const word_t* head;
+
+		/**
+		 * @brief Index of the bit the iterator points to
+		 */
+		size_t index;
+
+		const_iterator(const word_t* head, const size_t index) : head(head), index(index) {
+			return;
+		}
+	public:
+		const_iterator() : head(nullptr), index(0) {
+			return;
+		}
+
+		const_iterator(const iterator& it) : head(it.head), index(it.index) {
+			return;
+		}
+
+		reference operator*() const {
+			return bit_t((head[index / wordBits] & bitMask(index)) != 0);
+		}
+
+		reference operator[](const difference_type offset) const {
+			return *(*this + offset);
+		}
+
+		const_iterator& operator++() {
+			++index;
+			return *this;
+		}
+
+		const_iterator& operator--() {
+			--index;
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		const_iterator operator--(int) {
+			const_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		const_iterator& operator+=(const difference_type offset) {
+			index += offset;
+			return *this;
+		}
+
+		const_iterator& operator-=(const difference_type offset) {
+			index -= offset;
+			return *this;
+		}
+
+		const_iterator operator+(const difference_type offset) const {
+			return const_iterator(head, index + offset);
+		}
+
+		const_iterator operator-(const difference_type offset) const {
+			return const_iterator(head, index - offset);
+		}
+
+		friend const_iterator operator+(const difference_type offset, const const_iterator& it) {
+			return it + offset;
+		}
+
+		friend difference_type operator-(const const_iterator& left, const const_iterator& right) {
+			return (difference_type)left.index - (difference_type)right.index;
+		}
+
+		friend bool operator==(const const_iterator& left, const const_iterator& right) {
+			return left.index == right.index;
+		}
+
+		friend bool operator!=(const const_iterator& left, const const_iterator& right) {
+			return left.index != right.index;
+		}
+
+		friend bool operator<(const const_iterator& left, const const_iterator& right) {
+			return left.index < right.index;
+		}
+
+		friend bool operator>(const const_iterator& left, const const_iterator& right) {
+			return left.index > right.index;
+		}
+
+		friend bool operator<=(const const_iterator& left, const const_iterator& right) {
+			return left.index <= right.index;
+		}
+
+		friend bool operator>=(const const_iterator& left, const const_iterator& right) {
+			return left.index >= right.index;
+		}
+	};
+
+	/**
+	 * @brief Forward iterator over the indices of the set bits
+	 *
+	 * @details Dereferencing the iterator yields the `size_t` index of a set bit. Empty words are skipped one comparison each, set bits of a word are found with trailingZeros(), so a full traversal costs time proportional to the number of words plus the number of set bits, rather than to the number of bits.
+	 *
+	 * @warning The iterator is invalidated by any operation which changes the length of the bitset.
+	 */
+	class position_iterator {
+		friend class bitset_t;
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef size_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const size_t* pointer;
+		typedef size_t reference;
+	private:
+		/**
+		 * @brief Pointer to the first storage word of the bitset
+		 */
+		const word_t* head;
+
+		/**
+		 * @brief Number of storage words of the bitset
+		 */
+		size_t words;
+
+		/**
+		 * @brief Index of the current storage word
+		 */
+		size_t word;
+
+		/**
+		 * @brief Set bits of the current word not visited yet, including the current one
+		 */
+		word_t rest;
+
+		/**
+		 * @brief Index of the set bit the iterator points to, @ref words * @ref wordBits at the end
+		 */
+		size_t index;
+
+		position_iterator(const word_t* head, const size_t words, const size_t word)
+			: head(head), words(words), word(word), rest(word < words ? head[word] : 0), index(0) {
+			seek();
+			return;
+		}
+
+		void seek() {
+			while (rest == 0) {
+				if (++word >= words) {
+					word = words;
+					index = words * wordBits;
+					return;
+				}
+				rest = head[word];
+			}
+			index = word * wordBits + trailingZeros(rest);
+		}
+	public:
+		position_iterator() : head(nullptr), words(0), word(0), rest(0), index(0) {
+			return;
+		}
+
+		reference operator*() const {
+			return index;
+		}
+
+		position_iterator& operator++() {
+			rest &= rest - 1;
+			seek();
+			return *this;
+		}
+
+		position_iterator operator++(int) {
+			position_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		friend bool operator==(const position_iterator& left, const position_iterator& right) {
+			return left.index == right.index;
+		}
+
+		friend bool operator!=(const position_iterator& left, const position_iterator& right) {
+			return left.index != right.index;
+		}
+	};
+
+	/**
+	 * @brief Range of the indices of the set bits, returned by positions()
+	 */
+	class position_range {
+		friend class bitset_t;
+	private:
+		const word_t* head;
+		size_t words;
+
+		position_range(const word_t* head, const size_t words) : head(head), words(words) {
+			return;
+		}
+	public:
+		position_iterator begin() const {
+			return position_iterator(head, words, 0);
+		}
+
+		position_iterator end() const {
+			return position_iterator(head, words, words);
+		}
+	};
+
+	/**
+	 * @brief Value returned by the search methods when no set bit is found
+	 */
+	static const size_t npos = (size_t)-1;
+
 private:
+	friend class roaring_bitmap_t;
+	friend class ewah_bitset_t;
+
 	/**
-	 * @brief Raw `std::vector<bit_t>` array
+	 * @brief Word container with a small-buffer optimization
+	 *
+	 * @details Behaves as the subset of `std::vector<word_t>` used by the bitset. Up to @ref inlineWords words are stored in an array within the object; longer contents are moved into a vector, which then keeps its capacity like `std::vector` does, so that a bitset which shrinks back does not reallocate when it grows again.
+	 */
+	class storage_t {
+	public:
+		/**
+		 * @brief Number of words stored within the object
+		 */
+		static const size_t inlineWords = BITLIB_INLINE_BITS / wordBits;
+	private:
+		word_t local[inlineWords == 0 ? 1 : inlineWords];
+		word_vector_t heap;
+		size_t count;
+
+		/**
+		 * @brief Whether the words are stored in @ref heap rather than @ref local
+		 */
+		bool external;
+	public:
+		storage_t() : local(), heap(), count(0), external(false) {
+			return;
+		}
+
+		explicit storage_t(const allocator_type& allocator) : local(), heap(allocator), count(0), external(false) {
+			return;
+		}
+
+		storage_t(const storage_t& other) : local(), heap(), count(0), external(false) {
+			assign(other.begin(), other.end());
+			return;
+		}
+
+		storage_t(storage_t&& other) noexcept : local(), heap(std::move(other.heap)), count(other.count), external(other.external) {
+			if (!external) std::copy(other.local, other.local + count, local);
+			other.heap.clear();
+			other.count = 0;
+			other.external = false;
+			return;
+		}
+
+		storage_t& operator=(const storage_t& other) {
+			if (this != &other) assign(other.begin(), other.end());
+			return *this;
+		}
+
+		storage_t& operator=(storage_t&& other) noexcept {
+			if (this == &other) return *this;
+			heap = std::move(other.heap);
+			count = other.count;
+			external = other.external;
+			if (!external) std::copy(other.local, other.local + count, local);
+			other.heap.clear();
+			other.count = 0;
+			other.external = false;
+			return *this;
+		}
+
+		word_t* data() {
+			return external ? heap.data() : local;
+		}
+
+		const word_t* data() const {
+			return external ? heap.data() : local;
+		}
+
+		size_t size() const {
+			return count;
+		}
+
+		bool empty() const {
+			return count == 0;
+		}
+
+		size_t capacity() const {
+			return external ? heap.capacity() : inlineWords;
+		}
+
+		word_t* begin() {
+			return data();
+		}
+
+		const word_t* begin() const {
+			return data();
+		}
+
+		word_t* end() {
+			return data() + count;
+		}
+
+		const word_t* end() const {
+			return data() + count;
+		}
+
+		word_t& operator[](const size_t index) {
+			return data()[index];
+		}
+
+		const word_t& operator[](const size_t index) const {
+			return data()[index];
+		}
+
+		word_t& back() {
+			return data()[count - 1];
+		}
+
+		void clear() {
+			heap.clear();
+			count = 0;
+		}
+
+		void resize(const size_t size, const word_t value = 0) {
+			if (external) {
+				heap.resize(size, value);
+			} else if (size <= inlineWords) {
+				if (size > count) std::fill(local + count, local + size, value);
+			} else {
+				heap.reserve(size);
+				heap.assign(local, local + count);
+				heap.resize(size, value);
+				external = true;
+			}
+			count = size;
+		}
+
+		void assign(const size_t size, const word_t value) {
+			clear();
+			resize(size, value);
+		}
+
+		void assign(const word_t* first, const word_t* last) {
+			const size_t size = (size_t)(last - first);
+			if (!external && size <= inlineWords) {
+				std::copy(first, last, local);
+			} else {
+				heap.assign(first, last);
+				external = true;
+			}
+			count = size;
+		}
+
+		/**
+		 * @brief Takes over the contents of @p words, without copying them unless they fit within the object
+		 */
+		void adopt(word_vector_t&& words) {
+			count = words.size();
+			external = count > inlineWords;
+			if (external) {
+				heap.swap(words);
+			} else {
+				std::copy(words.begin(), words.end(), local);
+				heap = word_vector_t(heap.get_allocator());
+			}
+		}
+
+		void swap(storage_t& other) noexcept {
+			for (size_t index = 0; index < inlineWords; ++index)
+				std::swap(local[index], other.local[index]);
+			heap.swap(other.heap);
+			std::swap(count, other.count);
+			std::swap(external, other.external);
+		}
+
+		allocator_type allocator() const {
+			return heap.get_allocator();
+		}
+	};
+
+	/**
+	 * @brief Packed storage words
+	 *
+	 * @details Bits beyond @ref bitLength in the last word are always kept zero, so that whole-word operations never have to mask the tail on reading.
 	 *
 	 * @warning This value should not be accessed by any external methods and members.
 	 */
-	std::vector<bit_t> set;
+	storage_t words;
+
+	/**
+	 * @brief Number of bits stored in the bitset
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	size_t bitLength;
+
+	/**
+	 * @brief Returns number of words required to store @p length bits
+	 */
+	static size_t wordsFor(const size_t length) {
+		return (length + wordBits - 1) / wordBits;
+	}
+
+	/**
+	 * @brief Returns mask of the bit with @p index in its storage word
+	 */
+	static word_t bitMask(const size_t index) {
+		return (word_t)1 << (index % wordBits);
+	}
+
+	/**
+	 * @brief Resets unused bits of the last storage word
+	 */
+	void clearTail();
+
+	/**
+	 * @brief Assigns @p value to the bits in the [@p first, @p last) range
+	 */
+	void fillRange(const size_t first, const size_t last, const bool value);
+
+	/**
+	 * @brief Replaces bitset contents with @p length values starting at @p head
+	 */
+	template <class InputIt>
+	void pack(InputIt head, const size_t length);
+
+	/**
+	 * @brief Replaces every storage word with the result of @p kernel applied to it and the corresponding word of @p other
+	 *
+	 * @details @p kernel is one of the binary kernels of the table returned by bitsetKernels(), so that words are processed with the widest vector instructions available on the host.
+	 */
+	void transformWords(const bitset_t& other, void (*kernel)(word_t*, const word_t*, const size_t));
+
+	/**
+	 * @brief Replaces bitset contents with the value of @p expression, calculated word by word in a single pass
+	 *
+	 * @details Storage is reused when its capacity suffices; @p expression may refer to `*this`, since every word of the result depends on the same word of the operands only.
+	 */
+	template <class Expression>
+	void evaluate(const Expression& expression);
 public:
 
 	//   ######  ##    ##  ######  ######## ########   ######
@@ -71,6 +893,25 @@ public:
 	 */
 	bitset_t();
 
+	/**
+	 * @brief Allocator `bitset_t` constructor
+	 *
+	 * @details Initialises an empty bitset, whose storage is allocated with @p allocator once it outgrows the object. Results of expressions assigned to the bitset, and lengths it is resized to, are stored with @p allocator as well.
+	 *
+	 * @param [in] allocator Allocator of the storage words, implicitly constructed from a @ref bitset_memory_t.
+	 *
+	 * @warning The bitset must not outlive the memory resource of @p allocator. A copy of the bitset allocates from the global heap, while a moved bitset keeps its allocator.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Compute the scratch bitsets of a query in an arena
+	 *	bitset_arena_t arena;
+	 *	bitset_t scratch(arena);
+	 *	scratch = allowed & ~denied;
+	 * @endcode
+	 */
+	explicit bitset_t(const allocator_type& allocator);
+
 	/**
 	 * @brief `bit_t` initializer list bitset_t constructor
 	 *
@@ -156,6 +997,37 @@ public:
 	 */
 	bitset_t(const bool* head, const size_t length);
 
+	/**
+	 * @brief Packed words bitset_t constructor
+	 *
+	 * @details Takes over @p storage as the packed storage of the bitset, along with its allocator, without copying it (see data() for the layout); bits of the last word past @p length are reset.
+	 *
+	 * @param [in] storage Words of the bitset.
+	 * @param [in] length Length of the bitset.
+	 *
+	 * @throw std::invalid_argument If the number of words does not match @p length.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Adopt words received from the network
+	 *	bitset_t::word_vector_t receivedWords = receiveWords();
+	 *	bitset_t someBitset(std::move(receivedWords), bitCount);
+	 * @endcode
+	 */
+	bitset_t(word_vector_t&& storage, const size_t length);
+
+	/**
+	 * @brief Packed words bitset_t constructor from a vector with the default allocator
+	 *
+	 * @details Copies @p storage into the packed storage of the bitset, since a vector of another allocator cannot be taken over; fill a @ref word_vector_t instead to avoid the copy.
+	 *
+	 * @param [in] storage Words of the bitset.
+	 * @param [in] length Length of the bitset.
+	 *
+	 * @throw std::invalid_argument If the number of words does not match @p length.
+	 */
+	bitset_t(const std::vector<word_t>& storage, const size_t length);
+
 	/**
 	 * @brief Copy bitset_t constructor
 	 *
@@ -174,6 +1046,56 @@ public:
 	 */
 	bitset_t(const bitset_t& bits);
 
+	/**
+	 * @brief Copy bitset_t constructor with an allocator
+	 *
+	 * @details Constructs a copy of @p bits, stored with @p allocator.
+	 *
+	 * @param [in] bits `bitset_t` value to initialize bitset with.
+	 * @param [in] allocator Allocator of the storage words.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Keep a copy of a long-lived mask in the pool of a cache
+	 *	bitset_t cached(mask, pool);
+	 * @endcode
+	 */
+	bitset_t(const bitset_t& bits, const allocator_type& allocator);
+
+	/**
+	 * @brief Move bitset_t constructor
+	 *
+	 * @details Takes over the storage of @p bits without copying it; @p bits is left empty. Words stored within the object (see @ref BITLIB_INLINE_BITS) are copied, thus views and indices of @p bits are invalidated.
+	 *
+	 * @param [in] bits `bitset_t` value to take the storage of.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Hand a large bitset over to the next stage without copying it
+	 *	bitset_t stageInput(std::move(stageOutput));
+	 * @endcode
+	 */
+	bitset_t(bitset_t&& bits) noexcept;
+
+	/**
+	 * @brief Expression bitset_t constructor
+	 *
+	 * @details Constructs `bitset_t` from a lazy expression of bitsets (see bitset_expression.h), evaluating the whole expression in a single pass over the operands, without any temporary bitsets.
+	 *
+	 * @param [in] expression Expression to evaluate.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise bitsets
+	 *	bitset_t a({0, 1, 1, 0}), b({1, 1, 0, 0}), c({0, 0, 1, 1}), d({1, 0, 0, 0});
+	 *
+	 *	// Evaluate a four-term filter at once
+	 *	bitset_t filter = ((a ^ b) & ~c) | d;
+	 * @endcode
+	 */
+	template <class Expression>
+	bitset_t(const bitset_expression_t<Expression>& expression);
+
 
 
 	//   ######     ###     ######  ########
@@ -187,6 +1109,8 @@ public:
 	/**
 	 * @brief Casts `bitset_t` to `std::vector<bit_t>`.
 	 *
+	 * @details Unpacks the bitset into a newly constructed vector, one `bit_t` per bit; the bitset itself is not modified.
+	 *
 	 * Example usage:
 	 * @code
 	 *	// Initialise and set someBitset
@@ -199,7 +1123,7 @@ public:
 	 *	someVector = someBitset;
 	 * @endcode
 	 */
-	operator std::vector<bit_t>();
+	operator std::vector<bit_t>() const;
 
 
 
@@ -224,7 +1148,7 @@ public:
 	 *	bitset_t someBitset({0, 1, 1, 0});
 	 *
 	 *	// Get the iterator to the beginning of the bitset
-	 *	std::vector<bit_t>::iterator end = someBitset.end();
+	 *	bitset_t::iterator end = someBitset.end();
 	 *
 	 *	// First way of cycling through all bits in the bitset
 	 *	for (auto bit : someBitset) {
@@ -237,7 +1161,7 @@ public:
 	 *	}
 	 * @endcode
 	 */
-	std::vector<bit_t>::iterator begin();
+	iterator begin();
 
 	/**
 	 * @brief Returns (`const`) iterator to beginning
@@ -252,7 +1176,7 @@ public:
 	 *	bitset_t someBitset({0, 1, 1, 0});
 	 *
 	 *	// Get the iterator to the beginning of the bitset
-	 *	std::vector<bit_t>::iterator end = someBitset.end();
+	 *	bitset_t::iterator end = someBitset.end();
 	 *
 	 *	// First way of cycling through all bits in the bitset
 	 *	for (auto bit : someBitset) {
@@ -265,7 +1189,7 @@ public:
 	 *	}
 	 * @endcode
 	 */
-	std::vector<bit_t>::const_iterator begin() const;
+	const_iterator begin() const;
 
 	/**
 	 * @brief Returns iterator to end
@@ -282,7 +1206,7 @@ public:
 	 *	bitset_t someBitset({0, 1, 1, 0});
 	 *
 	 *	// Get the iterator to the end of the bitset
-	 *	std::vector<bit_t>::iterator end = someBitset.end();
+	 *	bitset_t::iterator end = someBitset.end();
 	 *
 	 *	// First way of cycling through all bits in the bitset
 	 *	for (auto bit : someBitset) {
@@ -295,7 +1219,7 @@ public:
 	 *	}
 	 * @endcode
 	 */
-	std::vector<bit_t>::iterator end();
+	iterator end();
 
 	/**
 	 * @brief Returns (`const`) iterator to end
@@ -312,7 +1236,7 @@ public:
 	 *	bitset_t someBitset({0, 1, 1, 0});
 	 *
 	 *	// Get the iterator to the end of the bitset
-	 *	std::vector<bit_t>::iterator end = someBitset.end();
+	 *	bitset_t::iterator end = someBitset.end();
 	 *
 	 *	// First way of cycling through all bits in the bitset
 	 *	for (auto bit : someBitset) {
@@ -325,7 +1249,29 @@ public:
 	 *	}
 	 * @endcode
 	 */
-	std::vector<bit_t>::const_iterator end() const;
+	const_iterator end() const;
+
+	/**
+	 * @brief Returns range of the indices of the set bits
+	 *
+	 * @details Range-for over the result visits the index of every set bit in increasing order, skipping empty words without testing their bits one by one.
+	 *
+	 * @return @ref position_range over the set bits of the bitset.
+	 *
+	 * @warning The range is invalidated by any operation which changes the length of the bitset.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitset
+	 *	bitset_t someBitset({0, 1, 1, 0});
+	 *
+	 *	// Visit indices of the set bits (1 and 2)
+	 *	for (size_t index : someBitset.positions()) {
+	 *		...
+	 *	}
+	 * @endcode
+	 */
+	position_range positions() const;
 
 	/**
 	 * @brief Returns length of the bitset
@@ -404,6 +1350,53 @@ public:
 	 */
 	void resize(const size_t length, const bit_t& value);
 
+	/**
+	 * @brief Returns pointer to the packed storage words
+	 *
+	 * @details Bit @c i of the bitset is stored in the word @c i / @ref wordBits at the position @c i % @ref wordBits. Unused bits of the last word are always zero.
+	 *
+	 * @return (`const`) pointer to the first of wordCount() storage words.
+	 *
+	 * @warning The pointer is invalidated by any operation which changes the length of the bitset.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitset
+	 *	bitset_t someBitset({0, 1, 1, 0});
+	 *
+	 *	// Read the first storage word (6)
+	 *	uint64_t word = someBitset.data()[0];
+	 * @endcode
+	 */
+	const word_t* data() const;
+
+	/**
+	 * @brief Returns number of the packed storage words
+	 *
+	 * @return `size_t` number of words, equal to @ref length() divided by @ref wordBits and rounded up.
+	 */
+	size_t wordCount() const;
+
+	/**
+	 * @brief Returns the allocator of the storage words
+	 */
+	allocator_type allocator() const;
+
+	/**
+	 * @brief Exchanges contents of `*this` and @p other bitsets
+	 *
+	 * @details Exchanges the storage pointers only, in constant time and without allocations.
+	 *
+	 * @param [in,out] other Bitset to exchange contents with.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Double-buffer the current and the next generation
+	 *	current.swap(next);
+	 * @endcode
+	 */
+	void swap(bitset_t& other) noexcept;
+
 
 
 	//  ##        #######   ######   ####  ######
@@ -472,6 +1465,40 @@ public:
 	 */
 	void invert();
 
+	/**
+	 * @brief Returns the number of set bits in the bitset
+	 *
+	 * @details Counts the bits equal to `true` (population count, or Hamming weight of the bitset). Words are counted with the popcount kernel selected by bitsetKernels(): the POPCNT instruction, the AVX2 Harley-Seal adder tree or AVX-512 VPOPCNTDQ, depending on the host.
+	 *
+	 * @return `size_t` number of set bits.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitset
+	 *	bitset_t someBitset({0, 1, 1, 0});
+	 *
+	 *	// Count set bits (2)
+	 *	size_t ones = someBitset.count();
+	 * @endcode
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Tests whether any bit of the bitset is set
+	 *
+	 * @return `true` if at least one bit equals `true`, `false` otherwise (also for an empty bitset).
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitset
+	 *	bitset_t someBitset({0, 1, 1, 0});
+	 *
+	 *	// Test for set bits (true)
+	 *	bool nonEmpty = someBitset.any();
+	 * @endcode
+	 */
+	bool any() const;
+
 	/**
 	 * @brief Returns the number of bits at which @p left and @p right bitset are different
 	 *
@@ -484,7 +1511,7 @@ public:
 	 *
 	 * @warning @p left and @p right bitsets <b>must be of equal length</b>.
 	 *
-	 * @note Two different solutions to implement this method were found: first one used a temporary bitset, each bit of which stored a sum of corresponding bits of @p left and @p rigth bitsets, and then used `std::accumulate` method to calculate total number of non-zero bits in this temporary bitset. The second way suggested using `std::inner_product` method with custom operators: it uses `std::plus<size_t>` as an accumulative operator and @ref bitwise_nequal() as binary product operator. Second approach showed much better performance over long bitsets.
+	 * @note The distance is the population count of \f$ left \oplus right \f$, calculated word by word with the xor-popcount kernel selected by bitsetKernels(). The xor is never stored and neither bitset is copied.
 	 *
 	 * Example usage:
 	 * @code
@@ -495,7 +1522,78 @@ public:
 	 *	size_t distance = hammingDistance(firstBitset, secondBitset);
 	 * @endcode
 	 */
-	friend size_t hammingDistance(const bitset_t left, const bitset_t right);
+	friend size_t hammingDistance(const bitset_t& left, const bitset_t& right);
+
+
+
+	//   ######  ########    ###    ########   ######  ##     ##
+	//  ##    ## ##         ## ##   ##     ## ##    ## ##     ##
+	//  ##       ##        ##   ##  ##     ## ##       ##     ##
+	//   ######  ######   ##     ## ########  ##       #########
+	//        ## ##       ######### ##   ##   ##       ##     ##
+	//  ##    ## ##       ##     ## ##    ##  ##    ## ##     ##
+	//   ######  ######## ##     ## ##     ##  ######  ##     ##
+
+	/**
+	 * @brief Returns index of the first set bit
+	 *
+	 * @details Skips empty words and finds the bit within the first non-empty one with trailingZeros().
+	 *
+	 * @return Index of the lowest set bit, or @ref npos if no bit is set.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitset
+	 *	bitset_t someBitset({0, 1, 1, 0});
+	 *
+	 *	// Find the first set bit (1)
+	 *	size_t first = someBitset.findFirst();
+	 * @endcode
+	 */
+	size_t findFirst() const;
+
+	/**
+	 * @brief Returns index of the first set bit after @p index
+	 *
+	 * @param [in] index Index to search after; the bit with this index is not considered.
+	 *
+	 * @return Index of the lowest set bit greater than @p index, or @ref npos if there is none.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Visit all set bits
+	 *	for (size_t index = someBitset.findFirst(); index != bitset_t::npos; index = someBitset.findNext(index)) {
+	 *		...
+	 *	}
+	 * @endcode
+	 */
+	size_t findNext(const size_t index) const;
+
+	/**
+	 * @brief Returns index of the last set bit
+	 *
+	 * @details Skips empty words backwards and finds the bit within the last non-empty one with leadingZeros().
+	 *
+	 * @return Index of the highest set bit, or @ref npos if no bit is set.
+	 */
+	size_t findLast() const;
+
+	/**
+	 * @brief Returns index of the last set bit before @p index
+	 *
+	 * @param [in] index Index to search before; the bit with this index is not considered. Values not less than length() search the whole bitset.
+	 *
+	 * @return Index of the highest set bit less than @p index, or @ref npos if there is none.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Visit all set bits in reverse order
+	 *	for (size_t index = someBitset.findLast(); index != bitset_t::npos; index = someBitset.findPrev(index)) {
+	 *		...
+	 *	}
+	 * @endcode
+	 */
+	size_t findPrev(const size_t index) const;
 
 
 
@@ -510,9 +1608,9 @@ public:
 	/**
 	 * @brief Rotates left the bits in the bitset
 	 *
-	 * @details Rotates the order of the bits in the bitset, in such a way that the bit pointed by @ref begin() ` + ` @p shift becomes the new first element.
+	 * @details Rotates the order of the bits in the bitset, in such a way that the bit pointed by @ref begin() ` + ` @p shift becomes the new first element. The bits which wrap around are set aside, at most half of the bitset, the bitset is shifted in place in a single funnel-shift pass, see shiftLeft(), and the bits set aside are written back at the other end; rotations by more than half of the length go the other way round, see rotateRight().
 	 *
-	 * @param shift Position of the bit that is moved to the first position in the bitset.
+	 * @param shift Position of the bit that is moved to the first position in the bitset; taken modulo the length of the bitset.
 	 *
 	 * Example usage:
 	 * @code
@@ -528,11 +1626,9 @@ public:
 	/**
 	 * @brief Rotates right the bits in the bitset
 	 *
-	 * @details Rotates the order of the bits in the bitset, in such a way that the bit pointed by @ref end() ` - ` @p shift becomes the new last element.
+	 * @details Rotates the order of the bits in the bitset, in such a way that the bit pointed by @ref end() ` - ` @p shift becomes the new last element. Equivalent to rotateLeft() by the length of the bitset minus @p shift; implemented the same way with shiftRight().
 	 *
-	 * @param shift Position of the bit that is moved to the last position in the bitset @b subtracted from the total length of the bitset.
-	 *
-	 * @warning Implementation of the right rotation of the bitset is slightly more complicated than the implementation of the left rotation (requires calculating the total length of the bitset (constant complexity)), thus <b>it takes slightly more time to rotate long bitsets right</b>.
+	 * @param shift Position of the bit that is moved to the last position in the bitset @b subtracted from the total length of the bitset; taken modulo the length of the bitset.
 	 *
 	 * Example usage:
 	 * @code
@@ -548,7 +1644,7 @@ public:
 	/**
 	 * @brief Shifts left the bits in the bitset
 	 *
-	 * @details Shifts the bits in the bitset, in such a way that the bit pointed by @ref begin() ` + ` @p shift becomes the new first element.
+	 * @details Shifts the bits in the bitset, in such a way that the bit pointed by @ref begin() ` + ` @p shift becomes the new first element. Whole words are moved in a single pass, neighbouring words are combined with the funnel shift kernel selected by bitsetKernels(); a @p shift of at least the length of the bitset resets every bit.
 	 *
 	 * @param shift Position of the bit that is moved to the first position in the bitset.
 	 *
@@ -570,7 +1666,7 @@ public:
 	/**
 	 * @brief Shifts right the bits in the bitset
 	 *
-	 * @details Shifts the bits in the bitset, in such a way that the bit pointed by @ref end() ` - ` @p shift becomes the new last element.
+	 * @details Shifts the bits in the bitset, in such a way that the bit pointed by @ref end() ` - ` @p shift becomes the new last element. Whole words are moved in a single pass, starting from the last one, neighbouring words are combined with the funnel shift kernel selected by bitsetKernels(); a @p shift of at least the length of the bitset resets every bit.
 	 *
 	 * @param shift Position of the bit that is moved to the last position in the bitset @b subtracted from the total length of the bitset.
 	 *
@@ -591,56 +1687,6 @@ public:
 
 
 
-	//  ##     ## ##    ##    ###    ########  ##    ##
-	//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
-	//  ##     ## ####  ##  ##   ##  ##     ##   ####
-	//  ##     ## ## ## ## ##     ## ########     ##
-	//  ##     ## ##  #### ######### ##   ##      ##
-	//  ##     ## ##   ### ##     ## ##    ##     ##
-	//   #######  ##    ## ##     ## ##     ##    ##
-
-	/**
-	 * @brief Calculates inverted bitset value
-	 *
-	 * @details Does not modify `*this` bitset.
-	 *
-	 * @return Inverted bitset_t value.
-	 *
-	 * Example usage:
-	 * @code
-	 *	// Initialise bitset
-	 *	bitset_t someBitset({0,0,1,0});
-	 *
-	 *	// Assign inverted bitset to the other bitset
-	 *	bitset_t someOtherBitset = !someBitset;
-	 * @endcode
-	 *
-	 * @see operator~()
-	 */
-	bitset_t operator!() const;
-
-	/**
-	 * @brief Calculates inverted bitset value
-	 *
-	 * @details Does not modify `*this` bitset.
-	 *
-	 * @return Inverted bitset_t value.
-	 *
-	 * Example usage:
-	 * @code
-	 *	// Initialise bitset
-	 *	bitset_t someBitset({0,0,1,0});
-	 *
-	 *	// Assign inverted bitset to the other bitset
-	 *	bitset_t someOtherBitset = ~someBitset;
-	 * @endcode
-	 *
-	 * @see operator!()
-	 */
-	bitset_t operator~() const;
-
-
-
 	//  ########  #### ##    ##    ###    ########  ##    ##
 	//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
 	//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
@@ -649,109 +1695,16 @@ public:
 	//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
 	//  ########  #### ##    ## ##     ## ##     ##    ##
 
-	/**
-	 * @brief Exclusive OR operator
-	 *
-	 * @details Overloaded bitwise exclusive OR (XOR, \f$ \oplus \f$) operator, considered equal to addition modulo 2, has the following truth table:
-	 *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1\oplus x_2\f$ |
-	 *	|:---------:|:---------:|:---------------------:|
-	 *	|0          |0          |0                      |
-	 *	|0          |1          |1                      |
-	 *	|1          |0          |1                      |
-	 *	|1          |1          |0                      |
-	 *	XOR can be expressed in terms of NOT (\f$\neg\f$), OR (\f$\vee\f$) and AND (\f$\wedge\f$) as follows: \f$ f = x_1 \oplus x_2 = (x_1 \vee x_2) \wedge \neg(x_1 \wedge x_2) \f$. Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \oplus X_2 \iff \forall i : Y^i = X_1^i \oplus X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
-	 *
-	 * @param [in] other Second `bitset_t` operand \f$X_2\f$.
-	 *
-	 * @note \f$X_1\f$ bitset is passed via `*this`.
-	 *
-	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
-	 *
-	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
-	 *
-	 * Example usage:
-	 * @code
-	 *	// Initialise bitset_t values
-	 *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
-	 *
-	 *	// Calculate Y = xor(X1, X2)
-	 *	Y = X1 ^ X2;
-	 * @endcode
-	 */
-	bitset_t operator^(const bitset_t& other) const;
-
-	/**
-	 * @brief Conjunction operator
-	 *
-	 * @details Overloaded bitwise conjuction (AND, \f$\&\f$, \f$\wedge\f$) operator, only returns `true` when both operands are `true`, and `false` otherwise; has the following truth table:
-	 *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1\wedge x_2\f$ |
-	 *	|:---------:|:---------:|:---------------------:|
-	 *	|0          |0          |0                      |
-	 *	|0          |1          |0                      |
-	 *	|1          |0          |0                      |
-	 *	|1          |1          |1                      |
-	 *	Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \wedge X_2 \iff \forall i : Y^i = X_1^i \wedge X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
-	 *
-	 * @param [in] other Second `bitset_t` operand \f$X_2\f$.
-	 *
-	 * @note \f$X_1\f$ bitset is passed via `*this`.
-	 *
-	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
-	 *
-	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
-	 *
-	 * Example usage:
-	 * @code
-	 *	// Initialise bitset_t values
-	 *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
-	 *
-	 *	// Calculate Y = X1 & X2
-	 *	Y = X1 & X2;
-	 * @endcode
-	 */
-	bitset_t operator&(const bitset_t& other) const;
-
-	/**
-	 * @brief Disjunction operator
-	 *
-	 * @details Overloaded bitwise disjuction (OR, \f$\vert\f$, \f$\vee\f$) operator, only returns `false` when both operands are `false`, and `true` otherwise; has the following truth table:
-	 *	| \f$x_1\f$ | \f$x_2\f$ | \f$f=x_1 \vee x_2\f$  |
-	 *	|:---------:|:---------:|:---------------------:|
-	 *	|0          |0          |0                      |
-	 *	|0          |1          |1                      |
-	 *	|1          |0          |1                      |
-	 *	|1          |1          |1                      |
-	 *	Operator is applied [pairwise] <b>to every pair of corresponding bits in the bitsets</b>: \f[ Y = X_1 \vee X_2 \iff \forall i : Y^i = X_1^i \vee X_2^i = f\left(X_1^i, X_2^i\right), \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
-	 *
-	 * @param [in] other Second `bitset_t` operand \f$X_2\f$.
-	 *
-	 * @note \f$X_1\f$ bitset is passed via `*this`.
-	 *
-	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
-	 *
-	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
-	 *
-	 * Example usage:
-	 * @code
-	 *	// Initialise bitset_t values
-	 *	bitset_t X1({0,1,1,0}), X2({1,1,1,0}), Y;
-	 *
-	 *	// Calculate Y = X1 | X2
-	 *	Y = X1 | X2;
-	 * @endcode
-	 */
-	bitset_t operator|(const bitset_t& other) const;
-
 	/**
 	 * @brief Scalar product operator
 	 *
-	 * @details Scalar product operator (\f$*,\,\times,\,\cdot\f$) operator, sometimes is referred to as the inner product w/addition modulo 2. Scalar product \f$ y \f$ of bitsets \f$X_1\f$ and \f$X_2\f$ is calculated as follows: \f[ y = \left\langle X_1,\,X_2 \right\rangle \iff  y = \bigoplus_{i} \left( X_1^i \wedge X_2^i \right) = \sum_{i} \left( X_1^i \wedge X_2^i \right) \pmod{2}, \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
+	 * @details Scalar product operator (\f$*,\,\times,\,\cdot\f$) operator, sometimes is referred to as the inner product w/addition modulo 2. Scalar product \f$ y \f$ of bitsets \f$X_1\f$ and \f$X_2\f$ is calculated as follows: \f[ y = \left\langle X_1,\,X_2 \right\rangle \iff  y = \bigoplus_{i} \left( X_1^i \wedge X_2^i \right) = \sum_{i} \left( X_1^i \wedge X_2^i \right) \pmod{2}, \f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset. The conjunctions are folded with XOR a vector of words at a time by the kernel selected by bitsetKernels(), and only the parity of the folded word is counted. See scalarProducts() for one bitset against many.
 	 *
 	 * @param [in] other Second `bitset_t` operand \f$X_2\f$.
 	 *
 	 * @note \f$X_1\f$ bitset is passed via `*this`.
 	 *
-	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
+	 * @return `bit_t` value \f$ y \f$
 	 *
 	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
 	 *
@@ -783,7 +1736,9 @@ public:
 	 *
 	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
 	 *
-	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
+	 * @warning Bitsets \f$X_1\f$ (@p left) and \f$X_2\f$ (@p right) <b>must be of equal length</b>.
+	 *
+	 * @note The result has the length of @p left.
 	 *
 	 * Example usage:
 	 * @code
@@ -794,7 +1749,7 @@ public:
 	 *	Y = nand(X1, X2)
 	 * @endcode
 	 */
-	friend bitset_t nand(bitset_t& left, bitset_t& right);
+	friend bitset_t nand(const bitset_t& left, const bitset_t& right);
 
 	/**
 	 * @brief Negated disjuction operator
@@ -813,7 +1768,9 @@ public:
 	 *
 	 * @return `bitset_t` value \f$ Y = f(X_1, X_2) \f$
 	 *
-	 * @warning Bitsets \f$X_1\f$ (the one that this operator is invoked upon, `*this`) and \f$X_2\f$ (@p other) <b>must be of equal length</b>.
+	 * @warning Bitsets \f$X_1\f$ (@p left) and \f$X_2\f$ (@p right) <b>must be of equal length</b>.
+	 *
+	 * @note The result has the length of @p left.
 	 *
 	 * Example usage:
 	 * @code
@@ -824,7 +1781,7 @@ public:
 	 *	Y = nor(X1, X2)
 	 * @endcode
 	 */
-	friend bitset_t nor(bitset_t& left, bitset_t& right);
+	friend bitset_t nor(const bitset_t& left, const bitset_t& right);
 
 
 
@@ -840,7 +1797,7 @@ public:
 	 * @brief Assignment operator
 	 *
 	 * @details Bitwise unary assignment operator, assigns @p other operand
-	 *	value to `*this`.
+	 *	value to `*this`. Storage of `*this` is reused, so that no memory is allocated unless @p other is longer than the capacity of `*this`.
 	 *
 	 * @param [in] other The right `bitset_t` part of the assignment.
 	 *
@@ -855,7 +1812,27 @@ public:
 	 *	X2 = X1;
 	 * @endcode
 	 */
-	bitset_t& operator=(const bitset_t other);
+	bitset_t& operator=(const bitset_t& other);
+
+	/**
+	 * @brief Move assignment operator
+	 *
+	 * @details Takes over the storage of @p other without copying it, and releases the former storage of `*this`; @p other is left empty.
+	 *
+	 * @param [in] other The right `bitset_t` part of the assignment.
+	 *
+	 * @return Modified `*this` `bitset_t` value.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise bitsets
+	 *	bitset_t X1({0,1,1,0}), X2;
+	 *
+	 *	// Move X1 bits to X2 bitset
+	 *	X2 = std::move(X1);
+	 * @endcode
+	 */
+	bitset_t& operator=(bitset_t&& other) noexcept;
 
 	/**
 	 * @brief Exclusive OR compound assignment operator
@@ -921,14 +1898,53 @@ public:
 	 */
 	bitset_t& operator|=(const bitset_t& other);
 
+	/**
+	 * @brief Expression assignment operator
+	 *
+	 * @details Evaluates @p expression (see bitset_expression.h) word by word directly into the storage of `*this`: no temporary bitsets are created, every operand word is read once, and no memory is allocated unless `*this` is too short. @p expression may refer to `*this` itself.
+	 *
+	 * @param [in] expression The right part of the assignment.
+	 *
+	 * @return Modified `*this` `bitset_t` value.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise bitsets
+	 *	bitset_t a({0, 1, 1, 0}), b({1, 1, 0, 0}), c({0, 0, 1, 1}), Y;
+	 *
+	 *	// Fused evaluation of the whole expression
+	 *	Y = (a ^ b) & ~c;
+	 * @endcode
+	 */
+	template <class Expression>
+	bitset_t& operator=(const bitset_expression_t<Expression>& expression);
+
+	/**
+	 * @brief Exclusive OR compound assignment operator for expressions, fused with the evaluation of @p expression
+	 */
+	template <class Expression>
+	bitset_t& operator^=(const bitset_expression_t<Expression>& expression);
+
+	/**
+	 * @brief Conjunction compound assignment operator for expressions, fused with the evaluation of @p expression
+	 */
+	template <class Expression>
+	bitset_t& operator&=(const bitset_expression_t<Expression>& expression);
+
+	/**
+	 * @brief Disjunction compound assignment operator for expressions, fused with the evaluation of @p expression
+	 */
+	template <class Expression>
+	bitset_t& operator|=(const bitset_expression_t<Expression>& expression);
+
 	/**
 	 * @brief Returns bit at position @p index
 	 *
-	 * @details Returns a reference to the bit at specified location @p index.
+	 * @details Returns a @ref reference proxy to the bit at specified location @p index.
 	 *
 	 * @param [in] index Position of the bit to return.
 	 *
-	 * @return Reference to the requested bit.
+	 * @return Proxy reference to the requested bit.
 	 *
 	 * @warning No bounds checking is performed.
 	 *
@@ -937,20 +1953,21 @@ public:
 	 *	// Initialise bitset
 	 *	bitset_t X({0,1,1,0});
 	 *
-	 *	// Capture second bit (1) by reference
-	 *	bit_t bit = X[1];
+	 *	// Capture second bit (1) by reference and reset it
+	 *	bitset_t::reference bit = X[1];
+	 *	bit.reset();
 	 * @endcode
 	 */
-	std::vector<bit_t>::reference operator[](const size_t index);
+	reference operator[](const size_t index);
 
 	/**
 	 * @brief Returns bit at position @p index
 	 *
-	 * @details Returns a (`const`) reference to the bit at specified location @p index.
+	 * @details Returns the value of the bit at specified location @p index.
 	 *
 	 * @param [in] index Position of the bit to return.
 	 *
-	 * @return (`const`) reference to the requested bit.
+	 * @return `bit_t` value of the requested bit.
 	 *
 	 * @warning No bounds checking is performed.
 	 *
@@ -959,20 +1976,20 @@ public:
 	 *	// Initialise bitset
 	 *	bitset_t X({1,0,1,0});
 	 *
-	 *	// Capture second bit (0) by reference
+	 *	// Read second bit (0)
 	 *	bit_t bit = X[1];
 	 * @endcode
 	 */
-	std::vector<bit_t>::const_reference operator[](const size_t index) const;
+	const_reference operator[](const size_t index) const;
 
 	/**
 	 * @brief Returns bit at position @p index
 	 *
-	 * @details Returns a reference to the bit at specified location @p index.
+	 * @details Returns a @ref reference proxy to the bit at specified location @p index.
 	 *
 	 * @param [in] index Position of the bit to return.
 	 *
-	 * @return Reference to the requested bit.
+	 * @return Proxy reference to the requested bit.
 	 *
 	 * @note This method automatically checks whether @p index is within the bounds of valid bits in the bitset, throwing an `out_of_range` exception if it is not. This is in contrast with member @ref operator[](), that does not check against bounds.
 	 *
@@ -981,20 +1998,20 @@ public:
 	 *	// Initialise bitset
 	 *	bitset_t X({1,0,1,0});
 	 *
-	 *	// Capture second bit (0) by reference
+	 *	// Read second bit (0)
 	 *	bit_t bit = X.at(1);
 	 * @endcode
 	 */
-	std::vector<bit_t>::reference at(const size_t index);
+	reference at(const size_t index);
 
 	/**
 	 * @brief Returns bit at position @p index
 	 *
-	 * @details Returns a (`const`) reference to the bit at specified location @p index.
+	 * @details Returns the value of the bit at specified location @p index.
 	 *
 	 * @param [in] index Position of the bit to return.
 	 *
-	 * @return (`const`) reference to the requested bit.
+	 * @return `bit_t` value of the requested bit.
 	 *
 	 * @note This method automatically checks whether @p index is within the bounds of valid bits in the bitset, throwing an `out_of_range` exception if it is not. This is in contrast with member @ref operator[](), that does not check against bounds.
 	 *
@@ -1003,11 +2020,11 @@ public:
 	 *	// Initialise bitset
 	 *	bitset_t X({1,0,1,0});
 	 *
-	 *	// Capture second bit (0) by reference
+	 *	// Read second bit (0)
 	 *	bit_t bit = X.at(1);
 	 * @endcode
 	 */
-	std::vector<bit_t>::const_reference at(const size_t index) const;
+	const_reference at(const size_t index) const;
 
 	//   ######   #######  ##     ## ########  ########   ######  ##    ##
 	//  ##    ## ##     ## ###   ### ##     ## ##     ## ##    ## ###   ##
@@ -1030,6 +2047,8 @@ public:
 	 * @note The bitsets are considered equal if, and only if every bit in the first bitset is equal to the corresponding bit in the second bitset: \f[ X_1 = X_2 \iff \forall i : X_1^i = X_2^i,\f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
 	 * @note The bitsets are considered unequal if there is at least one bit in the first vector which is different from the corresponding but in the second vector: \f[ X_1 \neq X_2 \iff \exists i : X_1^i \neq X_2^i,\f] where \f$ X^i \f$ denotes \f$i-\f$th bit of the \f$X\f$ bitset.
 	 *
+	 * @note Bitsets of different length are never equal.
+	 *
 	 * Example usage:
 	 * @code
 	 *	// Initialise bitsets
@@ -1039,7 +2058,7 @@ public:
 	 *	bool y = (X1 == X2);
 	 * @endcode
 	 */
-	bool operator== (bitset_t& other);
+	bool operator== (const bitset_t& other) const;
 
 	/**
 	 * @brief Unequality test operator
@@ -1063,7 +2082,7 @@ public:
 	 *	bool y = (X1 != X2);
 	 * @endcode
 	 */
-	bool operator!= (bitset_t& other);
+	bool operator!= (const bitset_t& other) const;
 
 
 
@@ -1078,6 +2097,8 @@ public:
 	/**
 	 * @brief Returns string with the binary representation of the bitset
 	 *
+	 * @details Same as encodeBitset() in the binary format: the string is allocated once, and every byte of the bitset is expanded into eight digits at once.
+	 *
 	 * @return `std::string` containing the binary bit representation.
 	 *
 	 * @note Method does not modify `*this` value, upon which it was invoked.
@@ -1096,7 +2117,7 @@ public:
 	/**
 	 * @brief Returns string with the binary representation of the bitset
 	 *
-	 * @details Bits in the string would be separated by the delimiter.
+	 * @details Bits in the string would be separated by the delimiter. The string is allocated once at its final size.
 	 *
 	 * @return `std::string` containing the binary bit representation w/delimiters.
 	 *
@@ -1116,15 +2137,13 @@ public:
 	/**
 	 * @brief Inserts @p bitset binary representation into @p os
 	 *
-	 * @details Insertion is performed with toBinaryString() method.
+	 * @details Insertion is performed with writeBitset() in the binary format, a block of digits at a time, without building the string of the whole bitset.
 	 *
 	 * @param [in,out] os An `std::ostream` which method is invoked upon.
 	 * @param [in] bits Bitset to be inserted.
 	 *
 	 * @return Modified `std::ostream` stream.
 	 *
-	 * @note Uses overloaded for `std::string` stream insertion operator.
-	 *
 	 * Example usage:
 	 * @code
 	 *	// Initialise bitset
@@ -1139,4 +2158,14 @@ public:
 	friend std::ostream& operator<<(std::ostream& os, const bitset_t& bits);
 };
 
+// Namespace scope declarations, so that lazy expressions convert to bitset_t when passed to these functions
+size_t hammingDistance(const bitset_t& left, const bitset_t& right);
+void swap(bitset_t& left, bitset_t& right) noexcept;
+bitset_t nand(const bitset_t& left, const bitset_t& right);
+bitset_t nor(const bitset_t& left, const bitset_t& right);
+std::ostream& operator<<(std::ostream& os, const bitset_t& bits);
+
+// Operators of bitsets build lazy expressions, evaluated on assignment
+#include "bitset_expression.h"
+
 #endif
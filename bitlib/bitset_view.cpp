@@ -0,0 +1,192 @@
+/**
+ * @file bitset_view.cpp
+ * @implements bitset_view.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `bitset_view_t` class
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "bitset_view.h"
+#include "bitset_kernels.h"
+#include "bitset_codec.h"
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+bitset_view_t::bitset_view_t() : head(nullptr), shift(0), bitLength(0) {
+	return;
+}
+
+bitset_view_t::bitset_view_t(const word_t* words, const size_t length, const size_t offset) : head(words + offset / 64), shift(offset % 64), bitLength(length) {
+	return;
+}
+
+bitset_view_t::bitset_view_t(const bitset_t& bits) : head(bits.data()), shift(0), bitLength(bits.length()) {
+	return;
+}
+
+bitset_view_t::bitset_view_t(const bitset_t& bits, const size_t offset, const size_t length) : head(bits.data() + offset / 64), shift(offset % 64), bitLength(length) {
+	if (offset > bits.length() || length > bits.length() - offset)
+		throw std::out_of_range("bitset_view_t::bitset_view_t: range exceeds the bitset");
+	return;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+bool bitset_view_t::empty() const {
+	return bitLength == 0;
+}
+
+bitset_view_t::word_t bitset_view_t::paddedWord(const size_t index) const {
+	if (index < commonWords()) return word(index);
+	// Storage words holding the remaining bits of the view, relative to head
+	const size_t rest = bitLength - index * 64;
+	word_t value = head[index] >> shift;
+	if (shift + rest > 64) value |= head[index + 1] << (64 - shift);
+	return value & bitsetTailMask(bitLength, index);
+}
+
+bitset_view_t bitset_view_t::subview(const size_t offset, const size_t length) const {
+	if (offset > bitLength || length > bitLength - offset)
+		throw std::out_of_range("bitset_view_t::subview: range exceeds the view");
+	return bitset_view_t(head, length, shift + offset);
+}
+
+bit_t bitset_view_t::operator[](const size_t index) const {
+	const size_t bit = shift + index;
+	return bit_t(((head[bit / 64] >> (bit % 64)) & 1) != 0);
+}
+
+bit_t bitset_view_t::at(const size_t index) const {
+	if (index >= bitLength) throw std::out_of_range("bitset_view_t::at");
+	return (*this)[index];
+}
+
+size_t bitset_view_t::count() const {
+	if (shift != 0) return bitset_expression_t<bitset_view_t>::count();
+	const size_t full = commonWords();
+	size_t total = bitsetKernels().popcountWords(head, full);
+	if (full != wordCount()) total += popcountWord(paddedWord(full));
+	return total;
+}
+
+bool bitset_view_t::any() const {
+	const size_t full = commonWords();
+	for (size_t index = 0; index < full; ++index)
+		if (word(index) != 0) return true;
+	return full != wordCount() && paddedWord(full) != 0;
+}
+
+size_t bitset_view_t::findFirst() const {
+	const size_t words = wordCount();
+	for (size_t index = 0; index < words; ++index) {
+		const word_t value = paddedWord(index);
+		if (value != 0) return index * 64 + trailingZeros(value);
+	}
+	return bitset_t::npos;
+}
+
+size_t bitset_view_t::findNext(const size_t index) const {
+	if (index >= bitLength || index + 1 == bitLength) return bitset_t::npos;
+	size_t word = (index + 1) / 64;
+	word_t rest = paddedWord(word) & (~(word_t)0 << ((index + 1) % 64));
+	while (rest == 0) {
+		if (++word == wordCount()) return bitset_t::npos;
+		rest = paddedWord(word);
+	}
+	return word * 64 + trailingZeros(rest);
+}
+
+size_t bitset_view_t::findLast() const {
+	for (size_t word = wordCount(); word-- > 0; ) {
+		const word_t value = paddedWord(word);
+		if (value != 0) return word * 64 + (63 - leadingZeros(value));
+	}
+	return bitset_t::npos;
+}
+
+size_t bitset_view_t::findPrev(const size_t index) const {
+	if (index >= bitLength) return findLast();
+	if (index == 0) return bitset_t::npos;
+	size_t word = (index - 1) / 64;
+	const size_t offset = (index - 1) % 64;
+	word_t rest = paddedWord(word) & ((offset == 63) ? ~(word_t)0 : (((word_t)1 << (offset + 1)) - 1));
+	while (rest == 0) {
+		if (word-- == 0) return bitset_t::npos;
+		rest = paddedWord(word);
+	}
+	return word * 64 + (63 - leadingZeros(rest));
+}
+
+std::string bitset_view_t::toBinaryString(const std::string delimiter) const {
+	if (delimiter.empty() || bitLength == 0) return encodeBitset(*this);
+	const std::string digits = encodeBitset(*this);
+	std::string temp;
+	temp.reserve(bitLength + (bitLength - 1) * delimiter.size());
+	temp += digits[0];
+	for (size_t index = 1; index < bitLength; ++index) {
+		temp += delimiter;
+		temp += digits[index];
+	}
+	return temp;
+}
+
+
+
+//   ######   #######  ##     ## ########     ###    ########  ########
+//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+bool operator==(const bitset_view_t& left, const bitset_view_t& right) {
+	if (left.length() != right.length()) return false;
+	const size_t full = left.commonWords(), words = left.wordCount();
+	for (size_t index = 0; index < full; ++index)
+		if (left.word(index) != right.word(index)) return false;
+	return full == words || left.paddedWord(full) == right.paddedWord(full);
+}
+
+bool operator==(const bitset_view_t& left, const bitset_t& right) {
+	return left == bitset_view_t(right);
+}
+
+bool operator==(const bitset_t& left, const bitset_view_t& right) {
+	return bitset_view_t(left) == right;
+}
+
+bool operator!=(const bitset_view_t& left, const bitset_view_t& right) {
+	return !(left == right);
+}
+
+bool operator!=(const bitset_view_t& left, const bitset_t& right) {
+	return !(left == right);
+}
+
+bool operator!=(const bitset_t& left, const bitset_view_t& right) {
+	return !(left == right);
+}
+
+std::ostream& operator<<(std::ostream& os, const bitset_view_t& view) {
+	writeBitset(os, view);
+	return os;
+}
@@ -0,0 +1,276 @@
+/**
+ * @file bitset_view.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `bitset_view_t` class
+ */
+
+#ifndef bitlib___bitset_view_h
+#define bitlib___bitset_view_h
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <ostream>
+#include "bit_type.h"
+#include "bitset_type.h"
+
+/**
+ * @brief Read-only view of bits stored in external memory
+ *
+ * @details Refers to @c length bits starting at bit @c offset of an array of 64-bit words laid out as the storage of `bitset_t` (bit @c i in the word @c i / 64 at the position @c i % 64), e.g. a bitmap in shared memory, in a network buffer or in another bitset, and reads them in place, without copying. The offset need not be word-aligned: misaligned words are assembled from two neighbouring storage words with a funnel shift when read.
+ *
+ * A view is an expression leaf (see bitset_expression.h), so it takes part in the bitwise operators together with bitsets and other views, and converts to a `bitset_t` when a copy is needed:
+ * @code
+ *	bitset_t owned = view;			// Copies the viewed bits
+ *	bitset_t both = view & someBitset;	// Single pass, no temporaries
+ *	size_t common = (view & other).count();	// Nothing is stored
+ * @endcode
+ * Views are cheap to copy (a pointer and two sizes) and are passed by value.
+ *
+ * @warning The view neither owns nor copies the memory: the storage <b>must outlive the view</b>, and a view of a `bitset_t` is invalidated by any operation which changes the length of that bitset.
+ * @note Bits of the storage words outside of the view are never read into the result, and storage words entirely outside of the view are never read at all.
+ * @note Arrays of `bool` hold a byte per bit, thus they cannot be viewed as packed words; construct a `bitset_t` from them instead.
+ *
+ * Example usage:
+ * @code
+ *	// Bitmap received into a buffer of words, after a 3-bit header
+ *	const uint64_t* payload = (const uint64_t*)buffer;
+ *	bitset_view_t received(payload, bitCount, 3);
+ *
+ *	// Operate on it in place
+ *	bitset_t missing = expected & ~received;
+ * @endcode
+ */
+class bitset_view_t : public bitset_expression_t<bitset_view_t> {
+public:
+	/**
+	 * @brief Storage word type, same as @ref bitset_t::word_t
+	 */
+	typedef bitset_t::word_t word_t;
+
+	/**
+	 * @brief Word @c i of a view reads two storage words when the view does not start at a word boundary, see bitset_expression_t
+	 */
+	static const bool wordLocal = false;
+private:
+	/**
+	 * @brief Storage word holding the first bit of the view
+	 */
+	const word_t* head;
+
+	/**
+	 * @brief Position of the first bit of the view in @ref head
+	 */
+	size_t shift;
+
+	/**
+	 * @brief Length of the view, in bits
+	 */
+	size_t bitLength;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Default empty `bitset_view_t` constructor
+	 *
+	 * @details Initialises a view of zero length, which refers to no memory.
+	 */
+	bitset_view_t();
+
+	/**
+	 * @brief External memory `bitset_view_t` constructor
+	 *
+	 * @param [in] words Pointer to the storage words.
+	 * @param [in] length Number of bits in the view.
+	 * @param [in] offset Index of the first bit of the view in the storage, not necessarily a multiple of 64.
+	 *
+	 * @warning The storage must hold at least @p offset + @p length bits, and <b>must outlive the view</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// View bits 10..109 of a shared memory segment
+	 *	bitset_view_t slice((const uint64_t*)segment, 100, 10);
+	 * @endcode
+	 */
+	bitset_view_t(const word_t* words, const size_t length, const size_t offset = 0);
+
+	/**
+	 * @brief `bitset_t` view constructor
+	 *
+	 * @details Views the whole @p bits bitset; implicit, so that bitsets are accepted wherever views are.
+	 *
+	 * @param [in] bits Bitset to view.
+	 *
+	 * @warning The view is invalidated by any operation which changes the length of @p bits.
+	 */
+	bitset_view_t(const bitset_t& bits);
+
+	/**
+	 * @brief `bitset_t` range view constructor
+	 *
+	 * @param [in] bits Bitset to view.
+	 * @param [in] offset Index of the first bit of @p bits in the view.
+	 * @param [in] length Number of bits in the view.
+	 *
+	 * @throw std::out_of_range If the range exceeds the length of @p bits.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Second half of a bitset, without copying it
+	 *	bitset_view_t half(someBitset, someBitset.length() / 2, someBitset.length() - someBitset.length() / 2);
+	 * @endcode
+	 */
+	bitset_view_t(const bitset_t& bits, const size_t offset, const size_t length);
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns length of the view
+	 */
+	size_t length() const {
+		return bitLength;
+	}
+
+	/**
+	 * @brief Tests whether the view is empty
+	 */
+	bool empty() const;
+
+	/**
+	 * @brief Returns the number of words the viewed bits occupy when packed from bit zero, as in a `bitset_t`
+	 */
+	size_t wordCount() const {
+		return (bitLength + 63) / 64;
+	}
+
+	/**
+	 * @brief Returns the number of full words of the view, which are read by word()
+	 */
+	size_t commonWords() const {
+		return bitLength / 64;
+	}
+
+	/**
+	 * @brief Returns bits 64 * @p index to 64 * @p index + 63 of the view, packed into a word
+	 *
+	 * @warning @p index must be less than commonWords(); use paddedWord() for the last partial word.
+	 */
+	word_t word(const size_t index) const {
+		return (shift == 0) ? head[index] : (head[index] >> shift) | (head[index + 1] << (64 - shift));
+	}
+
+	/**
+	 * @brief Returns word @p index of the view with the bits past length() reset
+	 *
+	 * @details Unlike word(), does not read storage words past the last bit of the view.
+	 */
+	word_t paddedWord(const size_t index) const;
+
+	/**
+	 * @brief Returns view of @p length bits starting at bit @p offset of this view
+	 *
+	 * @throw std::out_of_range If the range exceeds length().
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Skip a 16-bit header
+	 *	bitset_view_t body = packet.subview(16, packet.length() - 16);
+	 * @endcode
+	 */
+	bitset_view_t subview(const size_t offset, const size_t length) const;
+
+	/**
+	 * @brief Returns bit at position @p index
+	 *
+	 * @warning No bounds checking is performed.
+	 */
+	bit_t operator[](const size_t index) const;
+
+	/**
+	 * @brief Returns bit at position @p index with bounds checking
+	 *
+	 * @throw std::out_of_range If @p index is not less than length().
+	 */
+	bit_t at(const size_t index) const;
+
+	/**
+	 * @brief Returns the number of set bits in the view
+	 *
+	 * @details Counts word-aligned views with the popcount kernel selected by bitsetKernels() directly in the storage.
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Tests whether any bit of the view is set
+	 */
+	bool any() const;
+
+	/**
+	 * @brief Returns index of the first set bit, or @ref bitset_t::npos if no bit is set
+	 */
+	size_t findFirst() const;
+
+	/**
+	 * @brief Returns index of the first set bit after @p index, or @ref bitset_t::npos if there is none
+	 */
+	size_t findNext(const size_t index) const;
+
+	/**
+	 * @brief Returns index of the last set bit, or @ref bitset_t::npos if no bit is set
+	 */
+	size_t findLast() const;
+
+	/**
+	 * @brief Returns index of the last set bit before @p index, or @ref bitset_t::npos if there is none
+	 */
+	size_t findPrev(const size_t index) const;
+
+	/**
+	 * @brief Returns string with the binary representation of the view, see bitset_t::toBinaryString()
+	 */
+	std::string toBinaryString(const std::string delimiter = "") const;
+};
+
+/**
+ * @brief Equality test operator
+ *
+ * @details Views (and bitsets) are equal if they are of equal length and every bit of one equals the corresponding bit of the other, regardless of their offsets in the storage.
+ *
+ * Example usage:
+ * @code
+ *	// Compare a received bitmap with the expected one, in place
+ *	bool intact = (bitset_view_t(payload, expected.length()) == expected);
+ * @endcode
+ */
+bool operator==(const bitset_view_t& left, const bitset_view_t& right);
+bool operator==(const bitset_view_t& left, const bitset_t& right);
+bool operator==(const bitset_t& left, const bitset_view_t& right);
+
+/**
+ * @brief Unequality test operator, see operator==(const bitset_view_t&, const bitset_view_t&)
+ */
+bool operator!=(const bitset_view_t& left, const bitset_view_t& right);
+bool operator!=(const bitset_view_t& left, const bitset_t& right);
+bool operator!=(const bitset_t& left, const bitset_view_t& right);
+
+/**
+ * @brief Inserts the binary representation of @p view into @p os
+ */
+std::ostream& operator<<(std::ostream& os, const bitset_view_t& view);
+
+#endif
@@ -0,0 +1,423 @@
+/**
+ * @file ewah_bitset.cpp
+ * @implements ewah_bitset.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `ewah_bitset_t` class
+ */
+
+#include <iostream>
+#include <algorithm>
+
+#include "ewah_bitset.h"
+#include "bitset_kernels.h"
+#include "bit_c11_operators.h"
+
+
+
+//  ##     ##    ###    ########  ##    ## ######## ########   ######
+//  ###   ###   ## ##   ##     ## ##   ##  ##       ##     ## ##    ##
+//  #### ####  ##   ##  ##     ## ##  ##   ##       ##     ## ##
+//  ## ### ## ##     ## ########  #####    ######   ########   ######
+//  ##     ## ######### ##   ##   ##  ##   ##       ##   ##         ##
+//  ##     ## ##     ## ##    ##  ##   ##  ##       ##    ##  ##    ##
+//  ##     ## ##     ## ##     ## ##    ## ######## ##     ##  ######
+
+// Marker layout: bit 0 is the run value, bits 1..32 the run length, bits 33..63 the number of literal words
+static const size_t runLimit = 0xFFFFFFFFULL;
+static const size_t literalLimit = 0x7FFFFFFFULL;
+
+static bool markerBit(const uint64_t marker) {
+	return (marker & 1) != 0;
+}
+
+static size_t markerRun(const uint64_t marker) {
+	return (size_t)((marker >> 1) & runLimit);
+}
+
+static size_t markerLiterals(const uint64_t marker) {
+	return (size_t)(marker >> 33);
+}
+
+static uint64_t makeMarker(const bool bit, const size_t run, const size_t literals) {
+	return (uint64_t)bit | ((uint64_t)run << 1) | ((uint64_t)literals << 33);
+}
+
+static size_t wordsFor(const size_t length) {
+	return (length + 63) / 64;
+}
+
+static uint64_t fillOf(const bool bit) {
+	return bit ? ~(uint64_t)0 : 0;
+}
+
+void ewah_bitset_t::cursor_t::start(const uint64_t* stream, const size_t size) {
+	this->stream = stream;
+	this->size = size;
+	this->next = 0;
+	this->runLeft = 0;
+	this->runBit = false;
+	this->literalsLeft = 0;
+	load();
+}
+
+void ewah_bitset_t::cursor_t::load() {
+	while (runLeft == 0 && literalsLeft == 0 && next < size) {
+		const uint64_t marker = stream[next++];
+		runBit = markerBit(marker);
+		runLeft = markerRun(marker);
+		literalsLeft = markerLiterals(marker);
+	}
+}
+
+void ewah_bitset_t::cursor_t::skip(const size_t count) {
+	if (runLeft != 0) {
+		runLeft -= count;
+	} else {
+		literalsLeft -= count;
+		next += count;
+	}
+	load();
+}
+
+
+
+//   ######  ######## ########  ########    ###    ##     ##
+//  ##    ##    ##    ##     ## ##         ## ##   ###   ###
+//  ##          ##    ##     ## ##        ##   ##  #### ####
+//   ######     ##    ########  ######   ##     ## ## ### ##
+//        ##    ##    ##   ##   ##       ######### ##     ##
+//  ##    ##    ##    ##    ##  ##       ##     ## ##     ##
+//   ######     ##    ##     ## ######## ##     ## ##     ##
+
+void ewah_bitset_t::appendRun(const bool bit, size_t count) {
+	while (count > 0) {
+		if (!buffer.empty()) {
+			const uint64_t marker = buffer[lastMarker];
+			const size_t run = markerRun(marker);
+			if (markerLiterals(marker) == 0 && (run == 0 || markerBit(marker) == bit) && run < runLimit) {
+				const size_t taken = std::min(count, runLimit - run);
+				buffer[lastMarker] = makeMarker(bit, run + taken, 0);
+				count -= taken;
+				continue;
+			}
+		}
+		lastMarker = buffer.size();
+		buffer.push_back(makeMarker(bit, 0, 0));
+	}
+}
+
+void ewah_bitset_t::appendWord(const uint64_t word) {
+	if (word == 0 || word == ~(uint64_t)0) {
+		appendRun(word != 0, 1);
+		return;
+	}
+	if (buffer.empty() || markerLiterals(buffer[lastMarker]) == literalLimit) {
+		lastMarker = buffer.size();
+		buffer.push_back(makeMarker(false, 0, 0));
+	}
+	buffer[lastMarker] += (uint64_t)1 << 33;
+	buffer.push_back(word);
+}
+
+void ewah_bitset_t::clearTail() {
+	if (bitLength % 64 == 0 || buffer.empty()) return;
+	const uint64_t mask = ((uint64_t)1 << (bitLength % 64)) - 1;
+	const uint64_t marker = buffer[lastMarker];
+	if (markerLiterals(marker) != 0) {
+		buffer.back() &= mask;
+	} else if (markerBit(marker)) {
+		// A run of ones must not cover the unused bits of the last word
+		buffer[lastMarker] = makeMarker(true, markerRun(marker) - 1, 0);
+		appendWord(mask);
+	}
+}
+
+template <class Visit>
+void ewah_bitset_t::walk(const ewah_bitset_t& left, const ewah_bitset_t& right, Visit visit) {
+	cursor_t first, second;
+	first.start(left.buffer.data(), left.buffer.size());
+	second.start(right.buffer.data(), right.buffer.size());
+	while (!first.done()) {
+		// An exhausted stream continues as an endless run of zeros
+		const size_t firstSpan = first.runLeft ? first.runLeft : first.literalsLeft;
+		const size_t secondSpan = second.done() ? firstSpan : (second.runLeft ? second.runLeft : second.literalsLeft);
+		const size_t count = std::min(firstSpan, secondSpan);
+		const uint64_t* firstLiterals = first.runLeft ? nullptr : first.stream + first.next;
+		const uint64_t* secondLiterals = (second.done() || second.runLeft) ? nullptr : second.stream + second.next;
+		visit(count, firstLiterals, fillOf(first.runBit && first.runLeft), secondLiterals, fillOf(second.runBit && second.runLeft));
+		first.skip(count);
+		if (!second.done()) second.skip(count);
+	}
+}
+
+template <class Operation>
+ewah_bitset_t ewah_bitset_t::combine(const ewah_bitset_t& other) const {
+	Operation operation;
+	ewah_bitset_t result;
+	result.bitLength = bitLength;
+	walk(*this, other, [&](const size_t count, const uint64_t* left, const uint64_t leftFill, const uint64_t* right, const uint64_t rightFill) {
+		if (left == nullptr && right == nullptr) {
+			result.appendRun(operation(leftFill, rightFill) != 0, count);
+		} else if (left == nullptr || right == nullptr) {
+			// A run either absorbs the literals facing it (zeros for &, ones for |), or is applied to each of them
+			const uint64_t fill = left ? rightFill : leftFill;
+			const uint64_t* literals = left ? left : right;
+			const uint64_t zero = left ? operation((uint64_t)0, fill) : operation(fill, (uint64_t)0);
+			const uint64_t ones = left ? operation(~(uint64_t)0, fill) : operation(fill, ~(uint64_t)0);
+			if (zero == ones) {
+				result.appendRun(zero != 0, count);
+			} else {
+				for (size_t index = 0; index < count; ++index)
+					result.appendWord(left ? operation(literals[index], fill) : operation(fill, literals[index]));
+			}
+		} else {
+			for (size_t index = 0; index < count; ++index)
+				result.appendWord(operation(left[index], right[index]));
+		}
+	});
+	result.clearTail();
+	return result;
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+ewah_bitset_t::ewah_bitset_t() {
+	this->bitLength = 0;
+	this->lastMarker = 0;
+	return;
+}
+
+ewah_bitset_t::ewah_bitset_t(const size_t length) {
+	this->bitLength = length;
+	this->lastMarker = 0;
+	appendRun(false, wordsFor(length));
+	return;
+}
+
+ewah_bitset_t::ewah_bitset_t(const bitset_t& bits) {
+	this->bitLength = bits.length();
+	this->lastMarker = 0;
+	const bitset_t::word_t* head = bits.data();
+	for (size_t index = 0; index < bits.wordCount(); ++index)
+		appendWord(head[index]);
+	return;
+}
+
+ewah_bitset_t::const_iterator::const_iterator() : current(0), word(0), bitLength(0), index(0) {
+	cursor.start(nullptr, 0);
+	return;
+}
+
+
+
+//   ######     ###     ######  ########
+//  ##    ##   ## ##   ##    ##    ##
+//  ##        ##   ##  ##          ##
+//  ##       ##     ##  ######     ##
+//  ##       #########       ##    ##
+//  ##    ## ##     ## ##    ##    ##
+//   ######  ##     ##  ######     ##
+
+ewah_bitset_t::operator bitset_t() const {
+	bitset_t result;
+	result.resize(bitLength);
+	bitset_t::word_t* target = result.words.data();
+	for (size_t position = 0; position < buffer.size(); ) {
+		const uint64_t marker = buffer[position++];
+		const size_t run = markerRun(marker), literals = markerLiterals(marker);
+		if (markerBit(marker)) bitsetKernels().fillWords(target, run, ~(uint64_t)0);
+		target += run;
+		std::copy(buffer.begin() + position, buffer.begin() + position + literals, target);
+		target += literals;
+		position += literals;
+	}
+	return result;
+}
+
+
+
+//  #### ######## ######## ########     ###    ########  #######  ########   ######
+//   ##     ##    ##       ##     ##   ## ##      ##    ##     ## ##     ## ##    ##
+//   ##     ##    ##       ##     ##  ##   ##     ##    ##     ## ##     ## ##
+//   ##     ##    ######   ########  ##     ##    ##    ##     ## ########   ######
+//   ##     ##    ##       ##   ##   #########    ##    ##     ## ##   ##         ##
+//   ##     ##    ##       ##    ##  ##     ##    ##    ##     ## ##    ##  ##    ##
+//  ####    ##    ######## ##     ## ##     ##    ##     #######  ##     ##  ######
+
+void ewah_bitset_t::const_iterator::advance() {
+	if (current != 0) current &= current - 1;
+	while (current == 0) {
+		if (cursor.done()) {
+			index = bitLength;
+			return;
+		}
+		if (cursor.runLeft != 0 && !cursor.runBit) {
+			word += cursor.runLeft;
+			cursor.skip(cursor.runLeft);
+			continue;
+		}
+		current = (cursor.runLeft != 0) ? ~(uint64_t)0 : cursor.stream[cursor.next];
+		++word;
+		cursor.skip(1);
+	}
+	index = (word - 1) * 64 + trailingZeros(current);
+}
+
+ewah_bitset_t::const_iterator ewah_bitset_t::begin() const {
+	const_iterator it;
+	it.cursor.start(buffer.data(), buffer.size());
+	it.bitLength = bitLength;
+	it.advance();
+	return it;
+}
+
+ewah_bitset_t::const_iterator ewah_bitset_t::end() const {
+	const_iterator it;
+	it.bitLength = bitLength;
+	it.index = bitLength;
+	return it;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t ewah_bitset_t::length() const {
+	return bitLength;
+}
+
+size_t ewah_bitset_t::wordCount() const {
+	return buffer.size();
+}
+
+size_t ewah_bitset_t::count() const {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	size_t total = 0;
+	for (size_t position = 0; position < buffer.size(); ) {
+		const uint64_t marker = buffer[position++];
+		const size_t literals = markerLiterals(marker);
+		if (markerBit(marker)) total += 64 * markerRun(marker);
+		total += kernels.popcountWords(buffer.data() + position, literals);
+		position += literals;
+	}
+	return total;
+}
+
+void ewah_bitset_t::invert() {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	for (size_t position = 0; position < buffer.size(); ) {
+		const uint64_t marker = buffer[position];
+		const size_t literals = markerLiterals(marker);
+		buffer[position++] = marker ^ 1;
+		kernels.invertWords(buffer.data() + position, literals);
+		position += literals;
+	}
+	clearTail();
+}
+
+size_t hammingDistance(const ewah_bitset_t& left, const ewah_bitset_t& right) {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	size_t total = 0;
+	ewah_bitset_t::walk(left, right, [&](const size_t count, const uint64_t* first, const uint64_t firstFill, const uint64_t* second, const uint64_t secondFill) {
+		if (first == nullptr && second == nullptr) {
+			if (firstFill != secondFill) total += 64 * count;
+		} else if (first == nullptr || second == nullptr) {
+			const size_t ones = kernels.popcountWords(first ? first : second, count);
+			total += ((first ? secondFill : firstFill) != 0) ? 64 * count - ones : ones;
+		} else {
+			total += kernels.xorPopcountWords(first, second, count);
+		}
+	});
+	return total;
+}
+
+
+
+//  ##     ## ##    ##    ###    ########  ##    ##
+//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ## ####  ##  ##   ##  ##     ##   ####
+//  ##     ## ## ## ## ##     ## ########     ##
+//  ##     ## ##  #### ######### ##   ##      ##
+//  ##     ## ##   ### ##     ## ##    ##     ##
+//   #######  ##    ## ##     ## ##     ##    ##
+
+ewah_bitset_t ewah_bitset_t::operator~() const {
+	ewah_bitset_t temp(*this);
+	temp.invert();
+	return temp;
+}
+
+
+
+//  ########  #### ##    ##    ###    ########  ##    ##
+//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
+//  ########   ##  ## ## ## ##     ## ########     ##
+//  ##     ##  ##  ##  #### ######### ##   ##      ##
+//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
+//  ########  #### ##    ## ##     ## ##     ##    ##
+
+ewah_bitset_t ewah_bitset_t::operator^(const ewah_bitset_t& other) const {
+	return combine<bitwise_xor>(other);
+}
+
+ewah_bitset_t ewah_bitset_t::operator&(const ewah_bitset_t& other) const {
+	return combine<bitwise_and>(other);
+}
+
+ewah_bitset_t ewah_bitset_t::operator|(const ewah_bitset_t& other) const {
+	return combine<bitwise_or>(other);
+}
+
+
+
+//   ######   #######  ##     ## ########     ###    ########  ########
+//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+bool ewah_bitset_t::operator==(const ewah_bitset_t& other) const {
+	return bitLength == other.bitLength && hammingDistance(*this, other) == 0;
+}
+
+bool ewah_bitset_t::operator!=(const ewah_bitset_t& other) const {
+	return !(*this == other);
+}
+
+
+
+//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+std::string ewah_bitset_t::toBinaryString() const {
+	std::string temp(bitLength, '0');
+	for (const size_t index : *this)
+		temp[index] = '1';
+	return temp;
+}
+
+std::ostream& operator<<(std::ostream& os, const ewah_bitset_t& bits) {
+	return os << bits.toBinaryString();
+}
@@ -0,0 +1,529 @@
+/**
+ * @file ewah_bitset.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `ewah_bitset_t` class
+ */
+
+#ifndef bitlib___ewah_bitset_h
+#define bitlib___ewah_bitset_h
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "bitset_type.h"
+
+/**
+ * @brief Run-length compressed bitset type, stores a set of `bit_t` values of fixed length
+ *
+ * @details Enhanced Word-Aligned Hybrid bitset (Lemire, Kaser, Aouiche, "Sorting improves word-aligned bitmap indexes"). The bits are grouped into the 64-bit words of `bitset_t`, and the words are stored as a stream of markers, each followed by its literal words:
+ *	| Marker bits | Meaning                                                      |
+ *	|:-----------:|:-------------------------------------------------------------|
+ *	|0            |value of the run (all-zero or all-one words)                  |
+ *	|1..32        |number of words in the run                                    |
+ *	|33..63       |number of literal (mixed) words following the marker          |
+ * A million zero words take a single marker, so bitmaps made of long runs take space proportional to the number of runs and of mixed words rather than to their length.
+ *
+ * Logical operations walk both streams at once and never decompress them: two runs produce a run of the combined length, a run of zeros (for `&`) or ones (for `|`) absorbs the literals of the other stream without reading them, and only literal words facing literal words are combined one by one. Thus run time is proportional to the compressed sizes of the operands, not to length().
+ *
+ * Iterating a bitset yields the indices of its set bits, skipping zero runs in one step.
+ *
+ * Example usage:
+ * @code
+ *	// Compress two index bitmaps
+ *	ewah_bitset_t red(redRows), large(largeRows);
+ *
+ *	// Filter without decompressing, then visit matching rows
+ *	for (size_t row : red & large)
+ *		emit(row);
+ * @endcode
+ */
+class ewah_bitset_t {
+private:
+	/**
+	 * @brief Reading position within a compressed stream
+	 *
+	 * @details Tracks the words left in the current run and in the literal words following the current marker; the literal words are read from @ref stream at @ref next.
+	 */
+	struct cursor_t {
+		/**
+		 * @brief Compressed stream
+		 */
+		const uint64_t* stream;
+
+		/**
+		 * @brief Number of words in the compressed stream
+		 */
+		size_t size;
+
+		/**
+		 * @brief Position of the next stream word to read
+		 */
+		size_t next;
+
+		/**
+		 * @brief Words left in the current run
+		 */
+		size_t runLeft;
+
+		/**
+		 * @brief Value of the current run
+		 */
+		bool runBit;
+
+		/**
+		 * @brief Literal words left after the current run
+		 */
+		size_t literalsLeft;
+
+		/**
+		 * @brief Starts reading @p size words of @p stream
+		 */
+		void start(const uint64_t* stream, const size_t size);
+
+		/**
+		 * @brief Reads markers until a non-empty run or literal is found, or the stream ends
+		 */
+		void load();
+
+		/**
+		 * @brief Skips @p count words, which must not exceed the current run or literal words
+		 */
+		void skip(const size_t count);
+
+		/**
+		 * @brief Tests whether the stream is exhausted
+		 */
+		bool done() const {
+			return runLeft == 0 && literalsLeft == 0;
+		}
+	};
+public:
+
+	//  ######## ##    ## ########  ########  ######
+	//     ##     ##  ##  ##     ## ##       ##    ##
+	//     ##      ####   ##     ## ##       ##
+	//     ##       ##    ########  ######    ######
+	//     ##       ##    ##        ##             ##
+	//     ##       ##    ##        ##       ##    ##
+	//     ##       ##    ##        ########  ######
+
+	/**
+	 * @brief Forward iterator over the indices of the set bits
+	 *
+	 * @details Runs of zeros are skipped in one step, set bits of literal words are found with trailingZeros(), so a full traversal costs time proportional to the compressed size plus the number of set bits.
+	 */
+	class const_iterator {
+		friend class ewah_bitset_t;
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef size_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const size_t* pointer;
+		typedef size_t reference;
+	private:
+		/**
+		 * @brief Position within the compressed stream
+		 */
+		cursor_t cursor;
+
+		/**
+		 * @brief Remaining set bits of the current word
+		 */
+		uint64_t current;
+
+		/**
+		 * @brief Index of the current word
+		 */
+		size_t word;
+
+		/**
+		 * @brief Number of bits of the bitset
+		 */
+		size_t bitLength;
+
+		/**
+		 * @brief Index of the set bit the iterator points to, @ref bitLength at the end
+		 */
+		size_t index;
+
+		/**
+		 * @brief Moves to the next set bit
+		 */
+		void advance();
+	public:
+		const_iterator();
+
+		reference operator*() const {
+			return index;
+		}
+
+		const_iterator& operator++() {
+			advance();
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator temp = *this;
+			advance();
+			return temp;
+		}
+
+		friend bool operator==(const const_iterator& left, const const_iterator& right) {
+			return left.index == right.index;
+		}
+
+		friend bool operator!=(const const_iterator& left, const const_iterator& right) {
+			return left.index != right.index;
+		}
+	};
+
+	/**
+	 * @brief Type of the iterator, all iterators are `const`
+	 */
+	typedef const_iterator iterator;
+private:
+	/**
+	 * @brief Compressed stream of markers and literal words
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	std::vector<uint64_t> buffer;
+
+	/**
+	 * @brief Number of bits stored in the bitset
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	size_t bitLength;
+
+	/**
+	 * @brief Position of the last marker in @ref buffer
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	size_t lastMarker;
+
+	/**
+	 * @brief Appends a run of @p count words filled with @p bit
+	 */
+	void appendRun(const bool bit, size_t count);
+
+	/**
+	 * @brief Appends a single word, as a run if all its bits are equal
+	 */
+	void appendWord(const uint64_t word);
+
+	/**
+	 * @brief Resets the bits beyond @ref bitLength in the last word of the stream
+	 */
+	void clearTail();
+
+	/**
+	 * @brief Walks the word streams of @p left and @p right in step
+	 *
+	 * @details Invokes @p visit(count, leftLiterals, leftFill, rightLiterals, rightFill) for consecutive spans of @p count words, each of which is either a run of @p fill words (when the literals pointer is `nullptr`) or @p count literal words, in each stream. Words missing from the shorter stream are taken as zero; the walk stops after the words of @p left.
+	 */
+	template <class Visit>
+	static void walk(const ewah_bitset_t& left, const ewah_bitset_t& right, Visit visit);
+
+	/**
+	 * @brief Combines the word streams of `*this` and @p other with @p Operation
+	 *
+	 * @details The result has the length of `*this`.
+	 */
+	template <class Operation>
+	ewah_bitset_t combine(const ewah_bitset_t& other) const;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Default empty `ewah_bitset_t` constructor
+	 *
+	 * @details Initialises empty bitset (bitset with zero length and no elements).
+	 */
+	ewah_bitset_t();
+
+	/**
+	 * @brief Length `ewah_bitset_t` constructor
+	 *
+	 * @details Initialises bitset of @p length reset bits, stored as a single run.
+	 *
+	 * @param [in] length Number of bits in the bitset.
+	 */
+	explicit ewah_bitset_t(const size_t length);
+
+	/**
+	 * @brief `bitset_t` ewah_bitset_t constructor
+	 *
+	 * @details Compresses the words of @p bits. The result has the same length and bits as @p bits.
+	 *
+	 * @param [in] bits Bitset to compress.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Compress a bitset
+	 *	ewah_bitset_t someBitset(bitset_t({0, 1, 1, 0}));
+	 * @endcode
+	 */
+	explicit ewah_bitset_t(const bitset_t& bits);
+
+
+
+	//   ######     ###     ######  ########
+	//  ##    ##   ## ##   ##    ##    ##
+	//  ##        ##   ##  ##          ##
+	//  ##       ##     ##  ######     ##
+	//  ##       #########       ##    ##
+	//  ##    ## ##     ## ##    ##    ##
+	//   ######  ##     ##  ######     ##
+
+	/**
+	 * @brief Casts `ewah_bitset_t` to `bitset_t`
+	 *
+	 * @details Decompresses the bitset into a newly constructed bitset of the same length.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Decompress someBitset
+	 *	bitset_t dense = someBitset;
+	 * @endcode
+	 */
+	operator bitset_t() const;
+
+
+
+	//  #### ######## ######## ########     ###    ########  #######  ########   ######
+	//   ##     ##    ##       ##     ##   ## ##      ##    ##     ## ##     ## ##    ##
+	//   ##     ##    ##       ##     ##  ##   ##     ##    ##     ## ##     ## ##
+	//   ##     ##    ######   ########  ##     ##    ##    ##     ## ########   ######
+	//   ##     ##    ##       ##   ##   #########    ##    ##     ## ##   ##         ##
+	//   ##     ##    ##       ##    ##  ##     ##    ##    ##     ## ##    ##  ##    ##
+	//  ####    ##    ######## ##     ## ##     ##    ##     #######  ##     ##  ######
+
+	/**
+	 * @brief Returns iterator to the first set bit
+	 *
+	 * @return An iterator yielding the index of the first set bit, or end() if no bits are set.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Collect indices of the set bits
+	 *	std::vector<size_t> rows(someBitset.begin(), someBitset.end());
+	 * @endcode
+	 */
+	const_iterator begin() const;
+
+	/**
+	 * @brief Returns iterator past the last set bit
+	 */
+	const_iterator end() const;
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns the number of bits in the bitset
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns the number of bits in the bitset
+	 *
+	 * @see length()
+	 */
+	size_t size() const {
+		return length();
+	}
+
+	/**
+	 * @brief Returns the number of 64-bit words of the compressed stream
+	 *
+	 * @details Markers included; compare with bitset_t::wordCount() of the decompressed bitset.
+	 */
+	size_t wordCount() const;
+
+	/**
+	 * @brief Returns the number of set bits in the bitset
+	 *
+	 * @details Runs of ones are counted by their length, literal words with the popcount kernel selected by bitsetKernels().
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Inverts [complements] all bits in the bitset
+	 *
+	 * @details Flips the run values and the literal words of the stream in place.
+	 */
+	void invert();
+
+	/**
+	 * @brief Returns the number of bits at which @p left and @p right bitset are different
+	 *
+	 * @details Walks both streams like operator^(), counting instead of storing the result.
+	 *
+	 * @param left The first [left] bitset.
+	 * @param right The second [right] bitset.
+	 *
+	 * @return The number of bits at which @p left and @p right bitset are different.
+	 *
+	 * @warning @p left and @p right bitsets <b>must be of equal length</b>.
+	 */
+	friend size_t hammingDistance(const ewah_bitset_t& left, const ewah_bitset_t& right);
+
+
+
+	//  ##     ## ##    ##    ###    ########  ##    ##
+	//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
+	//  ##     ## ####  ##  ##   ##  ##     ##   ####
+	//  ##     ## ## ## ## ##     ## ########     ##
+	//  ##     ## ##  #### ######### ##   ##      ##
+	//  ##     ## ##   ### ##     ## ##    ##     ##
+	//   #######  ##    ## ##     ## ##     ##    ##
+
+	/**
+	 * @brief Calculates inverted bitset value
+	 *
+	 * @details Does not modify `*this` bitset.
+	 *
+	 * @return Inverted ewah_bitset_t value.
+	 *
+	 * @see invert()
+	 */
+	ewah_bitset_t operator~() const;
+
+
+
+	//  ########  #### ##    ##    ###    ########  ##    ##
+	//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
+	//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
+	//  ########   ##  ## ## ## ##     ## ########     ##
+	//  ##     ##  ##  ##  #### ######### ##   ##      ##
+	//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
+	//  ########  #### ##    ## ##     ## ##     ##    ##
+
+	/**
+	 * @brief Exclusive OR operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator^(), directly on the compressed streams.
+	 *
+	 * @param [in] other Second `ewah_bitset_t` operand.
+	 *
+	 * @return `ewah_bitset_t` value of the length of `*this`.
+	 *
+	 * @warning Bitsets <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = xor(X1, X2)
+	 *	ewah_bitset_t Y = X1 ^ X2;
+	 * @endcode
+	 */
+	ewah_bitset_t operator^(const ewah_bitset_t& other) const;
+
+	/**
+	 * @brief Conjunction operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator&(), directly on the compressed streams. Literal words facing a run of zeros are skipped unread.
+	 *
+	 * @param [in] other Second `ewah_bitset_t` operand.
+	 *
+	 * @return `ewah_bitset_t` value of the length of `*this`.
+	 *
+	 * @warning Bitsets <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = X1 & X2
+	 *	ewah_bitset_t Y = X1 & X2;
+	 * @endcode
+	 */
+	ewah_bitset_t operator&(const ewah_bitset_t& other) const;
+
+	/**
+	 * @brief Disjunction operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator|(), directly on the compressed streams. Literal words facing a run of ones are skipped unread.
+	 *
+	 * @param [in] other Second `ewah_bitset_t` operand.
+	 *
+	 * @return `ewah_bitset_t` value of the length of `*this`.
+	 *
+	 * @warning Bitsets <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = X1 | X2
+	 *	ewah_bitset_t Y = X1 | X2;
+	 * @endcode
+	 */
+	ewah_bitset_t operator|(const ewah_bitset_t& other) const;
+
+
+
+	//   ######   #######  ##     ## ########     ###    ########  ########
+	//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+	//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+	//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+	//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+	//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+	//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+	/**
+	 * @brief Equal to operator
+	 *
+	 * @details Bitsets are equal when they have the same length and the same bits set.
+	 */
+	bool operator==(const ewah_bitset_t& other) const;
+
+	/**
+	 * @brief Not equal to operator
+	 */
+	bool operator!=(const ewah_bitset_t& other) const;
+
+
+
+	//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+	//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+	//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+	//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+	//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+	//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+	//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+	/**
+	 * @brief Returns string with the binary representation of the bitset
+	 *
+	 * @return `std::string` containing the binary bit representation.
+	 */
+	std::string toBinaryString() const;
+
+	/**
+	 * @brief Inserts @p bits binary representation into @p os
+	 *
+	 * @details Insertion is performed with toBinaryString() method.
+	 *
+	 * @param [in,out] os An `std::ostream` which method is invoked upon.
+	 * @param [in] bits Bitset to be inserted.
+	 *
+	 * @return Modified `std::ostream` stream.
+	 */
+	friend std::ostream& operator<<(std::ostream& os, const ewah_bitset_t& bits);
+};
+
+#endif
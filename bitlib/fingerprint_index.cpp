@@ -0,0 +1,231 @@
+/**
+ * @file fingerprint_index.cpp
+ * @implements fingerprint_index.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `fingerprint_index_t` class
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "fingerprint_index.h"
+#include "bitset_kernels.h"
+#include "hamming_batch.h"
+
+
+
+//  ########  ########   #######  ########  ########  ######
+//  ##     ## ##     ## ##     ## ##     ## ##       ##    ##
+//  ##     ## ##     ## ##     ## ##     ## ##       ##
+//  ########  ########  ##     ## ########  ######    ######
+//  ##        ##   ##   ##     ## ##     ## ##             ##
+//  ##        ##    ##  ##     ## ##     ## ##       ##    ##
+//  ##        ##     ##  #######  ########  ########  ######
+
+// Widest substring, so that the probes of one distance can be enumerated in a 64-bit mask
+static const size_t maxSubstringBits = 32;
+
+// Relative cost of checking a probed candidate against a scanned fingerprint
+static const size_t candidateCost = 16;
+
+// Strict weak order of the neighbours: closer first, then lower identifier first
+static bool closer(const neighbour_t& left, const neighbour_t& right) {
+	return (left.distance < right.distance) || (left.distance == right.distance && left.id < right.id);
+}
+
+// Number of @p width-bit values at distance @p radius from a given value, saturated at @p limit
+static size_t probesAt(const size_t width, const size_t radius, const size_t limit) {
+	if (radius > width) return 0;
+	size_t result = 1;
+	for (size_t step = 1; step <= radius; ++step) {
+		// C(width, step) = C(width, step - 1) * (width - step + 1) / step, exact at every step
+		const size_t factor = width - step + 1;
+		if (result > limit / factor) return limit;
+		result = result * factor / step;
+	}
+	return std::min(result, limit);
+}
+
+/**
+ * @brief Invokes @p probe for every @p width-bit value at distance @p radius from @p key
+ *
+ * @details Flip masks of @p radius set bits are enumerated in increasing order with Gosper's hack.
+ */
+template <class Probe>
+static void forEachProbe(const uint64_t key, const size_t width, const size_t radius, Probe probe) {
+	if (radius == 0) {
+		probe(key);
+		return;
+	}
+	const uint64_t limit = (uint64_t)1 << width;
+	for (uint64_t mask = ((uint64_t)1 << radius) - 1; mask < limit; ) {
+		probe(key ^ mask);
+		const uint64_t lowest = mask & (~mask + 1), ripple = mask + lowest;
+		mask = (((ripple ^ mask) >> 2) / lowest) | ripple;
+	}
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+fingerprint_index_t::fingerprint_index_t(const size_t length, const size_t substrings) {
+	size_t count = substrings ? substrings : substringsFor(length, 1 << 20);
+	count = std::max(count, (length + maxSubstringBits - 1) / maxSubstringBits);
+	count = std::max<size_t>(std::min(count, length), 1);
+
+	this->bitLength = length;
+	this->words = (length + 63) / 64;
+	this->entries = 0;
+	this->bounds.resize(count + 1);
+	for (size_t substring = 0; substring <= count; ++substring)
+		this->bounds[substring] = substring * length / count;
+	this->tables.resize(count);
+	return;
+}
+
+size_t fingerprint_index_t::substringsFor(const size_t length, const size_t expectedCount) {
+	size_t bits = 0;
+	while (bits < 63 && ((size_t)1 << (bits + 1)) <= expectedCount) ++bits;
+	bits = std::max<size_t>(std::min(bits, maxSubstringBits), 8);
+	return std::max<size_t>((length + bits - 1) / bits, 1);
+}
+
+
+
+//  #### ##    ## ######## ######## ########  ######## ########  ######  ########
+//   ##  ###   ##    ##    ##       ##     ## ##       ##       ##    ## ##
+//   ##  ####  ##    ##    ##       ##     ## ##       ##       ##       ##
+//   ##  ## ## ##    ##    ######   ########  ######   ######   ##       ######
+//   ##  ##  ####    ##    ##       ##   ##   ##       ##       ##       ##
+//   ##  ##   ###    ##    ##       ##    ##  ##       ##       ##    ## ##
+//  #### ##    ##    ##    ######## ##     ## ##       ##        ######  ########
+
+uint64_t fingerprint_index_t::substringOf(const uint64_t* head, const size_t substring) const {
+	const size_t first = bounds[substring], width = bounds[substring + 1] - first;
+	if (width == 0) return 0;
+	const size_t word = first / 64, shift = first % 64;
+	uint64_t value = head[word] >> shift;
+	if (shift + width > 64)
+		value |= head[word + 1] << (64 - shift);
+	return value & (((uint64_t)1 << width) - 1);
+}
+
+bool fingerprint_index_t::firstProbe(const uint64_t* code, const uint64_t* keys, const size_t radius, const size_t substring) const {
+	// Substrings are probed in the order of growing distance, and in the order of tables at the same distance
+	const bitset_kernels_t& kernels = bitsetKernels();
+	for (size_t other = 0; other < tables.size(); ++other) {
+		if (other == substring) continue;
+		const uint64_t difference = substringOf(code, other) ^ keys[other];
+		const size_t distance = kernels.popcountWords(&difference, 1);
+		if (distance < radius || (distance == radius && other < substring))
+			return false;
+	}
+	return true;
+}
+
+std::vector<neighbour_t> fingerprint_index_t::scan(const uint64_t* query, const size_t k) const {
+	std::vector<size_t> distances(size());
+	hammingDistances(query, codes.data(), size(), words, distances.data());
+	std::vector<neighbour_t> result(size());
+	for (size_t id = 0; id < size(); ++id)
+		result[id] = neighbour_t{id, distances[id]};
+	std::partial_sort(result.begin(), result.begin() + k, result.end(), closer);
+	result.resize(k);
+	return result;
+}
+
+size_t fingerprint_index_t::insert(const bitset_t& fingerprint) {
+	if (fingerprint.length() != bitLength)
+		throw std::invalid_argument("fingerprint_index_t::insert: fingerprint length differs from the index length");
+	const size_t id = size();
+	if (id > (size_t)UINT32_MAX)
+		throw std::length_error("fingerprint_index_t::insert: too many fingerprints");
+
+	codes.insert(codes.end(), fingerprint.data(), fingerprint.data() + words);
+	const uint64_t* head = codes.data() + id * words;
+	for (size_t substring = 0; substring < tables.size(); ++substring)
+		tables[substring][substringOf(head, substring)].push_back((uint32_t)id);
+	++entries;
+	return id;
+}
+
+size_t fingerprint_index_t::size() const {
+	return entries;
+}
+
+size_t fingerprint_index_t::length() const {
+	return bitLength;
+}
+
+size_t fingerprint_index_t::substrings() const {
+	return tables.size();
+}
+
+std::vector<neighbour_t> fingerprint_index_t::nearest(const bitset_t& query, size_t k) const {
+	if (query.length() != bitLength)
+		throw std::invalid_argument("fingerprint_index_t::nearest: query length differs from the index length");
+	const size_t count = size();
+	k = std::min(k, count);
+	if (k == 0) return std::vector<neighbour_t>();
+
+	const bitset_kernels_t& kernels = bitsetKernels();
+	const uint64_t* head = query.data();
+	const size_t tableCount = tables.size();
+	std::vector<uint64_t> keys(tableCount);
+	for (size_t substring = 0; substring < tableCount; ++substring)
+		keys[substring] = substringOf(head, substring);
+
+	// Max-heap of the best k neighbours found so far, the worst of them on top
+	std::vector<neighbour_t> best;
+	best.reserve(k + 1);
+	size_t widest = 0;
+	for (size_t substring = 0; substring < tableCount; ++substring)
+		widest = std::max(widest, bounds[substring + 1] - bounds[substring]);
+
+	for (size_t radius = 0; radius <= widest; ++radius) {
+		// Scanning costs a popcount per fingerprint, probing costs a lookup per value plus a random fetch per candidate
+		double cost = 0;
+		for (size_t substring = 0; substring < tableCount; ++substring) {
+			const size_t width = bounds[substring + 1] - bounds[substring];
+			cost += (double)probesAt(width, radius, count) * candidateCost * (1 + (count >> width));
+		}
+		if (cost >= count || k * candidateCost >= count)
+			return scan(head, k);
+
+		for (size_t substring = 0; substring < tableCount; ++substring) {
+			const std::unordered_map<uint64_t, std::vector<uint32_t> >& table = tables[substring];
+			forEachProbe(keys[substring], bounds[substring + 1] - bounds[substring], radius, [&](const uint64_t key) {
+				std::unordered_map<uint64_t, std::vector<uint32_t> >::const_iterator bucket = table.find(key);
+				if (bucket == table.end()) return;
+				for (const uint32_t id : bucket->second) {
+					const uint64_t* code = codes.data() + (size_t)id * words;
+					const neighbour_t candidate = {id, kernels.xorPopcountWords(head, code, words)};
+					if (best.size() == k && !closer(candidate, best.front())) continue;
+					if (!firstProbe(code, keys.data(), radius, substring)) continue;
+					best.push_back(candidate);
+					std::push_heap(best.begin(), best.end(), closer);
+					if (best.size() > k) {
+						std::pop_heap(best.begin(), best.end(), closer);
+						best.pop_back();
+					}
+				}
+			});
+
+			// Unseen fingerprints differ by more than radius in substrings [0, substring] and by at least radius in the rest
+			const size_t bound = tableCount * radius + substring + 1;
+			if (best.size() == k && best.front().distance < bound) {
+				std::sort_heap(best.begin(), best.end(), closer);
+				return best;
+			}
+		}
+	}
+	std::sort_heap(best.begin(), best.end(), closer);
+	return best;
+}
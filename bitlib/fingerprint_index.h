@@ -0,0 +1,196 @@
+/**
+ * @file fingerprint_index.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `fingerprint_index_t` class
+ */
+
+#ifndef bitlib___fingerprint_index_h
+#define bitlib___fingerprint_index_h
+
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include "bitset_type.h"
+
+/**
+ * @brief Result of the nearest neighbour search
+ */
+struct neighbour_t {
+	/**
+	 * @brief Identifier of the fingerprint, as returned by fingerprint_index_t::insert()
+	 */
+	size_t id;
+
+	/**
+	 * @brief Hamming distance from the query to the fingerprint
+	 */
+	size_t distance;
+};
+
+/**
+ * @brief Collection of equal-length fingerprints, searchable by Hamming distance
+ *
+ * @details Answers "which @c k fingerprints are closest to the query" without scanning the whole collection, using multi-index hashing (Norouzi, Punjani, Fleet, "Fast Search in Hamming Space with Multi-Index Hashing"). Every fingerprint is split into @c m disjoint substrings and each substring is indexed in its own hash table. By the pigeonhole principle, a fingerprint within distance @c r of the query has at least one substring within distance @c r / @c m of the corresponding query substring, so the search probes substrings at growing distance @c s from the query ones, and stops as soon as the @c k-th best distance found is smaller than @c m * @c s plus the number of tables already probed at that distance: no fingerprint which has not been seen yet can be closer.
+ *
+ * Fingerprints are stored packed back to back, candidates are scored with the xor-popcount kernel selected by bitsetKernels(). When the probes of the next distance would outnumber the fingerprints, the search falls back to a linear scan.
+ *
+ * @note Substrings should be about log2 of the collection size bits wide; see substringsFor().
+ * @note Const methods may be invoked concurrently; insert() must not run concurrently with anything else.
+ *
+ * Example usage:
+ * @code
+ *	// Index 64-bit fingerprints
+ *	fingerprint_index_t index(64, fingerprint_index_t::substringsFor(64, 1000000));
+ *	for (const bitset_t& fingerprint : corpus)
+ *		index.insert(fingerprint);
+ *
+ *	// Find 10 nearest fingerprints
+ *	std::vector<neighbour_t> nearest = index.nearest(query, 10);
+ * @endcode
+ */
+class fingerprint_index_t {
+private:
+	/**
+	 * @brief Length of every fingerprint, in bits
+	 */
+	size_t bitLength;
+
+	/**
+	 * @brief Number of words per fingerprint
+	 */
+	size_t words;
+
+	/**
+	 * @brief Number of fingerprints in the index
+	 */
+	size_t entries;
+
+	/**
+	 * @brief First bit of every substring, followed by @ref bitLength
+	 */
+	std::vector<size_t> bounds;
+
+	/**
+	 * @brief Packed fingerprints, @ref words words each, in the order of insertion
+	 */
+	std::vector<uint64_t> codes;
+
+	/**
+	 * @brief One hash table per substring, mapping substring value to identifiers of the fingerprints
+	 */
+	std::vector<std::unordered_map<uint64_t, std::vector<uint32_t> > > tables;
+
+	/**
+	 * @brief Returns value of the @p substring of the fingerprint stored at @p head
+	 */
+	uint64_t substringOf(const uint64_t* head, const size_t substring) const;
+
+	/**
+	 * @brief Tests whether the probe of @p substring at distance @p radius is the first one to reach fingerprint @p code
+	 *
+	 * @details Lets the search skip fingerprints already scored, without remembering which ones were seen.
+	 */
+	bool firstProbe(const uint64_t* code, const uint64_t* keys, const size_t radius, const size_t substring) const;
+
+	/**
+	 * @brief Returns @p k nearest neighbours of @p query found by the linear scan
+	 */
+	std::vector<neighbour_t> scan(const uint64_t* query, const size_t k) const;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Empty index constructor
+	 *
+	 * @param [in] length Length of the fingerprints, in bits.
+	 * @param [in] substrings Number of substrings (hash tables) @c m; `0` picks the value of substringsFor() for a million fingerprints.
+	 *
+	 * @note Substrings are at most 32 bits wide, thus at least @p length / 32 (rounded up) substrings are used.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Index 256-bit fingerprints with 8 substrings of 32 bits
+	 *	fingerprint_index_t index(256, 8);
+	 * @endcode
+	 */
+	fingerprint_index_t(const size_t length, const size_t substrings = 0);
+
+	/**
+	 * @brief Returns recommended number of substrings
+	 *
+	 * @details Substrings of about log2(@p expectedCount) bits keep the buckets small, so that most probes return a few candidates.
+	 *
+	 * @param [in] length Length of the fingerprints, in bits.
+	 * @param [in] expectedCount Expected number of fingerprints in the index.
+	 *
+	 * @return Number of substrings to pass to the constructor.
+	 */
+	static size_t substringsFor(const size_t length, const size_t expectedCount);
+
+
+
+	//  #### ##    ## ######## ######## ########  ######## ########  ######  ########
+	//   ##  ###   ##    ##    ##       ##     ## ##       ##       ##    ## ##
+	//   ##  ####  ##    ##    ##       ##     ## ##       ##       ##       ##
+	//   ##  ## ## ##    ##    ######   ########  ######   ######   ##       ######
+	//   ##  ##  ####    ##    ##       ##   ##   ##       ##       ##       ##
+	//   ##  ##   ###    ##    ##       ##    ##  ##       ##       ##    ## ##
+	//  #### ##    ##    ##    ######## ##     ## ##       ##        ######  ########
+
+	/**
+	 * @brief Adds @p fingerprint to the index
+	 *
+	 * @param [in] fingerprint Fingerprint to add.
+	 *
+	 * @return Identifier of the fingerprint: the number of fingerprints inserted before it.
+	 *
+	 * @throw std::invalid_argument If @p fingerprint length differs from the length of the index.
+	 * @throw std::length_error If the index already holds 2^32 fingerprints.
+	 */
+	size_t insert(const bitset_t& fingerprint);
+
+	/**
+	 * @brief Returns the number of fingerprints in the index
+	 */
+	size_t size() const;
+
+	/**
+	 * @brief Returns the length of the fingerprints, in bits
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns the number of substrings (hash tables) of the index
+	 */
+	size_t substrings() const;
+
+	/**
+	 * @brief Finds @p k fingerprints closest to @p query
+	 *
+	 * @param [in] query Fingerprint to search for.
+	 * @param [in] k Number of neighbours to return.
+	 *
+	 * @return Up to @p k neighbours, ordered by distance and then by identifier.
+	 *
+	 * @throw std::invalid_argument If @p query length differs from the length of the index.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Find the closest fingerprint
+	 *	std::vector<neighbour_t> nearest = index.nearest(query, 1);
+	 *	if (!nearest.empty() && nearest[0].distance <= 3)
+	 *		markDuplicate(nearest[0].id);
+	 * @endcode
+	 */
+	std::vector<neighbour_t> nearest(const bitset_t& query, const size_t k) const;
+};
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file hamming_batch.cpp
+ * @implements hamming_batch.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the batched Hamming distance and scalar product routines
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "hamming_batch.h"
+#include "bitset_kernels.h"
+#include "bitset_parallel.h"
+
+
+
+//  ########  ##        #######   ######  ##    ##  ######
+//  ##     ## ##       ##     ## ##    ## ##   ##  ##    ##
+//  ##     ## ##       ##     ## ##       ##  ##   ##
+//  ########  ##       ##     ## ##       #####     ######
+//  ##     ## ##       ##     ## ##       ##  ##         ##
+//  ##     ## ##       ##     ## ##    ## ##   ##  ##    ##
+//  ########  ########  #######   ######  ##    ##  ######
+
+// Fingerprints are scanned in blocks of about this many bytes, so that a block stays in L2 cache while all
+// queries are scored against it
+static const size_t blockBytes = 128 * 1024;
+
+static size_t blockRowsFor(const size_t words) {
+	const size_t rows = blockBytes / (sizeof(uint64_t) * std::max<size_t>(words, 1));
+	return std::max<size_t>(16, std::min<size_t>(rows, 4096));
+}
+
+/**
+ * @brief Scores the cells [@p firstCell, @p lastCell) of the row-major matrix of @p count columns at @p distances
+ *
+ * @details @p queryAt and @p rowAt map an index to the pointer to the words of the query or fingerprint. Fingerprints are loaded a block at a time and scored against every query of the range while they are in cache; the first and the last query score only the columns of the range.
+ */
+template <class QueryAt, class RowAt>
+static void scoreCells(QueryAt queryAt, RowAt rowAt, const size_t count, const size_t words,
+		       const size_t firstCell, const size_t lastCell, size_t* distances) {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	const size_t firstQuery = firstCell / count, lastQuery = (lastCell + count - 1) / count;
+	const size_t firstColumn = firstCell % count, lastColumn = (lastCell - 1) % count + 1;
+	// A range within one query scores only its columns, a range over several queries every column
+	const size_t firstRow = (lastQuery - firstQuery == 1) ? firstColumn : 0, lastRow = (lastQuery - firstQuery == 1) ? lastColumn : count;
+	const size_t block = blockRowsFor(words);
+	std::vector<const uint64_t*> rows(std::min(block, lastRow - firstRow));
+	for (size_t first = firstRow; first < lastRow; first += block) {
+		const size_t rowCount = std::min(block, lastRow - first);
+		for (size_t row = 0; row < rowCount; ++row)
+			rows[row] = rowAt(first + row);
+		for (size_t query = firstQuery; query < lastQuery; ++query) {
+			const size_t from = std::max(first, (query == firstQuery) ? firstColumn : 0);
+			const size_t to = std::min(first + rowCount, (query + 1 == lastQuery) ? lastColumn : count);
+			if (from < to) kernels.xorPopcountRows(queryAt(query), rows.data() + (from - first), to - from, words, distances + query * count + from);
+		}
+	}
+}
+
+/**
+ * @brief Scores @p queryCount queries against @p count fingerprints, split across the shared pool
+ *
+ * @details The cells of @p distances are split as a single range, so that every range starts at a cache line boundary whatever the number of columns, and no two threads write the same line. A few queries against many fingerprints split the fingerprints, each range scoring its columns of every query; many queries split into ranges of whole rows.
+ */
+template <class QueryAt, class RowAt>
+static void scoreAll(QueryAt queryAt, const size_t queryCount, RowAt rowAt, const size_t count,
+		     const size_t words, size_t* distances) {
+	if (queryCount == 0 || count == 0) return;
+	parallelForWords(distances, queryCount * count, [&](const size_t first, const size_t last) {
+		if (first < last) scoreCells(queryAt, rowAt, count, words, first, last, distances);
+		return (size_t)0;
+	}, std::max<size_t>(words, 1));
+}
+
+/**
+ * @brief Multiplies @p vector with @p count rows, 64 rows per word of @p products
+ *
+ * @details The words of @p products are split across the shared pool at cache line boundaries, so that no two threads write the same line.
+ */
+template <class RowAt>
+static void multiplyAll(const uint64_t* vector, RowAt rowAt, const size_t count, const size_t words, uint64_t* products) {
+	parallelForWords(products, (count + 63) / 64, [&](const size_t first, const size_t last) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		const uint64_t* rows[64];
+		for (size_t group = first; group < last; ++group) {
+			const size_t firstRow = group * 64, rowCount = std::min<size_t>(64, count - firstRow);
+			for (size_t row = 0; row < rowCount; ++row)
+				rows[row] = rowAt(firstRow + row);
+			kernels.andParityRows(vector, rows, rowCount, words, products + group);
+		}
+		return (size_t)0;
+	}, 64 * std::max<size_t>(words, 1));
+}
+
+static void checkLengths(const size_t length, const bitset_t* bitsets, const size_t count) {
+	for (size_t index = 0; index < count; ++index)
+		if (bitsets[index].length() != length)
+			throw std::invalid_argument("hamming_batch: fingerprints must be of equal length");
+}
+
+
+
+//  ########     ###    ########  ######  ##     ##
+//  ##     ##   ## ##      ##    ##    ## ##     ##
+//  ##     ##  ##   ##     ##    ##       ##     ##
+//  ########  ##     ##    ##    ##       #########
+//  ##     ## #########    ##    ##       ##     ##
+//  ##     ## ##     ##    ##    ##    ## ##     ##
+//  ########  ##     ##    ##     ######  ##     ##
+
+void hammingDistances(const bitset_t& query, const bitset_t* fingerprints, const size_t count, size_t* distances) {
+	checkLengths(query.length(), fingerprints, count);
+	scoreAll([&](size_t) { return query.data(); }, 1,
+		 [=](const size_t row) { return fingerprints[row].data(); }, count,
+		 query.wordCount(), distances);
+}
+
+void hammingDistances(const uint64_t* query, const uint64_t* fingerprints, const size_t count, const size_t words, size_t* distances) {
+	scoreAll([=](size_t) { return query; }, 1,
+		 [=](const size_t row) { return fingerprints + row * words; }, count,
+		 words, distances);
+}
+
+void hammingDistanceMatrix(const bitset_t* queries, const size_t queryCount, const bitset_t* fingerprints, const size_t count, size_t* distances) {
+	if (queryCount == 0) return;
+	checkLengths(queries[0].length(), queries, queryCount);
+	checkLengths(queries[0].length(), fingerprints, count);
+	scoreAll([=](const size_t query) { return queries[query].data(); }, queryCount,
+		 [=](const size_t row) { return fingerprints[row].data(); }, count,
+		 queries[0].wordCount(), distances);
+}
+
+void hammingDistanceMatrix(const uint64_t* queries, const size_t queryCount, const uint64_t* fingerprints, const size_t count, const size_t words, size_t* distances) {
+	scoreAll([=](const size_t query) { return queries + query * words; }, queryCount,
+		 [=](const size_t row) { return fingerprints + row * words; }, count,
+		 words, distances);
+}
+
+bitset_t scalarProducts(const bitset_t& vector, const bitset_t* rows, const size_t count) {
+	checkLengths(vector.length(), rows, count);
+	bitset_t::word_vector_t products((count + 63) / 64, 0);
+	multiplyAll(vector.data(), [=](const size_t row) { return rows[row].data(); }, count, vector.wordCount(), products.data());
+	return bitset_t(std::move(products), count);
+}
+
+void scalarProducts(const uint64_t* vector, const uint64_t* rows, const size_t count, const size_t words, uint64_t* products) {
+	multiplyAll(vector, [=](const size_t row) { return rows + row * words; }, count, words, products);
+}
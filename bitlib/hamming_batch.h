@@ -0,0 +1,134 @@
+/**
+ * @file hamming_batch.h
+ * @date October 16, 2026
+ * @brief Contains definition of the batched Hamming distance and scalar product routines
+ */
+
+#ifndef bitlib___hamming_batch_h
+#define bitlib___hamming_batch_h
+
+#include <cstdint>
+#include <cstddef>
+#include "bitset_type.h"
+
+/**
+ * @brief Calculates Hamming distances from @p query to every fingerprint of the array
+ *
+ * @details Scores one query against @p count fingerprints, storing the distance to @p fingerprints[i] into @p distances[i]. Fingerprints are scanned in cache-sized blocks with the xor-popcount row kernel selected by bitsetKernels(), neither the query nor the fingerprints are copied. Large batches are split across the threads of the shared pool, see setBitsetThreads(), a whole number of cache lines of @p distances per range.
+ *
+ * @param [in] query Bitset to compare with the fingerprints.
+ * @param [in] fingerprints Array of @p count bitsets.
+ * @param [in] count Number of fingerprints.
+ * @param [out] distances Caller-provided buffer of at least @p count elements.
+ *
+ * @throw std::invalid_argument If any fingerprint length differs from the @p query length.
+ *
+ * Example usage:
+ * @code
+ *	// Initialise the query and the fingerprints
+ *	bitset_t query({0, 1, 1, 0});
+ *	std::vector<bitset_t> fingerprints = {bitset_t({1, 1, 1, 0}), bitset_t({0, 1, 1, 1})};
+ *
+ *	// Score the query against all fingerprints
+ *	std::vector<size_t> distances(fingerprints.size());
+ *	hammingDistances(query, fingerprints.data(), fingerprints.size(), distances.data());
+ * @endcode
+ */
+void hammingDistances(const bitset_t& query, const bitset_t* fingerprints, const size_t count, size_t* distances);
+
+/**
+ * @brief Calculates Hamming distances from @p query to every fingerprint of the packed array
+ *
+ * @details Same as the bitset overload, for fingerprints packed back to back into one array: fingerprint @c i occupies the words [@c i * @p words, (@c i + 1) * @p words) of @p fingerprints, in the bitset_t::data() layout. This is the fastest layout to scan, since consecutive fingerprints share cache lines.
+ *
+ * @param [in] query Pointer to @p words words of the query.
+ * @param [in] fingerprints Pointer to @p count * @p words words of the fingerprints.
+ * @param [in] count Number of fingerprints.
+ * @param [in] words Number of words per fingerprint.
+ * @param [out] distances Caller-provided buffer of at least @p count elements.
+ *
+ * Example usage:
+ * @code
+ *	// Two 128-bit fingerprints, packed
+ *	uint64_t fingerprints[4] = {0x1, 0x0, 0xFF, 0x1};
+ *	uint64_t query[2] = {0x3, 0x1};
+ *
+ *	// Calculate distances (2 and 6)
+ *	size_t distances[2];
+ *	hammingDistances(query, fingerprints, 2, 2, distances);
+ * @endcode
+ */
+void hammingDistances(const uint64_t* query, const uint64_t* fingerprints, const size_t count, const size_t words, size_t* distances);
+
+/**
+ * @brief Calculates the matrix of Hamming distances between two arrays of fingerprints
+ *
+ * @details Stores the distance between @p queries[i] and @p fingerprints[j] into @p distances[i * @p count + j] (row-major @p queryCount by @p count matrix). The fingerprints are processed in blocks that fit the cache, and every query is scored against a block before the next one is loaded, so each fingerprint is read from memory once per range rather than once per query. Large matrices are split across the threads of the shared pool, a whole number of cache lines of @p distances per range: a few queries split by ranges of fingerprints, many queries by ranges of rows.
+ *
+ * @param [in] queries Array of @p queryCount bitsets.
+ * @param [in] queryCount Number of queries (rows of the matrix).
+ * @param [in] fingerprints Array of @p count bitsets.
+ * @param [in] count Number of fingerprints (columns of the matrix).
+ * @param [out] distances Caller-provided buffer of at least @p queryCount * @p count elements.
+ *
+ * @throw std::invalid_argument If queries and fingerprints are not all of the same length.
+ *
+ * Example usage:
+ * @code
+ *	// Calculate all pairwise distances within a collection
+ *	std::vector<size_t> matrix(collection.size() * collection.size());
+ *	hammingDistanceMatrix(collection.data(), collection.size(), collection.data(), collection.size(), matrix.data());
+ * @endcode
+ */
+void hammingDistanceMatrix(const bitset_t* queries, const size_t queryCount, const bitset_t* fingerprints, const size_t count, size_t* distances);
+
+/**
+ * @brief Calculates the matrix of Hamming distances between two packed arrays of fingerprints
+ *
+ * @details Same as the bitset overload, for queries and fingerprints packed back to back as described in hammingDistances().
+ *
+ * @param [in] queries Pointer to @p queryCount * @p words words of the queries.
+ * @param [in] queryCount Number of queries (rows of the matrix).
+ * @param [in] fingerprints Pointer to @p count * @p words words of the fingerprints.
+ * @param [in] count Number of fingerprints (columns of the matrix).
+ * @param [in] words Number of words per fingerprint.
+ * @param [out] distances Caller-provided buffer of at least @p queryCount * @p count elements.
+ */
+void hammingDistanceMatrix(const uint64_t* queries, const size_t queryCount, const uint64_t* fingerprints, const size_t count, const size_t words, size_t* distances);
+
+/**
+ * @brief Calculates scalar products of @p vector with every row of the array
+ *
+ * @details Bit @c i of the result is `vector * rows[i]` (see bitset_t::operator*()), the parity of the bits set in both. Rows are taken 64 at a time by the scalar product row kernel selected by bitsetKernels(), which stores the 64 parities as one word of the result. Large batches are split across the threads of the shared pool, see setBitsetThreads(), a whole number of cache lines of the result per range.
+ *
+ * @param [in] vector Bitset to multiply the rows with.
+ * @param [in] rows Array of @p count bitsets.
+ * @param [in] count Number of rows.
+ *
+ * @return Bitset of @p count bits.
+ *
+ * @throw std::invalid_argument If any row length differs from the @p vector length.
+ *
+ * Example usage:
+ * @code
+ *	// Syndrome of a received word against the parity checks
+ *	bitset_t syndrome = scalarProducts(received, checks.data(), checks.size());
+ *	bool valid = !syndrome.any();
+ * @endcode
+ */
+bitset_t scalarProducts(const bitset_t& vector, const bitset_t* rows, const size_t count);
+
+/**
+ * @brief Calculates scalar products of @p vector with every row of the packed array
+ *
+ * @details Same as the bitset overload, for rows packed back to back as described in hammingDistances().
+ *
+ * @param [in] vector Pointer to @p words words of the vector.
+ * @param [in] rows Pointer to @p count * @p words words of the rows.
+ * @param [in] count Number of rows.
+ * @param [in] words Number of words per row.
+ * @param [out] products Caller-provided buffer of at least (@p count + 63) / 64 words, receiving the product with row @c i in bit @c i % 64 of word @c i / 64; bits past @p count are reset.
+ */
+void scalarProducts(const uint64_t* vector, const uint64_t* rows, const size_t count, const size_t words, uint64_t* products);
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * @file mapped_bitset.cpp
+ * @implements mapped_bitset.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `mapped_bitset_t` class
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mapped_bitset.h"
+
+static_assert(sizeof(bitset_file_header_t) == 64, "bitset file header must take 64 bytes");
+
+const uint64_t bitset_file_header_t::magicValue;
+const uint64_t bitset_file_header_t::byteOrderValue;
+const uint32_t bitset_file_header_t::currentVersion;
+
+
+
+//   ######  ##     ## ########  ######  ##    ##
+//  ##    ## ##     ## ##       ##    ## ##   ##
+//  ##       ##     ## ##       ##       ##  ##
+//  ##       ######### ######   ##       #####
+//  ##       ##     ## ##       ##       ##  ##
+//  ##    ## ##     ## ##       ##    ## ##   ##
+//   ######  ##     ## ########  ######  ##    ##
+
+static uint64_t rotateWord(const uint64_t word, const unsigned shift) {
+	return (word << shift) | (word >> (64 - shift));
+}
+
+// Continues the checksum @p seed over @p count words; four independent lanes keep the multiplier busy
+static uint64_t checksumWords(const uint64_t* words, const size_t count, const uint64_t seed) {
+	static const uint64_t prime1 = 0x9E3779B185EBCA87ULL, prime2 = 0xC2B2AE3D27D4EB4FULL;
+	uint64_t lanes[4] = {seed + prime1, seed ^ prime2, seed - prime1, ~seed};
+	size_t index = 0;
+	for (; index + 4 <= count; index += 4)
+		for (size_t lane = 0; lane < 4; ++lane)
+			lanes[lane] = rotateWord(lanes[lane] ^ (words[index + lane] * prime2), 31) * prime1;
+	uint64_t result = rotateWord(lanes[0], 1) + rotateWord(lanes[1], 7) + rotateWord(lanes[2], 12) + rotateWord(lanes[3], 18);
+	for (; index < count; ++index)
+		result = rotateWord(result ^ (words[index] * prime2), 27) * prime1;
+	result ^= (uint64_t)count;
+	result ^= result >> 33;
+	result *= prime2;
+	return result ^ (result >> 29);
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+mapped_bitset_t::mapped_bitset_t(const std::string& path, const bool verifyChecksum) : mapping(nullptr), mappingLength(0), header(nullptr), index() {
+	const int file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0)
+		throw std::runtime_error("mapped_bitset_t::mapped_bitset_t: cannot open " + path);
+	struct stat status;
+	if (::fstat(file, &status) != 0 || (size_t)status.st_size < sizeof(bitset_file_header_t)) {
+		::close(file);
+		throw std::runtime_error("mapped_bitset_t::mapped_bitset_t: not a bitset file: " + path);
+	}
+	const size_t size = (size_t)status.st_size;
+	void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+	::close(file);
+	if (address == MAP_FAILED)
+		throw std::runtime_error("mapped_bitset_t::mapped_bitset_t: cannot map " + path);
+	mapping = address;
+	mappingLength = size;
+	header = (const bitset_file_header_t*)address;
+
+	// Sections must lie within the file, computed so that corrupted sizes cannot overflow
+	const char* reason = nullptr;
+	const uint64_t payloadWords = header->bitLength / 64 + (header->bitLength % 64 != 0);
+	if (header->magic != bitset_file_header_t::magicValue) reason = "not a bitset file: ";
+	else if (header->byteOrder != bitset_file_header_t::byteOrderValue) reason = "byte order differs from the host: ";
+	else if (header->version != bitset_file_header_t::currentVersion) reason = "unsupported version: ";
+	else if (header->payloadOffset < sizeof(bitset_file_header_t) || header->payloadOffset % 8 != 0 || header->payloadOffset > size || payloadWords > (size - header->payloadOffset) / 8) reason = "truncated payload: ";
+	else if ((header->flags & bitset_file_header_t::hasRankIndex) != 0 && (header->indexOffset % 8 != 0 || header->indexOffset < header->payloadOffset + payloadWords * 8 || header->indexOffset > size || header->indexWords > (size - header->indexOffset) / 8)) reason = "truncated index: ";
+	else if (verifyChecksum && !verify()) reason = "checksum mismatch: ";
+	if (reason != nullptr) {
+		close();
+		throw std::runtime_error(std::string("mapped_bitset_t::mapped_bitset_t: ") + reason + path);
+	}
+	if ((header->flags & bitset_file_header_t::hasRankIndex) != 0) {
+		const uint64_t* payload = (const uint64_t*)((const char*)mapping + header->payloadOffset);
+		const uint64_t* image = (const uint64_t*)((const char*)mapping + header->indexOffset);
+		try {
+			index.reset(new rank_index_t(payload, length(), image, (size_t)header->indexWords));
+		} catch (...) {
+			close();
+			throw;
+		}
+	}
+	return;
+}
+
+mapped_bitset_t::mapped_bitset_t(mapped_bitset_t&& other) noexcept : mapping(other.mapping), mappingLength(other.mappingLength), header(other.header), index(std::move(other.index)) {
+	other.mapping = nullptr;
+	other.mappingLength = 0;
+	other.header = nullptr;
+	return;
+}
+
+mapped_bitset_t& mapped_bitset_t::operator=(mapped_bitset_t&& other) noexcept {
+	if (this == &other) return *this;
+	close();
+	mapping = other.mapping;
+	mappingLength = other.mappingLength;
+	header = other.header;
+	index = std::move(other.index);
+	other.mapping = nullptr;
+	other.mappingLength = 0;
+	other.header = nullptr;
+	return *this;
+}
+
+mapped_bitset_t::~mapped_bitset_t() {
+	close();
+	return;
+}
+
+void mapped_bitset_t::close() {
+	index.reset();
+	if (mapping != nullptr) ::munmap(const_cast<void*>(mapping), mappingLength);
+	mapping = nullptr;
+	mappingLength = 0;
+	header = nullptr;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t mapped_bitset_t::length() const {
+	return (header != nullptr) ? (size_t)header->bitLength : 0;
+}
+
+bitset_view_t mapped_bitset_t::view() const {
+	if (header == nullptr) return bitset_view_t();
+	return bitset_view_t((const uint64_t*)((const char*)mapping + header->payloadOffset), length());
+}
+
+bool mapped_bitset_t::hasRankIndex() const {
+	return index != nullptr;
+}
+
+const rank_index_t& mapped_bitset_t::rankIndex() const {
+	if (index == nullptr)
+		throw std::logic_error("mapped_bitset_t::rankIndex: the file holds no rank index");
+	return *index;
+}
+
+bool mapped_bitset_t::verify() const {
+	if (header == nullptr || (header->flags & bitset_file_header_t::hasChecksum) == 0) return true;
+	const uint64_t* payload = (const uint64_t*)((const char*)mapping + header->payloadOffset);
+	uint64_t result = checksumWords(payload, view().wordCount(), header->bitLength);
+	if ((header->flags & bitset_file_header_t::hasRankIndex) != 0)
+		result = checksumWords((const uint64_t*)((const char*)mapping + header->indexOffset), (size_t)header->indexWords, result);
+	return result == header->checksum;
+}
+
+
+
+//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+void mapped_bitset_t::write(const std::string& path, const bitset_t& bits, const unsigned options) {
+	bitset_file_header_t header = {};
+	header.magic = bitset_file_header_t::magicValue;
+	header.byteOrder = bitset_file_header_t::byteOrderValue;
+	header.version = bitset_file_header_t::currentVersion;
+	header.bitLength = bits.length();
+	header.payloadOffset = sizeof(bitset_file_header_t);
+
+	std::unique_ptr<rank_index_t> index;
+	if ((options & withRankIndex) != 0) {
+		index.reset(new rank_index_t(bits));
+		header.flags |= bitset_file_header_t::hasRankIndex;
+		header.indexOffset = header.payloadOffset + bits.wordCount() * sizeof(uint64_t);
+		header.indexWords = index->imageWords();
+	}
+	if ((options & withChecksum) != 0) {
+		header.flags |= bitset_file_header_t::hasChecksum;
+		header.checksum = checksumWords(bits.data(), bits.wordCount(), header.bitLength);
+		if (index != nullptr) header.checksum = checksumWords(index->image(), index->imageWords(), header.checksum);
+	}
+
+	// Written aside and renamed over the path, so that readers never map a partial file
+	const std::string temporary = path + ".tmp";
+	{
+		std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+		file.write((const char*)&header, sizeof(header));
+		file.write((const char*)bits.data(), (std::streamsize)(bits.wordCount() * sizeof(uint64_t)));
+		if (index != nullptr) file.write((const char*)index->image(), (std::streamsize)(index->imageWords() * sizeof(uint64_t)));
+		file.flush();
+		if (!file) {
+			std::remove(temporary.c_str());
+			throw std::runtime_error("mapped_bitset_t::write: cannot write " + temporary);
+		}
+	}
+	if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+		std::remove(temporary.c_str());
+		throw std::runtime_error("mapped_bitset_t::write: cannot replace " + path);
+	}
+}
@@ -0,0 +1,269 @@
+/**
+ * @file mapped_bitset.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `mapped_bitset_t` class and of the bitset file format
+ */
+
+#ifndef bitlib___mapped_bitset_h
+#define bitlib___mapped_bitset_h
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "bitset_type.h"
+#include "bitset_view.h"
+#include "rank_index.h"
+
+/**
+ * @brief Header of a bitset file
+ *
+ * @details A bitset file consists of three word-aligned sections:
+ *	| Section  | Offset, bytes  | Contents                                                              |
+ *	|:---------|:--------------:|:----------------------------------------------------------------------|
+ *	|header    |0               |this structure, 64 bytes                                               |
+ *	|payload   |@ref payloadOffset |the words of the bitset exactly as `bitset_t` stores them, unused bits of the last word reset |
+ *	|index     |@ref indexOffset |optional image of a @ref rank_index_t over the payload                |
+ * Every field is stored in the byte order of the writing host; @ref byteOrder tells files of the other byte order apart, which are rejected rather than converted. The checksum covers the payload and the index words, and is stored in the header.
+ */
+struct bitset_file_header_t {
+	/**
+	 * @brief Identifies bitset files, equal to @ref magicValue
+	 */
+	uint64_t magic;
+
+	/**
+	 * @brief Equal to @ref byteOrderValue when read on a host of the same byte order as the writer
+	 */
+	uint64_t byteOrder;
+
+	/**
+	 * @brief Version of the format, equal to @ref currentVersion
+	 */
+	uint32_t version;
+
+	/**
+	 * @brief Combination of the @ref flag_t values
+	 */
+	uint32_t flags;
+
+	/**
+	 * @brief Length of the bitset, in bits
+	 */
+	uint64_t bitLength;
+
+	/**
+	 * @brief Offset of the payload from the start of the file, in bytes
+	 */
+	uint64_t payloadOffset;
+
+	/**
+	 * @brief Offset of the index from the start of the file, in bytes; zero if the file has no index
+	 */
+	uint64_t indexOffset;
+
+	/**
+	 * @brief Length of the index, in words
+	 */
+	uint64_t indexWords;
+
+	/**
+	 * @brief Checksum of the payload and the index words; zero if the file has no checksum
+	 */
+	uint64_t checksum;
+
+	/**
+	 * @brief Optional parts of the file
+	 */
+	enum flag_t : uint32_t {
+		hasChecksum = 1,	///< @ref checksum is valid
+		hasRankIndex = 2	///< The file holds a rank index after the payload
+	};
+
+	static const uint64_t magicValue = 0x3153425954544942ULL;	///< "BITTYBS1" read as a little-endian word
+	static const uint64_t byteOrderValue = 0x0102030405060708ULL;
+	static const uint32_t currentVersion = 1;
+};
+
+/**
+ * @brief Read-only bitset mapped from a bitset file
+ *
+ * @details Opens a file written by write() with `mmap`, so that opening takes constant time regardless of the size of the bitset: pages of the file are read by the operating system when they are first accessed, and are shared with other processes mapping the same file. The bits are accessed through view(), a `bitset_view_t` which takes part in all the read operations and bitwise expressions of bitsets without copying; a rank index stored in the file is used in place as well.
+ *
+ * The header and the section sizes are always validated when the file is opened; the checksum is only verified on request, since that reads the whole file.
+ *
+ * @note The payload is mapped at a page-aligned address plus the 64-byte payload offset, so that it is word-aligned.
+ * @note Requires a POSIX system (`open`, `fstat`, `mmap`).
+ *
+ * Example usage:
+ * @code
+ *	// Once, when the allow list changes
+ *	mapped_bitset_t::write("allow.bits", allowed, mapped_bitset_t::withRankIndex | mapped_bitset_t::withChecksum);
+ *
+ *	// At every start, instantly
+ *	mapped_bitset_t allow("allow.bits");
+ *	if (allow.view()[userId]) accept();
+ * @endcode
+ */
+class mapped_bitset_t {
+public:
+	/**
+	 * @brief Optional parts of a written file, combined with `|`
+	 */
+	enum option_t : unsigned {
+		plain = 0,		///< Header and payload only
+		withChecksum = 1,	///< Store a checksum of the payload and the index
+		withRankIndex = 2	///< Store a rank/select index of the payload
+	};
+private:
+	/**
+	 * @brief Start of the mapping
+	 */
+	const void* mapping;
+
+	/**
+	 * @brief Length of the mapping, in bytes
+	 */
+	size_t mappingLength;
+
+	/**
+	 * @brief Header of the mapped file
+	 */
+	const bitset_file_header_t* header;
+
+	/**
+	 * @brief Rank index stored in the file, referring to the mapping; null if the file has none
+	 */
+	std::unique_ptr<rank_index_t> index;
+
+	/**
+	 * @brief Unmaps the file
+	 */
+	void close();
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Maps the bitset file at @p path
+	 *
+	 * @param [in] path Path of the file.
+	 * @param [in] verifyChecksum Whether to verify the checksum, if the file has one, reading the whole file.
+	 *
+	 * @throw std::runtime_error If the file cannot be opened or mapped, is not a bitset file of this version and byte order, is truncated, or fails verification.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Verify once after download, then map without reading
+	 *	mapped_bitset_t deny("deny.bits", true);
+	 * @endcode
+	 */
+	explicit mapped_bitset_t(const std::string& path, const bool verifyChecksum = false);
+
+	/**
+	 * @brief Move constructor, the mapping is transferred to the new object
+	 */
+	mapped_bitset_t(mapped_bitset_t&& other) noexcept;
+
+	/**
+	 * @brief Move assignment operator, the former mapping of `*this` is unmapped
+	 */
+	mapped_bitset_t& operator=(mapped_bitset_t&& other) noexcept;
+
+	mapped_bitset_t(const mapped_bitset_t&) = delete;
+	mapped_bitset_t& operator=(const mapped_bitset_t&) = delete;
+
+	/**
+	 * @brief Unmaps the file; views and indices obtained from the object become invalid
+	 */
+	~mapped_bitset_t();
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns length of the mapped bitset
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns read-only view of the mapped bitset
+	 *
+	 * @warning The view is valid while `*this` is alive.
+	 *
+	 * Example usage:
+	 * @code
+	 *	mapped_bitset_t mapped("allow.bits");
+	 *	bitset_t stillAllowed = mapped.view() & ~revoked;
+	 * @endcode
+	 */
+	bitset_view_t view() const;
+
+	/**
+	 * @brief Tests whether the file holds a rank index
+	 */
+	bool hasRankIndex() const;
+
+	/**
+	 * @brief Returns the rank index stored in the file
+	 *
+	 * @throw std::logic_error If the file holds no rank index.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Position of a user in the dense array of allowed users
+	 *	size_t slot = mapped.rankIndex().rank1(userId);
+	 * @endcode
+	 */
+	const rank_index_t& rankIndex() const;
+
+	/**
+	 * @brief Verifies the checksum of the file, reading the whole file
+	 *
+	 * @return `true` if the checksum matches or the file has none, `false` otherwise.
+	 */
+	bool verify() const;
+
+
+
+	//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+	//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+	//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+	//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+	//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+	//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+	//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+	/**
+	 * @brief Writes @p bits into the bitset file at @p path
+	 *
+	 * @details Writes the file under a temporary name next to @p path and renames it over @p path when complete, so that processes mapping the old file keep their consistent copy and a failed write leaves no truncated file behind.
+	 *
+	 * @param [in] path Path of the file, replaced if it exists.
+	 * @param [in] bits Bitset to write.
+	 * @param [in] options Combination of @ref option_t values.
+	 *
+	 * @throw std::runtime_error If the file cannot be written.
+	 *
+	 * Example usage:
+	 * @code
+	 *	mapped_bitset_t::write("deny.bits", denied, mapped_bitset_t::withChecksum);
+	 * @endcode
+	 */
+	static void write(const std::string& path, const bitset_t& bits, const unsigned options = withChecksum);
+};
+
+#endif
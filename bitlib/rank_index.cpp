@@ -0,0 +1,231 @@
+/**
+ * @file rank_index.cpp
+ * @implements rank_index.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `rank_index_t` class
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "rank_index.h"
+#include "bitset_kernels.h"
+
+
+
+//  ##          ###    ##    ##  #######  ##     ## ########
+//  ##         ## ##    ##  ##  ##     ## ##     ##    ##
+//  ##        ##   ##    ####   ##     ## ##     ##    ##
+//  ##       ##     ##    ##    ##     ## ##     ##    ##
+//  ##       #########    ##    ##     ## ##     ##    ##
+//  ##       ##     ##    ##    ##     ## ##     ##    ##
+//  ######## ##     ##    ##     #######   #######     ##
+
+static const size_t wordsPerSubBlock = 8;
+static const size_t subBlocksPerBlock = 4;
+static const size_t wordsPerBlock = wordsPerSubBlock * subBlocksPerBlock;
+static const size_t bitsPerBlock = 64 * wordsPerBlock;
+
+// Blocks per upper range of 2^32 bits, so that the in-range count of a block fits into 32 bits
+static const size_t blocksPerUpper = ((size_t)1 << 32) / bitsPerBlock;
+
+// Set bits between two consecutive select samples
+static const size_t sampleRate = 8192;
+
+static const uint64_t lowMask = 0xFFFFFFFFULL;
+
+// Words of the image header: total and the counts of upper, blocks and samples
+static const size_t headerWords = 4;
+
+static size_t subBlockCount(const uint64_t block, const size_t subBlock) {
+	return (size_t)((block >> (32 + 10 * subBlock)) & 0x3FF);
+}
+
+// Index of the set bit of @p word with @p rank set bits below it; @p rank must be less than the number of set bits
+static size_t selectInWord(const uint64_t word, size_t rank) {
+#if defined(__BMI2__)
+	return trailingZeros(_pdep_u64((uint64_t)1 << rank, word));
+#else
+	// Byte i of prefix holds the number of set bits in bytes 0..i
+	uint64_t count = word - ((word >> 1) & 0x5555555555555555ULL);
+	count = (count & 0x3333333333333333ULL) + ((count >> 2) & 0x3333333333333333ULL);
+	count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	const uint64_t prefix = count * 0x0101010101010101ULL;
+	size_t shift = 0;
+	while (((prefix >> shift) & 0xFF) <= rank)
+		shift += 8;
+	if (shift != 0) rank -= (size_t)((prefix >> (shift - 8)) & 0xFF);
+	uint64_t byte = (word >> shift) & 0xFF;
+	for (; rank != 0; --rank)
+		byte &= byte - 1;
+	return shift + trailingZeros(byte);
+#endif
+}
+
+size_t rank_index_t::blockRank(const size_t block) const {
+	return (size_t)upper[block / blocksPerUpper] + (size_t)(blocks[block] & lowMask);
+}
+
+void rank_index_t::bind(const uint64_t* image) {
+	upper = image + headerWords;
+	blocks = upper + upperCount;
+	samples = blocks + blockCount;
+}
+
+const uint64_t* rank_index_t::image() const {
+	return upper - headerWords;
+}
+
+size_t rank_index_t::imageWords() const {
+	return headerWords + upperCount + blockCount + sampleCount;
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+rank_index_t::rank_index_t(const bitset_t& bits) {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	const size_t words = bits.wordCount();
+	std::vector<uint64_t> upperBuilt, blocksBuilt, samplesBuilt;
+	this->head = bits.data();
+	this->bitLength = bits.length();
+	this->total = 0;
+	blocksBuilt.reserve((words + wordsPerBlock - 1) / wordsPerBlock);
+	for (size_t block = 0; block * wordsPerBlock < words; ++block) {
+		if (block % blocksPerUpper == 0) upperBuilt.push_back(total);
+		uint64_t packed = total - upperBuilt.back();
+		for (size_t subBlock = 0; subBlock < subBlocksPerBlock; ++subBlock) {
+			const size_t first = std::min(words, block * wordsPerBlock + subBlock * wordsPerSubBlock);
+			const size_t ones = kernels.popcountWords(head + first, std::min(words - first, wordsPerSubBlock));
+			if (subBlock + 1 < subBlocksPerBlock) packed |= (uint64_t)ones << (32 + 10 * subBlock);
+			total += ones;
+		}
+		blocksBuilt.push_back(packed);
+		while (samplesBuilt.size() * sampleRate < total)
+			samplesBuilt.push_back(block);
+	}
+	this->upperCount = upperBuilt.size();
+	this->blockCount = blocksBuilt.size();
+	this->sampleCount = samplesBuilt.size();
+	storage.reserve(headerWords + upperCount + blockCount + sampleCount);
+	storage.push_back(total);
+	storage.push_back(upperCount);
+	storage.push_back(blockCount);
+	storage.push_back(sampleCount);
+	storage.insert(storage.end(), upperBuilt.begin(), upperBuilt.end());
+	storage.insert(storage.end(), blocksBuilt.begin(), blocksBuilt.end());
+	storage.insert(storage.end(), samplesBuilt.begin(), samplesBuilt.end());
+	bind(storage.data());
+	return;
+}
+
+rank_index_t::rank_index_t(const uint64_t* head, const size_t length, const uint64_t* image, const size_t words) {
+	if (words < headerWords)
+		throw std::runtime_error("rank_index_t::rank_index_t: truncated index");
+	const size_t blocksExpected = ((length + 63) / 64 + wordsPerBlock - 1) / wordsPerBlock;
+	this->head = head;
+	this->bitLength = length;
+	this->total = (size_t)image[0];
+	this->upperCount = (size_t)image[1];
+	this->blockCount = (size_t)image[2];
+	this->sampleCount = (size_t)image[3];
+	if (total > length || blockCount != blocksExpected || upperCount != (blockCount + blocksPerUpper - 1) / blocksPerUpper || sampleCount != (total + sampleRate - 1) / sampleRate || words != imageWords())
+		throw std::runtime_error("rank_index_t::rank_index_t: index does not match the bitset");
+	bind(image);
+	return;
+}
+
+rank_index_t::rank_index_t(const rank_index_t& other) : head(other.head), bitLength(other.bitLength), total(other.total), upperCount(other.upperCount), blockCount(other.blockCount), sampleCount(other.sampleCount), storage(other.storage) {
+	bind(storage.empty() ? other.image() : storage.data());
+	return;
+}
+
+rank_index_t& rank_index_t::operator=(const rank_index_t& other) {
+	if (this == &other) return *this;
+	head = other.head;
+	bitLength = other.bitLength;
+	total = other.total;
+	upperCount = other.upperCount;
+	blockCount = other.blockCount;
+	sampleCount = other.sampleCount;
+	storage = other.storage;
+	bind(storage.empty() ? other.image() : storage.data());
+	return *this;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t rank_index_t::length() const {
+	return bitLength;
+}
+
+size_t rank_index_t::count() const {
+	return total;
+}
+
+size_t rank_index_t::memoryUsage() const {
+	return imageWords() * sizeof(uint64_t);
+}
+
+size_t rank_index_t::rank1(const size_t index) const {
+	if (index >= bitLength) return total;
+	const size_t block = index / bitsPerBlock, subBlock = (index / (64 * wordsPerSubBlock)) % subBlocksPerBlock;
+	const uint64_t packed = blocks[block];
+	size_t result = blockRank(block);
+	for (size_t previous = 0; previous < subBlock; ++previous)
+		result += subBlockCount(packed, previous);
+	const size_t last = index / 64;
+	for (size_t word = block * wordsPerBlock + subBlock * wordsPerSubBlock; word < last; ++word)
+		result += popcountWord(head[word]);
+	return result + popcountWord(head[last] & (((uint64_t)1 << (index % 64)) - 1));
+}
+
+size_t rank_index_t::rank0(const size_t index) const {
+	return std::min(index, bitLength) - rank1(index);
+}
+
+size_t rank_index_t::select1(size_t rank) const {
+	if (rank >= total) return bitset_t::npos;
+
+	// Last block starting with at most rank set bits before it, between the two samples around rank
+	const size_t sample = rank / sampleRate;
+	size_t low = (size_t)samples[sample], high = (sample + 1 < sampleCount) ? (size_t)samples[sample + 1] + 1 : blockCount;
+	while (high - low > 1) {
+		const size_t middle = low + (high - low) / 2;
+		if (blockRank(middle) <= rank) low = middle;
+		else high = middle;
+	}
+	rank -= blockRank(low);
+
+	const uint64_t packed = blocks[low];
+	size_t word = low * wordsPerBlock;
+	for (size_t subBlock = 0; subBlock + 1 < subBlocksPerBlock; ++subBlock) {
+		const size_t ones = subBlockCount(packed, subBlock);
+		if (rank < ones) break;
+		rank -= ones;
+		word += wordsPerSubBlock;
+	}
+	for (size_t ones = popcountWord(head[word]); rank >= ones; ones = popcountWord(head[word])) {
+		rank -= ones;
+		++word;
+	}
+	return word * 64 + selectInWord(head[word], rank);
+}
@@ -0,0 +1,228 @@
+/**
+ * @file rank_index.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `rank_index_t` class
+ */
+
+#ifndef bitlib___rank_index_h
+#define bitlib___rank_index_h
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "bitset_type.h"
+
+/**
+ * @brief Auxiliary rank/select index over a `bitset_t`
+ *
+ * @details Answers rank1() (number of set bits before an index) and select1() (index of the k-th set bit) without scanning the bitset, using a three-level counter layout (Zhou, Andersen, Kaminsky, "Space-Efficient, High-Performance Rank & Select Structures on Uncompressed Bit Sequences"):
+ *	| Level    | Covers, bits | Contents                                                         |
+ *	|:---------|:------------:|:-----------------------------------------------------------------|
+ *	|upper     |2^32          |64-bit number of set bits before the range                        |
+ *	|block     |2048          |32-bit number of set bits since the upper range, and three 10-bit counts of its first three 512-bit sub-blocks, packed into one word |
+ *	|sample    |8192 set bits |index of the block holding every 8192-th set bit                  |
+ * Thus the index takes about 3.2% of the bitset memory. rank1() reads a single block word and counts at most seven words of the bitset; select1() binary searches the blocks between two samples, then walks the sub-block counts and the words, and finds the bit within the word with PDEP where BMI2 is enabled at compile time, or with a broadword byte search otherwise. All counters are stored in a single array of words, which is also the layout the index takes in a bitset file (see mapped_bitset_t).
+ *
+ * @warning The index refers to the storage of the bitset it was built over: that bitset <b>must outlive the index and must not be modified or resized</b> while the index is in use. Rebuild the index after modifying the bitset.
+ * @note Const methods may be invoked concurrently.
+ *
+ * Example usage:
+ * @code
+ *	// Directory of the non-empty slots of a compressed array
+ *	bitset_t present = {0, 1, 1, 0, 1};
+ *	rank_index_t directory(present);
+ *
+ *	// Slot 4 is the third stored value
+ *	size_t slot = directory.rank1(4);	// 2
+ *	size_t index = directory.select1(2);	// 4
+ * @endcode
+ */
+class rank_index_t {
+private:
+	/**
+	 * @brief Storage of the indexed bitset
+	 */
+	const uint64_t* head;
+
+	/**
+	 * @brief Length of the indexed bitset, in bits
+	 */
+	size_t bitLength;
+
+	/**
+	 * @brief Number of set bits of the indexed bitset
+	 */
+	size_t total;
+
+	/**
+	 * @brief Number of set bits before every 2^32-bit range
+	 */
+	const uint64_t* upper;
+
+	/**
+	 * @brief Packed counters of every 2048-bit block: bits 0..31 count the set bits between the start of the upper range and the block, bits 32..61 are the counts of the first three 512-bit sub-blocks
+	 */
+	const uint64_t* blocks;
+
+	/**
+	 * @brief Index of the block holding every 8192-th set bit (counting from the set bit `0`)
+	 */
+	const uint64_t* samples;
+
+	/**
+	 * @brief Number of @ref upper, @ref blocks and @ref samples entries
+	 */
+	size_t upperCount, blockCount, sampleCount;
+
+	/**
+	 * @brief Image of the index: a header of four words (@ref total and the three counts), then @ref upper, @ref blocks and @ref samples one after another; empty if the index refers to an image in external memory
+	 */
+	std::vector<uint64_t> storage;
+
+	/**
+	 * @brief Points @ref upper, @ref blocks and @ref samples into the index @p image
+	 */
+	void bind(const uint64_t* image);
+
+	/**
+	 * @brief Returns the number of set bits before @p block
+	 */
+	size_t blockRank(const size_t block) const;
+
+	/**
+	 * @brief Returns the image of the index, see @ref storage
+	 */
+	const uint64_t* image() const;
+
+	/**
+	 * @brief Returns the number of words of the image of the index
+	 */
+	size_t imageWords() const;
+
+	/**
+	 * @brief Constructs the index of @p length bits at @p head from an @p image in external memory, without copying it
+	 *
+	 * @throw std::runtime_error If the counts of the image do not match @p length.
+	 */
+	rank_index_t(const uint64_t* head, const size_t length, const uint64_t* image, const size_t words);
+
+	friend class mapped_bitset_t;
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Builds the index over @p bits
+	 *
+	 * @details Counts the bits of the whole bitset once with the popcount kernel selected by bitsetKernels().
+	 *
+	 * @param [in] bits Bitset to index; it is referred to, not copied.
+	 *
+	 * @warning @p bits <b>must outlive the index and must not be modified</b> while the index is in use.
+	 *
+	 * Example usage:
+	 * @code
+	 *	bitset_t someBitset = {0, 1, 1, 0};
+	 *	rank_index_t index(someBitset);
+	 * @endcode
+	 */
+	explicit rank_index_t(const bitset_t& bits);
+
+	/**
+	 * @brief Copy constructor
+	 *
+	 * @details Copies the counters of an index built over a bitset; an index of a mapped file keeps referring to the mapping.
+	 */
+	rank_index_t(const rank_index_t& other);
+
+	/**
+	 * @brief Move constructor
+	 */
+	rank_index_t(rank_index_t&& other) = default;
+
+	/**
+	 * @brief Copy assignment operator, see rank_index_t(const rank_index_t&)
+	 */
+	rank_index_t& operator=(const rank_index_t& other);
+
+	/**
+	 * @brief Move assignment operator
+	 */
+	rank_index_t& operator=(rank_index_t&& other) = default;
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns length of the indexed bitset
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns the number of set bits of the indexed bitset
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Returns the number of bytes used by the index, not including the bitset itself
+	 */
+	size_t memoryUsage() const;
+
+	/**
+	 * @brief Returns the number of set bits before @p index
+	 *
+	 * @param [in] index Index of the bit; the bit itself is not counted.
+	 *
+	 * @return Number of set bits with indices in [0, @p index); count() if @p index is not less than length().
+	 *
+	 * Example usage:
+	 * @code
+	 *	bitset_t someBitset = {1, 0, 1, 1};
+	 *	rank_index_t index(someBitset);
+	 *	size_t before = index.rank1(3);	// 2
+	 * @endcode
+	 */
+	size_t rank1(const size_t index) const;
+
+	/**
+	 * @brief Returns the number of reset bits before @p index
+	 *
+	 * @param [in] index Index of the bit; the bit itself is not counted.
+	 *
+	 * @return Number of reset bits with indices in [0, @p index); length() - count() if @p index is not less than length().
+	 */
+	size_t rank0(const size_t index) const;
+
+	/**
+	 * @brief Returns index of the set bit with rank @p rank
+	 *
+	 * @details Inverse of rank1(): `rank1(select1(k)) == k` for every @c k less than count().
+	 *
+	 * @param [in] rank Number of set bits before the bit to find, i.e. `0` finds the first set bit.
+	 *
+	 * @return Index of the set bit, or @ref bitset_t::npos if @p rank is not less than count().
+	 *
+	 * Example usage:
+	 * @code
+	 *	bitset_t someBitset = {1, 0, 1, 1};
+	 *	rank_index_t index(someBitset);
+	 *	size_t second = index.select1(1);	// 2
+	 * @endcode
+	 */
+	size_t select1(const size_t rank) const;
+};
+
+#endif
@@ -0,0 +1,667 @@
+/**
+ * @file roaring_bitmap.cpp
+ * @implements roaring_bitmap.h
+ * @date October 16, 2026
+ * @brief Contains implementation of the `roaring_bitmap_t` class
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "roaring_bitmap.h"
+#include "bitset_kernels.h"
+
+const size_t roaring_bitmap_t::chunkBits;
+
+typedef roaring_bitmap_t::container_t container_t;
+typedef container_t::kind_t kind_t;
+
+// Toggle points of a chunk: sorted offsets where the value of the bit changes, starting from zero,
+// so that every pair [first, last + 1) is a run of set bits; array and run containers are merged in this form
+typedef std::vector<uint32_t> toggles_t;
+
+static const size_t chunkWords = roaring_bitmap_t::chunkBits / 64;
+
+// Array containers larger than this take more memory than a bitmap
+static const size_t arrayLimit = 4096;
+
+
+
+//   ######   #######  ##    ## ########    ###    #### ##    ## ######## ########   ######
+//  ##    ## ##     ## ###   ##    ##      ## ##    ##  ###   ## ##       ##     ## ##    ##
+//  ##       ##     ## ####  ##    ##     ##   ##   ##  ####  ## ##       ##     ## ##
+//  ##       ##     ## ## ## ##    ##    ##     ##  ##  ## ## ## ######   ########   ######
+//  ##       ##     ## ##  ####    ##    #########  ##  ##  #### ##       ##   ##         ##
+//  ##    ## ##     ## ##   ###    ##    ##     ##  ##  ##   ### ##       ##    ##  ##    ##
+//   ######   #######  ##    ##    ##    ##     ## #### ##    ## ######## ##     ##  ######
+
+static bool xorBits(const bool left, const bool right) { return left != right; }
+static bool andBits(const bool left, const bool right) { return left && right; }
+static bool orBits(const bool left, const bool right) { return left || right; }
+static bool andNotBits(const bool left, const bool right) { return left && !right; }
+
+static void andNotWords(uint64_t* target, const uint64_t* source, const size_t count) {
+	for (size_t index = 0; index < count; ++index)
+		target[index] &= ~source[index];
+}
+
+// Sets bits [first, last) of the word array
+static void setRange(uint64_t* words, size_t first, const size_t last) {
+	while (first < last) {
+		const size_t offset = first % 64, span = std::min<size_t>(64 - offset, last - first);
+		words[first / 64] |= (span == 64) ? ~(uint64_t)0 : (((uint64_t)1 << span) - 1) << offset;
+		first += span;
+	}
+}
+
+// Invokes visit(offset) for every set bit of the container, in increasing order
+template <class Visit>
+static void forEachOffset(const container_t& container, Visit visit) {
+	switch (container.kind) {
+	case kind_t::array:
+		for (const uint16_t value : container.values)
+			visit((size_t)value);
+		break;
+	case kind_t::run:
+		for (size_t pair = 0; pair < container.values.size(); pair += 2)
+			for (size_t offset = container.values[pair]; offset <= container.values[pair + 1]; ++offset)
+				visit(offset);
+		break;
+	case kind_t::bitmap:
+		for (size_t word = 0; word < chunkWords; ++word)
+			for (uint64_t rest = container.words[word]; rest != 0; rest &= rest - 1)
+				visit(word * 64 + trailingZeros(rest));
+		break;
+	}
+}
+
+static void toBitmap(const container_t& container, uint64_t* words) {
+	if (container.kind == kind_t::bitmap) {
+		std::copy(container.words.begin(), container.words.end(), words);
+		return;
+	}
+	std::fill(words, words + chunkWords, 0);
+	if (container.kind == kind_t::array) {
+		for (const uint16_t value : container.values)
+			words[value / 64] |= (uint64_t)1 << (value % 64);
+	} else {
+		for (size_t pair = 0; pair < container.values.size(); pair += 2)
+			setRange(words, container.values[pair], (size_t)container.values[pair + 1] + 1);
+	}
+}
+
+// Toggle points of an array or run container
+static void toToggles(const container_t& container, toggles_t& toggles) {
+	toggles.clear();
+	if (container.kind == kind_t::array) {
+		for (const uint16_t value : container.values) {
+			if (!toggles.empty() && toggles.back() == value) toggles.back() = value + 1;
+			else {
+				toggles.push_back(value);
+				toggles.push_back(value + 1);
+			}
+		}
+	} else {
+		for (size_t pair = 0; pair < container.values.size(); pair += 2) {
+			toggles.push_back(container.values[pair]);
+			toggles.push_back((uint32_t)container.values[pair + 1] + 1);
+		}
+	}
+}
+
+// Toggle points of a bitmap: bits that differ from the previous bit of the chunk
+static void bitmapToggles(const uint64_t* words, toggles_t& toggles) {
+	toggles.clear();
+	uint64_t carry = 0;
+	for (size_t word = 0; word < chunkWords; ++word) {
+		for (uint64_t rest = words[word] ^ ((words[word] << 1) | carry); rest != 0; rest &= rest - 1)
+			toggles.push_back((uint32_t)(word * 64 + trailingZeros(rest)));
+		carry = words[word] >> 63;
+	}
+	if (carry) toggles.push_back((uint32_t)roaring_bitmap_t::chunkBits);
+}
+
+// Picks the smallest of the three encodings for a chunk of cardinality set bits in runs runs
+static kind_t bestKind(const size_t cardinality, const size_t runs) {
+	const size_t arrayBytes = 2 * cardinality, runBytes = 4 * runs, bitmapBytes = 8 * chunkWords;
+	if (runBytes < arrayBytes && runBytes < bitmapBytes) return kind_t::run;
+	return (cardinality <= arrayLimit) ? kind_t::array : kind_t::bitmap;
+}
+
+static container_t encodeToggles(const toggles_t& toggles) {
+	container_t container;
+	container.cardinality = 0;
+	for (size_t pair = 0; pair < toggles.size(); pair += 2)
+		container.cardinality += toggles[pair + 1] - toggles[pair];
+	container.kind = bestKind(container.cardinality, toggles.size() / 2);
+
+	switch (container.kind) {
+	case kind_t::run:
+		container.values.reserve(toggles.size());
+		for (size_t pair = 0; pair < toggles.size(); pair += 2) {
+			container.values.push_back((uint16_t)toggles[pair]);
+			container.values.push_back((uint16_t)(toggles[pair + 1] - 1));
+		}
+		break;
+	case kind_t::array:
+		container.values.reserve(container.cardinality);
+		for (size_t pair = 0; pair < toggles.size(); pair += 2)
+			for (uint32_t value = toggles[pair]; value < toggles[pair + 1]; ++value)
+				container.values.push_back((uint16_t)value);
+		break;
+	case kind_t::bitmap:
+		container.words.assign(chunkWords, 0);
+		for (size_t pair = 0; pair < toggles.size(); pair += 2)
+			setRange(container.words.data(), toggles[pair], toggles[pair + 1]);
+		break;
+	}
+	return container;
+}
+
+static container_t encodeBitmap(const uint64_t* words) {
+	const bitset_kernels_t& kernels = bitsetKernels();
+	container_t container;
+	container.cardinality = kernels.popcountWords(words, chunkWords);
+	if (container.cardinality == 0) {
+		container.kind = kind_t::array;
+		return container;
+	}
+
+	// A run starts at every set bit whose predecessor is reset
+	uint64_t starts[chunkWords], carry = 0;
+	for (size_t word = 0; word < chunkWords; ++word) {
+		starts[word] = words[word] & ~((words[word] << 1) | carry);
+		carry = words[word] >> 63;
+	}
+	container.kind = bestKind(container.cardinality, kernels.popcountWords(starts, chunkWords));
+
+	switch (container.kind) {
+	case kind_t::run: {
+		toggles_t toggles;
+		bitmapToggles(words, toggles);
+		return encodeToggles(toggles);
+	}
+	case kind_t::array:
+		container.values.reserve(container.cardinality);
+		for (size_t word = 0; word < chunkWords; ++word)
+			for (uint64_t rest = words[word]; rest != 0; rest &= rest - 1)
+				container.values.push_back((uint16_t)(word * 64 + trailingZeros(rest)));
+		break;
+	case kind_t::bitmap:
+		container.words.assign(words, words + chunkWords);
+		break;
+	}
+	return container;
+}
+
+// Merges two toggle lists, keeping the bits for which operation(left, right) holds
+static void sweep(const toggles_t& left, const toggles_t& right, bool (*operation)(const bool, const bool), toggles_t& result) {
+	result.clear();
+	bool inLeft = false, inRight = false, inResult = false;
+	for (size_t first = 0, second = 0; first < left.size() || second < right.size(); ) {
+		const uint32_t point = std::min(first < left.size() ? left[first] : UINT32_MAX,
+						second < right.size() ? right[second] : UINT32_MAX);
+		if (first < left.size() && left[first] == point) {
+			inLeft = !inLeft;
+			++first;
+		}
+		if (second < right.size() && right[second] == point) {
+			inRight = !inRight;
+			++second;
+		}
+		if (operation(inLeft, inRight) != inResult) {
+			inResult = !inResult;
+			result.push_back(point);
+		}
+	}
+}
+
+static container_t combineContainers(const container_t& left, const container_t& right,
+				     void (*kernel)(uint64_t*, const uint64_t*, const size_t),
+				     bool (*operation)(const bool, const bool)) {
+	if (left.kind != kind_t::bitmap && right.kind != kind_t::bitmap) {
+		toggles_t first, second, result;
+		toToggles(left, first);
+		toToggles(right, second);
+		sweep(first, second, operation, result);
+		return encodeToggles(result);
+	}
+	uint64_t target[chunkWords], source[chunkWords];
+	toBitmap(left, target);
+	toBitmap(right, source);
+	kernel(target, source, chunkWords);
+	return encodeBitmap(target);
+}
+
+// Container of the single run [0, length)
+static container_t fullContainer(const size_t length) {
+	toggles_t toggles;
+	toggles.push_back(0);
+	toggles.push_back((uint32_t)length);
+	return encodeToggles(toggles);
+}
+
+// Complement of the container within the first length bits of the chunk
+static container_t complementContainer(const container_t& container, const size_t length) {
+	if (container.kind == kind_t::bitmap) {
+		uint64_t words[chunkWords];
+		std::copy(container.words.begin(), container.words.end(), words);
+		bitsetKernels().invertWords(words, chunkWords);
+		std::fill(words + length / 64, words + chunkWords, 0);
+		if (length % 64) words[length / 64] = ~container.words[length / 64] & (((uint64_t)1 << (length % 64)) - 1);
+		return encodeBitmap(words);
+	}
+	toggles_t toggles;
+	toToggles(container, toggles);
+	if (!toggles.empty() && toggles.front() == 0) toggles.erase(toggles.begin());
+	else toggles.insert(toggles.begin(), 0);
+	if (!toggles.empty() && toggles.back() == length) toggles.pop_back();
+	else toggles.push_back((uint32_t)length);
+	return encodeToggles(toggles);
+}
+
+static bool testOffset(const container_t& container, const size_t offset) {
+	switch (container.kind) {
+	case kind_t::array:
+		return std::binary_search(container.values.begin(), container.values.end(), (uint16_t)offset);
+	case kind_t::run: {
+		// Last run starting at or before offset
+		size_t low = 0, high = container.values.size() / 2;
+		while (low < high) {
+			const size_t middle = (low + high) / 2;
+			if (container.values[2 * middle] <= offset) low = middle + 1;
+			else high = middle;
+		}
+		return low > 0 && offset <= container.values[2 * (low - 1) + 1];
+	}
+	case kind_t::bitmap:
+		return (container.words[offset / 64] >> (offset % 64)) & 1;
+	}
+	return false;
+}
+
+static size_t xorCount(const container_t& left, const container_t& right) {
+	if (left.kind == kind_t::bitmap && right.kind == kind_t::bitmap)
+		return bitsetKernels().xorPopcountWords(left.words.data(), right.words.data(), chunkWords);
+	if (left.kind == kind_t::bitmap || right.kind == kind_t::bitmap) {
+		// |A ^ B| = |A| + |B| - 2 |A & B|, probing the bitmap with the bits of the other container
+		const container_t& bitmap = (left.kind == kind_t::bitmap) ? left : right;
+		const container_t& other = (left.kind == kind_t::bitmap) ? right : left;
+		size_t common = 0;
+		forEachOffset(other, [&](const size_t offset) {
+			common += (bitmap.words[offset / 64] >> (offset % 64)) & 1;
+		});
+		return left.cardinality + right.cardinality - 2 * common;
+	}
+	toggles_t first, second, result;
+	toToggles(left, first);
+	toToggles(right, second);
+	sweep(first, second, xorBits, result);
+	size_t total = 0;
+	for (size_t pair = 0; pair < result.size(); pair += 2)
+		total += result[pair + 1] - result[pair];
+	return total;
+}
+
+
+
+//  ########  ########  #### ##     ##    ###    ######## ########
+//  ##     ## ##     ##  ##  ##     ##   ## ##      ##    ##
+//  ##     ## ##     ##  ##  ##     ##  ##   ##     ##    ##
+//  ########  ########   ##  ##     ## ##     ##    ##    ######
+//  ##        ##   ##    ##   ##   ##  #########    ##    ##
+//  ##        ##    ##   ##    ## ##   ##     ##    ##    ##
+//  ##        ##     ## ####    ###    ##     ##    ##    ########
+
+size_t roaring_bitmap_t::chunkLength(const size_t key) const {
+	return std::min(chunkBits, bitLength - key * chunkBits);
+}
+
+size_t roaring_bitmap_t::chunkAt(const size_t key) const {
+	return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+}
+
+roaring_bitmap_t roaring_bitmap_t::combine(const roaring_bitmap_t& other, void (*kernel)(uint64_t*, const uint64_t*, const size_t),
+					   bool (*operation)(const bool, const bool), const bool keepLeft, const bool keepRight) const {
+	roaring_bitmap_t result(bitLength);
+	size_t first = 0, second = 0;
+	while (first < keys.size() || second < other.keys.size()) {
+		if (second == other.keys.size() || (first < keys.size() && keys[first] < other.keys[second])) {
+			if (keepLeft) {
+				result.keys.push_back(keys[first]);
+				result.containers.push_back(containers[first]);
+			}
+			++first;
+		} else if (first == keys.size() || other.keys[second] < keys[first]) {
+			if (keepRight) {
+				result.keys.push_back(other.keys[second]);
+				result.containers.push_back(other.containers[second]);
+			}
+			++second;
+		} else {
+			container_t container = combineContainers(containers[first], other.containers[second], kernel, operation);
+			if (container.cardinality != 0) {
+				result.keys.push_back(keys[first]);
+				result.containers.push_back(std::move(container));
+			}
+			++first;
+			++second;
+		}
+	}
+	if (other.bitLength > bitLength) result.clip();
+	return result;
+}
+
+void roaring_bitmap_t::clip() {
+	const size_t chunks = (bitLength + chunkBits - 1) / chunkBits;
+	const size_t kept = chunkAt(chunks);
+	keys.resize(kept);
+	containers.resize(kept);
+	if (kept != 0 && keys.back() == chunks - 1 && chunkLength(keys.back()) < chunkBits) {
+		containers.back() = combineContainers(containers.back(), fullContainer(chunkLength(keys.back())), bitsetKernels().andWords, andBits);
+		if (containers.back().cardinality == 0) {
+			keys.pop_back();
+			containers.pop_back();
+		}
+	}
+}
+
+
+
+//   ######  ##    ##  ######  ######## ########   ######
+//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+//  ##       ####  ## ##          ##    ##     ## ##
+//  ##       ## ## ##  ######     ##    ########   ######
+//  ##       ##  ####       ##    ##    ##   ##         ##
+//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+//   ######  ##    ##  ######     ##    ##     ##  ######
+
+roaring_bitmap_t::roaring_bitmap_t() {
+	this->bitLength = 0;
+	return;
+}
+
+roaring_bitmap_t::roaring_bitmap_t(const size_t length) {
+	this->bitLength = length;
+	return;
+}
+
+roaring_bitmap_t::roaring_bitmap_t(const bitset_t& bits) {
+	this->bitLength = bits.length();
+	const bitset_t::word_t* head = bits.data();
+	const size_t wordCount = bits.wordCount();
+	uint64_t words[chunkWords];
+	for (size_t key = 0; key * chunkWords < wordCount; ++key) {
+		const size_t first = key * chunkWords, count = std::min(chunkWords, wordCount - first);
+		if (bitsetKernels().popcountWords(head + first, count) == 0) continue;
+		std::copy(head + first, head + first + count, words);
+		std::fill(words + count, words + chunkWords, 0);
+		this->keys.push_back(key);
+		this->containers.push_back(encodeBitmap(words));
+	}
+	return;
+}
+
+
+
+//   ######     ###     ######  ########
+//  ##    ##   ## ##   ##    ##    ##
+//  ##        ##   ##  ##          ##
+//  ##       ##     ##  ######     ##
+//  ##       #########       ##    ##
+//  ##    ## ##     ## ##    ##    ##
+//   ######  ##     ##  ######     ##
+
+roaring_bitmap_t::operator bitset_t() const {
+	bitset_t result;
+	result.resize(bitLength);
+	for (size_t chunk = 0; chunk < keys.size(); ++chunk) {
+		bitset_t::word_t* head = result.words.data() + keys[chunk] * chunkWords;
+		const container_t& container = containers[chunk];
+		switch (container.kind) {
+		case kind_t::bitmap:
+			std::copy(container.words.begin(), container.words.begin() + (chunkLength(keys[chunk]) + 63) / 64, head);
+			break;
+		case kind_t::run:
+			for (size_t pair = 0; pair < container.values.size(); pair += 2)
+				setRange(head, container.values[pair], (size_t)container.values[pair + 1] + 1);
+			break;
+		case kind_t::array:
+			for (const uint16_t value : container.values)
+				head[value / 64] |= (uint64_t)1 << (value % 64);
+			break;
+		}
+	}
+	return result;
+}
+
+
+
+//  ##        #######   ######   ####  ######
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ##       ##     ## ##         ##  ##
+//  ##       ##     ## ##   ####  ##  ##
+//  ##       ##     ## ##    ##   ##  ##
+//  ##       ##     ## ##    ##   ##  ##    ##
+//  ########  #######   ######   ####  ######
+
+size_t roaring_bitmap_t::length() const {
+	return bitLength;
+}
+
+size_t roaring_bitmap_t::count() const {
+	size_t total = 0;
+	for (const container_t& container : containers)
+		total += container.cardinality;
+	return total;
+}
+
+size_t roaring_bitmap_t::memoryUsage() const {
+	size_t total = sizeof(*this) + keys.size() * (sizeof(size_t) + sizeof(container_t));
+	for (const container_t& container : containers)
+		total += container.values.size() * sizeof(uint16_t) + container.words.size() * sizeof(uint64_t);
+	return total;
+}
+
+void roaring_bitmap_t::set(const size_t index) {
+	if (index >= bitLength) throw std::out_of_range("roaring_bitmap_t::set");
+	const size_t key = index / chunkBits, offset = index % chunkBits, chunk = chunkAt(key);
+	if (chunk == keys.size() || keys[chunk] != key) {
+		container_t container;
+		container.kind = kind_t::array;
+		container.values.push_back((uint16_t)offset);
+		container.cardinality = 1;
+		keys.insert(keys.begin() + chunk, key);
+		containers.insert(containers.begin() + chunk, std::move(container));
+		return;
+	}
+	container_t& container = containers[chunk];
+	if (testOffset(container, offset)) return;
+	if (container.kind == kind_t::bitmap) {
+		container.words[offset / 64] |= (uint64_t)1 << (offset % 64);
+		++container.cardinality;
+	} else if (container.kind == kind_t::array && container.cardinality < arrayLimit) {
+		container.values.insert(std::lower_bound(container.values.begin(), container.values.end(), (uint16_t)offset), (uint16_t)offset);
+		++container.cardinality;
+	} else {
+		container_t single;
+		single.kind = kind_t::array;
+		single.values.push_back((uint16_t)offset);
+		single.cardinality = 1;
+		container = combineContainers(container, single, bitsetKernels().orWords, orBits);
+	}
+}
+
+void roaring_bitmap_t::reset(const size_t index) {
+	if (index >= bitLength) throw std::out_of_range("roaring_bitmap_t::reset");
+	const size_t key = index / chunkBits, offset = index % chunkBits, chunk = chunkAt(key);
+	if (chunk == keys.size() || keys[chunk] != key) return;
+	container_t& container = containers[chunk];
+	if (!testOffset(container, offset)) return;
+	if (container.kind == kind_t::bitmap) {
+		container.words[offset / 64] &= ~((uint64_t)1 << (offset % 64));
+		--container.cardinality;
+		if (container.cardinality <= arrayLimit / 2)
+			container = encodeBitmap(container.words.data());
+	} else if (container.kind == kind_t::array) {
+		container.values.erase(std::lower_bound(container.values.begin(), container.values.end(), (uint16_t)offset));
+		--container.cardinality;
+	} else {
+		container_t single;
+		single.kind = kind_t::array;
+		single.values.push_back((uint16_t)offset);
+		single.cardinality = 1;
+		container = combineContainers(container, single, andNotWords, andNotBits);
+	}
+	if (container.cardinality == 0) {
+		keys.erase(keys.begin() + chunk);
+		containers.erase(containers.begin() + chunk);
+	}
+}
+
+void roaring_bitmap_t::invert() {
+	std::vector<size_t> invertedKeys;
+	std::vector<container_t> inverted;
+	size_t chunk = 0;
+	for (size_t key = 0; key * chunkBits < bitLength; ++key) {
+		container_t container = (chunk < keys.size() && keys[chunk] == key)
+			? complementContainer(containers[chunk++], chunkLength(key))
+			: fullContainer(chunkLength(key));
+		if (container.cardinality == 0) continue;
+		invertedKeys.push_back(key);
+		inverted.push_back(std::move(container));
+	}
+	keys.swap(invertedKeys);
+	containers.swap(inverted);
+}
+
+size_t hammingDistance(const roaring_bitmap_t& left, const roaring_bitmap_t& right) {
+	size_t total = 0, first = 0, second = 0;
+	while (first < left.keys.size() || second < right.keys.size()) {
+		if (second == right.keys.size() || (first < left.keys.size() && left.keys[first] < right.keys[second])) {
+			total += left.containers[first++].cardinality;
+		} else if (first == left.keys.size() || right.keys[second] < left.keys[first]) {
+			total += right.containers[second++].cardinality;
+		} else {
+			total += xorCount(left.containers[first++], right.containers[second++]);
+		}
+	}
+	return total;
+}
+
+
+
+//  ##     ## ##    ##    ###    ########  ##    ##
+//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ## ####  ##  ##   ##  ##     ##   ####
+//  ##     ## ## ## ## ##     ## ########     ##
+//  ##     ## ##  #### ######### ##   ##      ##
+//  ##     ## ##   ### ##     ## ##    ##     ##
+//   #######  ##    ## ##     ## ##     ##    ##
+
+roaring_bitmap_t roaring_bitmap_t::operator~() const {
+	roaring_bitmap_t temp(*this);
+	temp.invert();
+	return temp;
+}
+
+
+
+//  ########  #### ##    ##    ###    ########  ##    ##
+//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
+//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
+//  ########   ##  ## ## ## ##     ## ########     ##
+//  ##     ##  ##  ##  #### ######### ##   ##      ##
+//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
+//  ########  #### ##    ## ##     ## ##     ##    ##
+
+roaring_bitmap_t roaring_bitmap_t::operator^(const roaring_bitmap_t& other) const {
+	return combine(other, bitsetKernels().xorWords, xorBits, true, true);
+}
+
+roaring_bitmap_t roaring_bitmap_t::operator&(const roaring_bitmap_t& other) const {
+	return combine(other, bitsetKernels().andWords, andBits, false, false);
+}
+
+roaring_bitmap_t roaring_bitmap_t::operator|(const roaring_bitmap_t& other) const {
+	return combine(other, bitsetKernels().orWords, orBits, true, true);
+}
+
+
+
+//   ######   #######  ##     ## ########     ###    ########  ########
+//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+bool roaring_bitmap_t::operator==(const roaring_bitmap_t& other) const {
+	if (bitLength != other.bitLength || keys != other.keys) return false;
+	for (size_t chunk = 0; chunk < keys.size(); ++chunk)
+		if (containers[chunk].cardinality != other.containers[chunk].cardinality || xorCount(containers[chunk], other.containers[chunk]) != 0)
+			return false;
+	return true;
+}
+
+bool roaring_bitmap_t::operator!=(const roaring_bitmap_t& other) const {
+	return !(*this == other);
+}
+
+
+
+//     ###     ######   ######  ########  ######   ######
+//    ## ##   ##    ## ##    ## ##       ##    ## ##    ##
+//   ##   ##  ##       ##       ##       ##       ##
+//  ##     ## ##       ##       ######    ######   ######
+//  ######### ##       ##       ##             ##       ##
+//  ##     ## ##    ## ##    ## ##       ##    ## ##    ##
+//  ##     ##  ######   ######  ########  ######   ######
+
+bit_t roaring_bitmap_t::operator[](const size_t index) const {
+	const size_t key = index / chunkBits, chunk = chunkAt(key);
+	return bit_t(chunk < keys.size() && keys[chunk] == key && testOffset(containers[chunk], index % chunkBits));
+}
+
+bit_t roaring_bitmap_t::at(const size_t index) const {
+	if (index >= bitLength) throw std::out_of_range("roaring_bitmap_t::at");
+	return (*this)[index];
+}
+
+
+
+//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+std::string roaring_bitmap_t::toBinaryString() const {
+	return toBinaryString("");
+}
+
+std::string roaring_bitmap_t::toBinaryString(const std::string delimiter) const {
+	// Reset bits are written first, then set bits are patched in place
+	std::string temp;
+	temp.reserve(bitLength * (1 + delimiter.size()));
+	for (size_t index = 0; index < bitLength; ++index) {
+		if (index != 0) temp += delimiter;
+		temp += '0';
+	}
+	const size_t stride = 1 + delimiter.size();
+	for (size_t chunk = 0; chunk < keys.size(); ++chunk) {
+		const size_t base = keys[chunk] * chunkBits;
+		forEachOffset(containers[chunk], [&](const size_t offset) {
+			temp[(base + offset) * stride] = '1';
+		});
+	}
+	return temp;
+}
+
+std::ostream& operator<<(std::ostream& os, const roaring_bitmap_t& bits) {
+	return os << bits.toBinaryString();
+}
@@ -0,0 +1,483 @@
+/**
+ * @file roaring_bitmap.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `roaring_bitmap_t` class
+ */
+
+#ifndef bitlib___roaring_bitmap_h
+#define bitlib___roaring_bitmap_h
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "bit_type.h"
+#include "bitset_type.h"
+
+/**
+ * @brief Compressed bitmap type, stores a set of `bit_t` values of fixed length
+ *
+ * @details Roaring bitmap (Chambi, Lemire, Kaser, Godin, "Better bitmap performance with Roaring bitmaps"): the bitmap is split into chunks of 65536 bits, chunks without set bits are not stored at all, and every other chunk is kept in whichever of three containers is the smallest:
+ *	| Container | Contents                                 | Size, bytes           |
+ *	|:----------|:-----------------------------------------|:---------------------:|
+ *	|array      |sorted 16-bit offsets of the set bits     |2 per set bit          |
+ *	|run        |16-bit [first, last] pairs of set ranges  |4 per run of set bits  |
+ *	|bitmap     |1024 words, one bit per bit of the chunk  |8192                   |
+ * Thus memory is proportional to the number of set bits or of runs, whichever is smaller, rather than to the bitmap length. Logical operations are applied chunk by chunk: array and run containers are merged as sorted interval lists, bitmap containers are combined with the word kernels selected by bitsetKernels(), and every result is stored in its smallest container again.
+ *
+ * Bitmaps convert losslessly to and from `bitset_t`, and provide the same logical operations: `^`, `&`, `|`, invert(), hammingDistance(), `operator[]` and toBinaryString().
+ *
+ * Example usage:
+ * @code
+ *	// A billion-bit bitmap with a handful of set bits takes a few bytes per bit
+ *	roaring_bitmap_t sparse(1000000000);
+ *	sparse.set(7);
+ *	sparse.set(999999999);
+ *
+ *	// Same operations as bitset_t
+ *	roaring_bitmap_t other(bitset_t({0, 1, 1, 0}));
+ *	size_t distance = hammingDistance(other, roaring_bitmap_t(bitset_t({1, 1, 1, 0})));
+ *	bitset_t dense = other;
+ * @endcode
+ */
+class roaring_bitmap_t {
+public:
+
+	//  ######## ##    ## ########  ########  ######
+	//     ##     ##  ##  ##     ## ##       ##    ##
+	//     ##      ####   ##     ## ##       ##
+	//     ##       ##    ########  ######    ######
+	//     ##       ##    ##        ##             ##
+	//     ##       ##    ##        ##       ##    ##
+	//     ##       ##    ##        ########  ######
+
+	/**
+	 * @brief Container of a single 65536-bit chunk
+	 *
+	 * @details Exactly one of @ref values and @ref words is used, depending on @ref kind. Empty containers are never stored in a bitmap.
+	 */
+	struct container_t {
+		/**
+		 * @brief Container encoding
+		 */
+		enum class kind_t {
+			array,	///< @ref values holds sorted offsets of the set bits
+			bitmap,	///< @ref words holds 1024 words of the chunk
+			run	///< @ref values holds sorted (first, last) offset pairs of the runs of set bits
+		};
+
+		/**
+		 * @brief Container encoding
+		 */
+		kind_t kind;
+
+		/**
+		 * @brief Offsets of the array container, or offset pairs of the run container
+		 */
+		std::vector<uint16_t> values;
+
+		/**
+		 * @brief Words of the bitmap container
+		 */
+		std::vector<uint64_t> words;
+
+		/**
+		 * @brief Number of set bits in the container
+		 */
+		size_t cardinality;
+	};
+
+	/**
+	 * @brief Number of bits per chunk
+	 */
+	static const size_t chunkBits = 65536;
+private:
+	/**
+	 * @brief Sorted indices (bit index / @ref chunkBits) of the stored chunks
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	std::vector<size_t> keys;
+
+	/**
+	 * @brief Containers of the stored chunks, in the order of @ref keys
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	std::vector<container_t> containers;
+
+	/**
+	 * @brief Number of bits stored in the bitmap
+	 *
+	 * @warning This value should not be accessed by any external methods and members.
+	 */
+	size_t bitLength;
+
+	/**
+	 * @brief Returns the number of bits of the chunk with @p key that lie within the bitmap
+	 */
+	size_t chunkLength(const size_t key) const;
+
+	/**
+	 * @brief Returns position of the chunk with @p key in @ref keys, or of the first chunk after it
+	 */
+	size_t chunkAt(const size_t key) const;
+
+	/**
+	 * @brief Combines every chunk of `*this` with the corresponding chunk of @p other
+	 *
+	 * @details @p kernel is the word kernel of the operation, @p keepLeft and @p keepRight tell whether a chunk present in only one of the bitmaps is copied into the result (`true`) or dropped (`false`).
+	 */
+	roaring_bitmap_t combine(const roaring_bitmap_t& other, void (*kernel)(uint64_t*, const uint64_t*, const size_t),
+				 bool (*operation)(const bool, const bool), const bool keepLeft, const bool keepRight) const;
+
+	/**
+	 * @brief Removes the bits beyond @ref bitLength
+	 */
+	void clip();
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Default empty `roaring_bitmap_t` constructor
+	 *
+	 * @details Initialises empty bitmap (bitmap with zero length and no elements).
+	 */
+	roaring_bitmap_t();
+
+	/**
+	 * @brief Length `roaring_bitmap_t` constructor
+	 *
+	 * @details Initialises bitmap of @p length bits, all reset. No memory is allocated until some bits are set.
+	 *
+	 * @param [in] length Number of bits in the bitmap.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise a bitmap of 2^32 reset bits
+	 *	roaring_bitmap_t someBitmap((size_t)1 << 32);
+	 * @endcode
+	 */
+	explicit roaring_bitmap_t(const size_t length);
+
+	/**
+	 * @brief `bitset_t` roaring_bitmap_t constructor
+	 *
+	 * @details Compresses @p bits chunk by chunk. The result has the same length and bits as @p bits.
+	 *
+	 * @param [in] bits Bitset to compress.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Compress a bitset
+	 *	roaring_bitmap_t someBitmap(bitset_t({0, 1, 1, 0}));
+	 * @endcode
+	 */
+	explicit roaring_bitmap_t(const bitset_t& bits);
+
+
+
+	//   ######     ###     ######  ########
+	//  ##    ##   ## ##   ##    ##    ##
+	//  ##        ##   ##  ##          ##
+	//  ##       ##     ##  ######     ##
+	//  ##       #########       ##    ##
+	//  ##    ## ##     ## ##    ##    ##
+	//   ######  ##     ##  ######     ##
+
+	/**
+	 * @brief Casts `roaring_bitmap_t` to `bitset_t`
+	 *
+	 * @details Decompresses the bitmap into a newly constructed bitset of the same length.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Decompress someBitmap
+	 *	bitset_t someBitset = someBitmap;
+	 * @endcode
+	 */
+	operator bitset_t() const;
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns the number of bits in the bitmap
+	 */
+	size_t length() const;
+
+	/**
+	 * @brief Returns the number of bits in the bitmap
+	 *
+	 * @see length()
+	 */
+	size_t size() const {
+		return length();
+	}
+
+	/**
+	 * @brief Returns the number of set bits in the bitmap
+	 *
+	 * @details Containers keep their cardinality, so this takes one addition per stored chunk.
+	 */
+	size_t count() const;
+
+	/**
+	 * @brief Returns the number of bytes used by the containers of the bitmap
+	 *
+	 * Example usage:
+	 * @code
+	 *	// A single run of a million bits takes a few bytes per chunk
+	 *	roaring_bitmap_t someBitmap(1000000);
+	 *	someBitmap.invert();
+	 *	size_t bytes = someBitmap.memoryUsage();
+	 * @endcode
+	 */
+	size_t memoryUsage() const;
+
+	/**
+	 * @brief Sets [to `true`] the bit with @p index
+	 *
+	 * @param [in] index Index of the bit.
+	 *
+	 * @throw std::out_of_range If @p index is not less than length().
+	 */
+	void set(const size_t index);
+
+	/**
+	 * @brief Resets [to `false`] the bit with @p index
+	 *
+	 * @param [in] index Index of the bit.
+	 *
+	 * @throw std::out_of_range If @p index is not less than length().
+	 */
+	void reset(const size_t index);
+
+	/**
+	 * @brief Inverts [complements] all bits in the bitmap
+	 *
+	 * @details Chunks without set bits become a single run, chunks of a single run become empty and are dropped.
+	 */
+	void invert();
+
+	/**
+	 * @brief Returns the number of bits at which @p left and @p right bitmap are different
+	 *
+	 * @details Chunks present in only one of the bitmaps contribute their cardinality, the others are compared without materialising the xor.
+	 *
+	 * @param left The first [left] bitmap.
+	 * @param right The second [right] bitmap.
+	 *
+	 * @return The number of bits at which @p left and @p right bitmap are different.
+	 *
+	 * @warning @p left and @p right bitmaps <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Initialise two bitmaps of equal length
+	 *	roaring_bitmap_t first(bitset_t({0, 1, 1, 0})), second(bitset_t({1, 1, 1, 0}));
+	 *
+	 *	// Calculate the Hamming distance between the bitmaps (1)
+	 *	size_t distance = hammingDistance(first, second);
+	 * @endcode
+	 */
+	friend size_t hammingDistance(const roaring_bitmap_t& left, const roaring_bitmap_t& right);
+
+
+
+	//  ##     ## ##    ##    ###    ########  ##    ##
+	//  ##     ## ###   ##   ## ##   ##     ##  ##  ##
+	//  ##     ## ####  ##  ##   ##  ##     ##   ####
+	//  ##     ## ## ## ## ##     ## ########     ##
+	//  ##     ## ##  #### ######### ##   ##      ##
+	//  ##     ## ##   ### ##     ## ##    ##     ##
+	//   #######  ##    ## ##     ## ##     ##    ##
+
+	/**
+	 * @brief Calculates inverted bitmap value
+	 *
+	 * @details Does not modify `*this` bitmap.
+	 *
+	 * @return Inverted roaring_bitmap_t value.
+	 *
+	 * @see invert()
+	 */
+	roaring_bitmap_t operator~() const;
+
+
+
+	//  ########  #### ##    ##    ###    ########  ##    ##
+	//  ##     ##  ##  ###   ##   ## ##   ##     ##  ##  ##
+	//  ##     ##  ##  ####  ##  ##   ##  ##     ##   ####
+	//  ########   ##  ## ## ## ##     ## ########     ##
+	//  ##     ##  ##  ##  #### ######### ##   ##      ##
+	//  ##     ##  ##  ##   ### ##     ## ##    ##     ##
+	//  ########  #### ##    ## ##     ## ##     ##    ##
+
+	/**
+	 * @brief Exclusive OR operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator^(). Chunks present in only one of the bitmaps are copied without being decoded.
+	 *
+	 * @param [in] other Second `roaring_bitmap_t` operand.
+	 *
+	 * @return `roaring_bitmap_t` value of the length of `*this`.
+	 *
+	 * @warning Bitmaps <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = xor(X1, X2)
+	 *	roaring_bitmap_t Y = X1 ^ X2;
+	 * @endcode
+	 */
+	roaring_bitmap_t operator^(const roaring_bitmap_t& other) const;
+
+	/**
+	 * @brief Conjunction operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator&(). Only chunks present in both bitmaps are visited.
+	 *
+	 * @param [in] other Second `roaring_bitmap_t` operand.
+	 *
+	 * @return `roaring_bitmap_t` value of the length of `*this`.
+	 *
+	 * @warning Bitmaps <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = X1 & X2
+	 *	roaring_bitmap_t Y = X1 & X2;
+	 * @endcode
+	 */
+	roaring_bitmap_t operator&(const roaring_bitmap_t& other) const;
+
+	/**
+	 * @brief Disjunction operator
+	 *
+	 * @details Applied to every pair of corresponding bits, as bitset_t::operator|(). Chunks present in only one of the bitmaps are copied without being decoded.
+	 *
+	 * @param [in] other Second `roaring_bitmap_t` operand.
+	 *
+	 * @return `roaring_bitmap_t` value of the length of `*this`.
+	 *
+	 * @warning Bitmaps <b>must be of equal length</b>.
+	 *
+	 * Example usage:
+	 * @code
+	 *	// Calculate Y = X1 | X2
+	 *	roaring_bitmap_t Y = X1 | X2;
+	 * @endcode
+	 */
+	roaring_bitmap_t operator|(const roaring_bitmap_t& other) const;
+
+
+
+	//   ######   #######  ##     ## ########     ###    ########  ########
+	//  ##    ## ##     ## ###   ### ##     ##   ## ##   ##     ## ##
+	//  ##       ##     ## #### #### ##     ##  ##   ##  ##     ## ##
+	//  ##       ##     ## ## ### ## ########  ##     ## ########  ######
+	//  ##       ##     ## ##     ## ##        ######### ##   ##   ##
+	//  ##    ## ##     ## ##     ## ##        ##     ## ##    ##  ##
+	//   ######   #######  ##     ## ##        ##     ## ##     ## ########
+
+	/**
+	 * @brief Equal to operator
+	 *
+	 * @details Bitmaps are equal when they have the same length and the same bits set, regardless of the containers holding them.
+	 */
+	bool operator==(const roaring_bitmap_t& other) const;
+
+	/**
+	 * @brief Not equal to operator
+	 */
+	bool operator!=(const roaring_bitmap_t& other) const;
+
+
+
+	//     ###     ######   ######  ########  ######   ######
+	//    ## ##   ##    ## ##    ## ##       ##    ## ##    ##
+	//   ##   ##  ##       ##       ##       ##       ##
+	//  ##     ## ##       ##       ######    ######   ######
+	//  ######### ##       ##       ##             ##       ##
+	//  ##     ## ##    ## ##    ## ##       ##    ## ##    ##
+	//  ##     ##  ######   ######  ########  ######   ######
+
+	/**
+	 * @brief Returns the value of the bit with @p index
+	 *
+	 * @details Locates the chunk by binary search over the stored keys, then the bit within its container.
+	 *
+	 * @param [in] index Index of the bit.
+	 *
+	 * @return `bit_t` value of the bit.
+	 *
+	 * @warning No bounds checking is performed; see at().
+	 */
+	bit_t operator[](const size_t index) const;
+
+	/**
+	 * @brief Returns the value of the bit with @p index
+	 *
+	 * @param [in] index Index of the bit.
+	 *
+	 * @return `bit_t` value of the bit.
+	 *
+	 * @throw std::out_of_range If @p index is not less than length().
+	 */
+	bit_t at(const size_t index) const;
+
+
+
+	//  #### ##    ## ######## ######## ########  ########    ###     ######  ########
+	//   ##  ###   ##    ##    ##       ##     ## ##         ## ##   ##    ## ##
+	//   ##  ####  ##    ##    ##       ##     ## ##        ##   ##  ##       ##
+	//   ##  ## ## ##    ##    ######   ########  ######   ##     ## ##       ######
+	//   ##  ##  ####    ##    ##       ##   ##   ##       ######### ##       ##
+	//   ##  ##   ###    ##    ##       ##    ##  ##       ##     ## ##    ## ##
+	//  #### ##    ##    ##    ######## ##     ## ##       ##     ##  ######  ########
+
+	/**
+	 * @brief Returns string with the binary representation of the bitmap
+	 *
+	 * @return `std::string` containing the binary bit representation.
+	 */
+	std::string toBinaryString() const;
+
+	/**
+	 * @brief Returns string with the binary representation of the bitmap
+	 *
+	 * @details Bits in the string would be separated by the delimiter.
+	 *
+	 * @return `std::string` containing the binary bit representation w/delimiters.
+	 */
+	std::string toBinaryString(const std::string delimiter) const;
+
+	/**
+	 * @brief Inserts @p bits binary representation into @p os
+	 *
+	 * @details Insertion is performed with toBinaryString() method.
+	 *
+	 * @param [in,out] os An `std::ostream` which method is invoked upon.
+	 * @param [in] bits Bitmap to be inserted.
+	 *
+	 * @return Modified `std::ostream` stream.
+	 */
+	friend std::ostream& operator<<(std::ostream& os, const roaring_bitmap_t& bits);
+};
+
+#endif
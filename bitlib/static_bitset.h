@@ -0,0 +1,491 @@
+/**
+ * @file static_bitset.h
+ * @date October 16, 2026
+ * @brief Contains definition of the `static_bitset_t` class template
+ */
+
+#ifndef bitlib___static_bitset_h
+#define bitlib___static_bitset_h
+
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_view.h"
+#include "bitset_codec.h"
+
+/**
+ * @brief Compile-time sequence of word indices, expanded to unroll the word loops of `static_bitset_t`
+ */
+template <size_t... Indices>
+struct static_indices_t {
+};
+
+template <size_t Count, size_t... Indices>
+struct static_make_indices_t : static_make_indices_t<Count - 1, Count - 1, Indices...> {
+};
+
+template <size_t... Indices>
+struct static_make_indices_t<0, Indices...> {
+	typedef static_indices_t<Indices...> type;
+};
+
+// Stages of the portable population count of a word, one expression each as C++11 constexpr functions require
+constexpr uint64_t staticPairCounts(const uint64_t word) {
+	return word - ((word >> 1) & 0x5555555555555555ULL);
+}
+
+constexpr uint64_t staticNibbleCounts(const uint64_t pairs) {
+	return (pairs & 0x3333333333333333ULL) + ((pairs >> 2) & 0x3333333333333333ULL);
+}
+
+/**
+ * @brief Returns the number of set bits of @p word, as a constant expression
+ *
+ * @details Compiles to the POPCNT instruction on GCC and Clang where available, see popcountWord().
+ */
+constexpr size_t staticPopcount(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)__builtin_popcountll(word);
+#else
+	return (size_t)((((staticNibbleCounts(staticPairCounts(word)) + (staticNibbleCounts(staticPairCounts(word)) >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief Bitset of @p Length bits, a constant of the program, stored inline
+ *
+ * @details Keeps its words in an array member: a `static_bitset_t` makes no allocation, is as large as its words, and is trivially copyable, thus millions of short signatures take no more than their bits. The bits are laid out as in `bitset_t` (bit @c i in the word @c i / 64 at the position @c i % 64, unused bits of the last word reset).
+ *
+ * The operators, the shifts, the rotations, count(), hammingDistance() and scalarProduct() are `constexpr`: each expands into one expression per word over a compile-time index sequence, so that the compiler unrolls them completely, and they can be evaluated at compile time. C++11 `constexpr` functions cannot modify the object, hence the shifts and the rotations have value-returning forms (shiftedLeft(), rotatedLeft()...) besides the in-place forms of `bitset_t`.
+ *
+ * @note Expanding the words takes a template instantiation per word; lengths of up to some tens of thousands of bits stay within the default depth of the compilers.
+ *
+ * Example usage:
+ * @code
+ *	// 128-bit signatures, no allocation
+ *	std::vector<static_bitset_t<128> > signatures(1000000);
+ *
+ *	// Evaluated by the compiler
+ *	constexpr static_bitset_t<8> mask(0x0F);
+ *	static_assert((~mask).count() == 4, "upper half");
+ * @endcode
+ */
+template <size_t Length>
+class static_bitset_t {
+public:
+	/**
+	 * @brief Storage word type, same as @ref bitset_t::word_t
+	 */
+	typedef bitset_t::word_t word_t;
+private:
+	typedef typename static_make_indices_t<(Length + 63) / 64>::type indices_t;
+
+	/**
+	 * @brief Selects the constructor from the words of the bitset
+	 */
+	struct words_tag_t {
+	};
+
+	/**
+	 * @brief Storage of the bits, of at least one word so that the array is never empty
+	 */
+	word_t storage[(Length + 63) / 64 == 0 ? 1 : (Length + 63) / 64];
+
+	template <class... Words>
+	constexpr static_bitset_t(words_tag_t, Words... values) : storage{values...} {
+	}
+
+	/**
+	 * @brief Returns the mask of the bits of word @p index within the bitset
+	 */
+	static constexpr word_t tailMask(const size_t index) {
+		return (index + 1 < wordCount() || Length % 64 == 0) ? ~(word_t)0 : ~(word_t)0 >> ((64 - Length % 64) % 64);
+	}
+
+	constexpr word_t wordAt(const size_t index) const {
+		return (index < wordCount()) ? storage[index] : 0;
+	}
+
+	// Word index of the bitset shifted towards bit 0 by wordShift words and bitShift bits
+	constexpr word_t downWord(const size_t index, const size_t wordShift, const unsigned bitShift) const {
+		return (wordAt(index + wordShift) >> bitShift) | ((bitShift != 0) ? wordAt(index + wordShift + 1) << (64 - bitShift) : 0);
+	}
+
+	// Word index of the bitset shifted away from bit 0 by wordShift words and bitShift bits
+	constexpr word_t upWord(const size_t index, const size_t wordShift, const unsigned bitShift) const {
+		return ((index >= wordShift ? storage[index - wordShift] << bitShift : 0) | ((bitShift != 0 && index >= wordShift + 1) ? storage[index - wordShift - 1] >> (64 - bitShift) : 0)) & tailMask(index);
+	}
+
+	template <size_t... Indices>
+	static constexpr static_bitset_t fromWord(const word_t value, static_indices_t<Indices...>) {
+		return static_bitset_t(words_tag_t(), ((Indices == 0) ? value & tailMask(0) : (word_t)0)...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t xorWith(const static_bitset_t& other, static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), (storage[Indices] ^ other.storage[Indices])...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t andWith(const static_bitset_t& other, static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), (storage[Indices] & other.storage[Indices])...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t orWith(const static_bitset_t& other, static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), (storage[Indices] | other.storage[Indices])...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t inverted(static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), (~storage[Indices] & tailMask(Indices))...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t shiftedDown(const size_t wordShift, const unsigned bitShift, static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), downWord(Indices, wordShift, bitShift)...);
+	}
+
+	template <size_t... Indices>
+	constexpr static_bitset_t shiftedUp(const size_t wordShift, const unsigned bitShift, static_indices_t<Indices...>) const {
+		return static_bitset_t(words_tag_t(), upWord(Indices, wordShift, bitShift)...);
+	}
+
+	constexpr size_t countFrom(const size_t index) const {
+		return (index < wordCount()) ? staticPopcount(storage[index]) + countFrom(index + 1) : 0;
+	}
+
+	constexpr size_t distanceFrom(const static_bitset_t& other, const size_t index) const {
+		return (index < wordCount()) ? staticPopcount(storage[index] ^ other.storage[index]) + distanceFrom(other, index + 1) : 0;
+	}
+
+	constexpr size_t productFrom(const static_bitset_t& other, const size_t index) const {
+		return (index < wordCount()) ? staticPopcount(storage[index] & other.storage[index]) + productFrom(other, index + 1) : 0;
+	}
+
+	constexpr bool equalFrom(const static_bitset_t& other, const size_t index) const {
+		return (index >= wordCount()) || (storage[index] == other.storage[index] && equalFrom(other, index + 1));
+	}
+
+	constexpr bool anyFrom(const size_t index) const {
+		return (index < wordCount()) && (storage[index] != 0 || anyFrom(index + 1));
+	}
+public:
+
+	//   ######  ##    ##  ######  ######## ########   ######
+	//  ##    ## ###   ## ##    ##    ##    ##     ## ##    ##
+	//  ##       ####  ## ##          ##    ##     ## ##
+	//  ##       ## ## ##  ######     ##    ########   ######
+	//  ##       ##  ####       ##    ##    ##   ##         ##
+	//  ##    ## ##   ### ##    ##    ##    ##    ##  ##    ##
+	//   ######  ##    ##  ######     ##    ##     ##  ######
+
+	/**
+	 * @brief Default `static_bitset_t` constructor
+	 *
+	 * @details Initialises a bitset of @p Length bits, all reset.
+	 */
+	constexpr static_bitset_t() : storage() {
+	}
+
+	/**
+	 * @brief Word `static_bitset_t` constructor
+	 *
+	 * @details Initialises the first 64 bits (or fewer if the bitset is shorter) from @p value, bit @c i of the bitset being bit @c i of @p value; the other bits are reset.
+	 *
+	 * @param [in] value Initial value of the first word.
+	 *
+	 * Example usage:
+	 * @code
+	 *	constexpr static_bitset_t<16> flags(0x8001);
+	 * @endcode
+	 */
+	constexpr explicit static_bitset_t(const word_t value) : static_bitset_t(fromWord(value, indices_t())) {
+	}
+
+	/**
+	 * @brief Initializer list `static_bitset_t` constructor
+	 *
+	 * @details Sets bit @c i to element @c i of @p bits; elements past @p Length are ignored, bits past the list are reset.
+	 *
+	 * Example usage:
+	 * @code
+	 *	static_bitset_t<4> bits({0, 1, 1, 0});
+	 * @endcode
+	 */
+	static_bitset_t(const std::initializer_list<bool> bits) : storage() {
+		size_t index = 0;
+		for (const bool bit : bits) {
+			if (index == Length) break;
+			set(index++, bit);
+		}
+	}
+
+	/**
+	 * @brief `bitset_t` conversion constructor
+	 *
+	 * @throw std::invalid_argument If the length of @p bits is not @p Length.
+	 */
+	explicit static_bitset_t(const bitset_view_t& bits) : storage() {
+		if (bits.length() != Length)
+			throw std::invalid_argument("static_bitset_t::static_bitset_t: length differs");
+		for (size_t index = 0; index < wordCount(); ++index)
+			storage[index] = bits.paddedWord(index);
+	}
+
+
+
+	//  ##        #######   ######   ####  ######
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ##       ##     ## ##         ##  ##
+	//  ##       ##     ## ##   ####  ##  ##
+	//  ##       ##     ## ##    ##   ##  ##
+	//  ##       ##     ## ##    ##   ##  ##    ##
+	//  ########  #######   ######   ####  ######
+
+	/**
+	 * @brief Returns length of the bitset
+	 */
+	static constexpr size_t length() {
+		return Length;
+	}
+
+	/**
+	 * @brief Returns the number of storage words
+	 */
+	static constexpr size_t wordCount() {
+		return (Length + 63) / 64;
+	}
+
+	/**
+	 * @brief Returns pointer to the storage words, see bitset_t::data()
+	 */
+	const word_t* data() const {
+		return storage;
+	}
+
+	/**
+	 * @brief Returns the bit at @p index, unchecked
+	 */
+	constexpr bool operator[](const size_t index) const {
+		return ((storage[index / 64] >> (index % 64)) & 1) != 0;
+	}
+
+	/**
+	 * @brief Returns the bit at @p index
+	 *
+	 * @throw std::out_of_range If @p index is not below @p Length.
+	 */
+	bool at(const size_t index) const {
+		if (index >= Length) throw std::out_of_range("static_bitset_t::at");
+		return (*this)[index];
+	}
+
+	/**
+	 * @brief Sets the bit at @p index to @p value, unchecked
+	 */
+	void set(const size_t index, const bool value = true) {
+		const word_t mask = (word_t)1 << (index % 64);
+		storage[index / 64] = value ? (storage[index / 64] | mask) : (storage[index / 64] & ~mask);
+	}
+
+	/**
+	 * @brief Sets every bit
+	 */
+	void setAll() {
+		*this = ~static_bitset_t();
+	}
+
+	/**
+	 * @brief Resets every bit
+	 */
+	void resetAll() {
+		*this = static_bitset_t();
+	}
+
+	/**
+	 * @brief Inverts every bit
+	 */
+	void invert() {
+		*this = ~*this;
+	}
+
+	/**
+	 * @brief Returns the number of set bits
+	 */
+	constexpr size_t count() const {
+		return countFrom(0);
+	}
+
+	/**
+	 * @brief Tests whether any bit is set
+	 */
+	constexpr bool any() const {
+		return anyFrom(0);
+	}
+
+	/**
+	 * @brief Returns a `bitset_t` copy of the bits
+	 */
+	bitset_t toBitset() const {
+		return bitset_t(bitset_t::word_vector_t(storage, storage + wordCount()), Length);
+	}
+
+	/**
+	 * @brief Returns the string of '0' and '1' characters of the bits, see bitset_t::toBinaryString()
+	 */
+	std::string toBinaryString() const {
+		return encodeBitset(bitset_view_t(storage, Length));
+	}
+
+
+
+	//   ######  ##     ## #### ######## ######## #### ##    ##  ######
+	//  ##    ## ##     ##  ##  ##          ##     ##  ###   ## ##    ##
+	//  ##       ##     ##  ##  ##          ##     ##  ####  ## ##
+	//   ######  #########  ##  ######      ##     ##  ## ## ## ##   ####
+	//        ## ##     ##  ##  ##          ##     ##  ##  #### ##    ##
+	//  ##    ## ##     ##  ##  ##          ##     ##  ##   ### ##    ##
+	//   ######  ##     ## #### ##          ##    #### ##    ##  ######
+
+	/**
+	 * @brief Returns the bitset shifted by @p shift bits towards bit 0, see bitset_t::shiftLeft()
+	 */
+	constexpr static_bitset_t shiftedLeft(const size_t shift) const {
+		return (shift >= Length) ? static_bitset_t() : shiftedDown(shift / 64, (unsigned)(shift % 64), indices_t());
+	}
+
+	/**
+	 * @brief Returns the bitset shifted by @p shift bits away from bit 0, see bitset_t::shiftRight()
+	 */
+	constexpr static_bitset_t shiftedRight(const size_t shift) const {
+		return (shift >= Length) ? static_bitset_t() : shiftedUp(shift / 64, (unsigned)(shift % 64), indices_t());
+	}
+
+	/**
+	 * @brief Returns the bitset rotated by @p shift bits towards bit 0, see bitset_t::rotateLeft()
+	 */
+	constexpr static_bitset_t rotatedLeft(const size_t shift) const {
+		return (Length == 0 || shift % Length == 0) ? *this : shiftedLeft(shift % Length) | shiftedRight(Length - shift % Length);
+	}
+
+	/**
+	 * @brief Returns the bitset rotated by @p shift bits away from bit 0, see bitset_t::rotateRight()
+	 */
+	constexpr static_bitset_t rotatedRight(const size_t shift) const {
+		return (Length == 0 || shift % Length == 0) ? *this : rotatedLeft(Length - shift % Length);
+	}
+
+	/**
+	 * @brief Shifts the bits by @p shift towards bit 0, see bitset_t::shiftLeft()
+	 */
+	void shiftLeft(const size_t shift) {
+		*this = shiftedLeft(shift);
+	}
+
+	/**
+	 * @brief Shifts the bits by @p shift away from bit 0, see bitset_t::shiftRight()
+	 */
+	void shiftRight(const size_t shift) {
+		*this = shiftedRight(shift);
+	}
+
+	/**
+	 * @brief Rotates the bits by @p shift towards bit 0, see bitset_t::rotateLeft()
+	 */
+	void rotateLeft(const size_t shift) {
+		*this = rotatedLeft(shift);
+	}
+
+	/**
+	 * @brief Rotates the bits by @p shift away from bit 0, see bitset_t::rotateRight()
+	 */
+	void rotateRight(const size_t shift) {
+		*this = rotatedRight(shift);
+	}
+
+
+
+	//   #######  ########  ######## ########     ###    ########  #######  ########   ######
+	//  ##     ## ##     ## ##       ##     ##   ## ##      ##    ##     ## ##     ## ##    ##
+	//  ##     ## ##     ## ##       ##     ##  ##   ##     ##    ##     ## ##     ## ##
+	//  ##     ## ########  ######   ########  ##     ##    ##    ##     ## ########   ######
+	//  ##     ## ##        ##       ##   ##   #########    ##    ##     ## ##   ##         ##
+	//  ##     ## ##        ##       ##    ##  ##     ##    ##    ##     ## ##    ##  ##    ##
+	//   #######  ##        ######## ##     ## ##     ##    ##     #######  ##     ##  ######
+
+	constexpr static_bitset_t operator^(const static_bitset_t& other) const {
+		return xorWith(other, indices_t());
+	}
+
+	constexpr static_bitset_t operator&(const static_bitset_t& other) const {
+		return andWith(other, indices_t());
+	}
+
+	constexpr static_bitset_t operator|(const static_bitset_t& other) const {
+		return orWith(other, indices_t());
+	}
+
+	constexpr static_bitset_t operator~() const {
+		return inverted(indices_t());
+	}
+
+	constexpr static_bitset_t operator!() const {
+		return inverted(indices_t());
+	}
+
+	static_bitset_t& operator^=(const static_bitset_t& other) {
+		return *this = *this ^ other;
+	}
+
+	static_bitset_t& operator&=(const static_bitset_t& other) {
+		return *this = *this & other;
+	}
+
+	static_bitset_t& operator|=(const static_bitset_t& other) {
+		return *this = *this | other;
+	}
+
+	/**
+	 * @brief Scalar product over GF(2), see bitset_t::operator*()
+	 *
+	 * @return Parity of the number of positions set in both bitsets, of the same type as bitset_t::operator*(). `bit_t` is not a literal type, hence this operator is not `constexpr`: constant expressions use scalarProduct().
+	 */
+	bit_t operator*(const static_bitset_t& other) const {
+		return bit_t(scalarProduct(other));
+	}
+
+	/**
+	 * @brief Scalar product over GF(2) as a constant expression, see operator*()
+	 */
+	constexpr bool scalarProduct(const static_bitset_t& other) const {
+		return (productFrom(other, 0) & 1) != 0;
+	}
+
+	constexpr bool operator==(const static_bitset_t& other) const {
+		return equalFrom(other, 0);
+	}
+
+	constexpr bool operator!=(const static_bitset_t& other) const {
+		return !equalFrom(other, 0);
+	}
+
+	/**
+	 * @brief Returns the number of bits at which @p left and @p right differ, see hammingDistance(const bitset_t&, const bitset_t&)
+	 */
+	friend constexpr size_t hammingDistance(const static_bitset_t& left, const static_bitset_t& right) {
+		return left.distanceFrom(right, 0);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const static_bitset_t& bits) {
+		writeBitset(os, bitset_view_t(bits.storage, Length));
+		return os;
+	}
+};
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file test_atomic_bitset.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `atomic_bitset_t` under concurrent writers
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_support.h"
+#include "atomic_bitset.h"
+
+// More writers than hardware threads, so that some of them share the stripe of the counters kept for late threads
+static const size_t writers = std::max<size_t>(std::thread::hardware_concurrency(), 2) + 2;
+
+// A bitset of a single cache line has a single stripe of its own, a large one has a stripe per hardware thread
+static const size_t lengths[] = {128, 1 << 16};
+
+template <class Task>
+static void runWriters(const Task& task) {
+	std::vector<std::thread> threads;
+	for (size_t writer = 0; writer < writers; ++writer)
+		threads.emplace_back([&task, writer]() { task(writer); });
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+TEST_CASE(testAndSetHasOneWinnerPerBit) {
+	for (const size_t length : lengths) {
+		atomic_bitset_t bits(length);
+		std::vector<std::vector<size_t>> won(writers);
+		runWriters([&](const size_t writer) {
+			for (size_t step = 0; step < length; ++step) {
+				const size_t index = (step + writer * 61) % length;
+				if (!bits.testAndSet(index)) won[writer].push_back(index);
+			}
+		});
+		std::vector<size_t> winners;
+		for (const std::vector<size_t>& indices : won)
+			winners.insert(winners.end(), indices.begin(), indices.end());
+		std::sort(winners.begin(), winners.end());
+		CHECK_EQUAL(winners.size(), length);
+		CHECK(std::unique(winners.begin(), winners.end()) == winners.end());
+		CHECK_EQUAL(bits.count(), length);
+		CHECK_EQUAL(bits.snapshot().count(), length);
+	}
+}
+
+TEST_CASE(claimFirstHandsOutUniqueSlots) {
+	for (const size_t length : lengths) {
+		atomic_bitset_t slots(length);
+		std::vector<std::vector<size_t>> claimed(writers);
+		runWriters([&](const size_t writer) {
+			for (size_t slot = slots.claimFirst(writer * 64 % length); slot != bitset_t::npos; slot = slots.claimFirst(slot))
+				claimed[writer].push_back(slot);
+		});
+		std::vector<size_t> all;
+		for (const std::vector<size_t>& indices : claimed)
+			all.insert(all.end(), indices.begin(), indices.end());
+		std::sort(all.begin(), all.end());
+		CHECK_EQUAL(all.size(), length);
+		CHECK(std::unique(all.begin(), all.end()) == all.end());
+		CHECK_EQUAL(slots.count(), length);
+		CHECK_EQUAL(slots.claimFirst(), bitset_t::npos);
+	}
+}
+
+TEST_CASE(countSeesWholeModifications) {
+	for (const size_t length : lengths) {
+		atomic_bitset_t bits(length + 1);
+		std::atomic<bool> done(false);
+		size_t reads = 0, odd = 0, decreasing = 0;
+		std::thread reader([&]() {
+			size_t previous = 0;
+			while (!done.load()) {
+				const size_t count = bits.count();
+				odd += count % 2;
+				decreasing += count < previous;
+				previous = count;
+				++reads;
+			}
+		});
+		// Pairs start at odd bits, so that every 32nd pair straddles two words
+		std::atomic<size_t> fresh(0);
+		runWriters([&](const size_t writer) {
+			for (size_t first = 1 + 2 * writer; first + 1 < length + 1; first += 2 * writers)
+				fresh += bits.fetchOr(first, first + 2);
+			for (size_t first = 1; first + 1 < length + 1; first += 2)
+				fresh += bits.fetchOr(first, first + 2);
+		});
+		done.store(true);
+		reader.join();
+		CHECK(reads != 0);
+		CHECK_EQUAL(odd, (size_t)0);
+		CHECK_EQUAL(decreasing, (size_t)0);
+		CHECK_EQUAL(fresh.load(), length);
+		CHECK_EQUAL(bits.count(), length);
+		CHECK_EQUAL(bits.snapshot().count(), length);
+		CHECK(!bits.test(0));
+	}
+}
+
+TEST_CASE(countFollowsSetsAndResets) {
+	for (const size_t length : lengths) {
+		atomic_bitset_t bits(bitset_t(std::vector<bool>(length, true)));
+		runWriters([&](const size_t writer) {
+			for (size_t index = writer; index < length; index += writers) {
+				bits.reset(index);
+				if (index % 3 == 0) bits.set(index);
+				if (index % 5 == 0) bits.testAndReset(index);
+			}
+		});
+		const bitset_t snapshot = bits.snapshot();
+		CHECK_EQUAL(bits.count(), snapshot.count());
+		for (size_t index = 0; index < length; ++index)
+			CHECK_EQUAL(bits.test(index), index % 3 == 0 && index % 5 != 0);
+		bits.resetAll();
+		CHECK_EQUAL(bits.count(), (size_t)0);
+	}
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_bitap_matcher.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `bitap_matcher_t` against a naive scan and an edit distance table
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_support.h"
+#include "bitap_matcher.h"
+
+static std::string randomText(std::mt19937_64& random, const size_t length, const std::string& alphabet) {
+	std::string text(length, ' ');
+	for (char& character : text)
+		character = alphabet[random() % alphabet.size()];
+	return text;
+}
+
+// Occurrences with at most errors substitutions, by a comparison of every window
+static std::vector<pattern_match_t> naiveHamming(const std::vector<std::string>& patterns, const std::string& text, const size_t errors) {
+	std::vector<pattern_match_t> matches;
+	for (size_t end = 1; end <= text.size(); ++end) {
+		for (size_t pattern = 0; pattern < patterns.size(); ++pattern) {
+			const std::string& word = patterns[pattern];
+			if (word.size() > end) continue;
+			size_t mismatches = 0;
+			for (size_t index = 0; index < word.size(); ++index)
+				mismatches += word[index] != text[end - word.size() + index];
+			if (mismatches <= errors) matches.push_back(pattern_match_t{pattern, end, mismatches});
+		}
+	}
+	return matches;
+}
+
+// Occurrences with at most errors edits, by the table of the smallest edit distance between the pattern and a substring ending at every offset
+static std::vector<pattern_match_t> naiveLevenshtein(const std::vector<std::string>& patterns, const std::string& text, const size_t errors) {
+	std::vector<pattern_match_t> matches;
+	std::vector<std::vector<size_t>> columns;
+	for (const std::string& word : patterns) {
+		std::vector<size_t> column(word.size() + 1);
+		for (size_t index = 0; index <= word.size(); ++index)
+			column[index] = index;
+		columns.push_back(column);
+	}
+	for (size_t end = 1; end <= text.size(); ++end) {
+		for (size_t pattern = 0; pattern < patterns.size(); ++pattern) {
+			const std::string& word = patterns[pattern];
+			std::vector<size_t>& column = columns[pattern];
+			size_t diagonal = column[0];
+			for (size_t index = 1; index <= word.size(); ++index) {
+				const size_t above = column[index];
+				column[index] = std::min(std::min(column[index] + 1, column[index - 1] + 1), diagonal + (word[index - 1] != text[end - 1]));
+				diagonal = above;
+			}
+			if (column[word.size()] <= errors) matches.push_back(pattern_match_t{pattern, end, column[word.size()]});
+		}
+	}
+	return matches;
+}
+
+static bool sameMatches(const std::vector<pattern_match_t>& left, const std::vector<pattern_match_t>& right) {
+	if (left.size() != right.size()) return false;
+	for (size_t index = 0; index < left.size(); ++index)
+		if (left[index].pattern != right[index].pattern || left[index].end != right[index].end || left[index].errors != right[index].errors) return false;
+	return true;
+}
+
+// Reads text in chunks of random sizes, so that occurrences cross the chunk boundaries
+static std::vector<pattern_match_t> scanInChunks(bitap_matcher_t& matcher, std::mt19937_64& random, const std::string& text, const size_t largest) {
+	std::vector<pattern_match_t> matches;
+	matcher.reset();
+	for (size_t first = 0; first < text.size();) {
+		const size_t length = std::min<size_t>(text.size() - first, random() % (largest + 1));
+		matcher.scan(text.data() + first, length, matches);
+		first += length;
+	}
+	CHECK_EQUAL(matcher.position(), text.size());
+	return matches;
+}
+
+static std::vector<std::string> patternsOf(std::mt19937_64& random, const std::vector<size_t>& lengths, const std::string& alphabet) {
+	std::vector<std::string> patterns;
+	for (const size_t length : lengths)
+		patterns.push_back(randomText(random, length, alphabet));
+	return patterns;
+}
+
+// Pattern sets within a single state word, filling it exactly, with patterns meeting at word boundaries, and longer than a word
+static const std::vector<std::vector<size_t>> patternSets = {
+	{3}, {1, 2, 5}, {64}, {30, 34}, {31, 40, 9}, {63, 2, 64}, {100}, {70, 1, 130}
+};
+
+TEST_CASE(exactMatchesNaiveScan) {
+	std::mt19937_64 random(12);
+	for (const std::vector<size_t>& lengths : patternSets) {
+		const std::vector<std::string> patterns = patternsOf(random, lengths, "ab");
+		std::string text = randomText(random, 3000, "ab");
+		// Plant every pattern a few times, some of them overlapping
+		for (size_t copy = 0; copy < 3; ++copy)
+			for (const std::string& pattern : patterns)
+				text.replace(random() % (text.size() - pattern.size()), pattern.size(), pattern);
+		bitap_matcher_t matcher(patterns);
+		const std::vector<pattern_match_t> expected = naiveHamming(patterns, text, 0);
+		CHECK(!expected.empty());
+		CHECK(sameMatches(matcher.find(text), expected));
+		CHECK(sameMatches(scanInChunks(matcher, random, text, 1), expected));
+		CHECK(sameMatches(scanInChunks(matcher, random, text, 100), expected));
+	}
+}
+
+TEST_CASE(hammingMatchesNaiveScan) {
+	std::mt19937_64 random(13);
+	for (const std::vector<size_t>& lengths : patternSets) {
+		for (const size_t errors : {1, 2, 4}) {
+			const std::vector<std::string> patterns = patternsOf(random, lengths, "acgt");
+			const std::string text = randomText(random, 1500, "acgt");
+			bitap_matcher_t matcher(patterns, errors, bitap_matcher_t::distance_t::hamming);
+			const std::vector<pattern_match_t> expected = naiveHamming(patterns, text, errors);
+			CHECK(sameMatches(matcher.find(text), expected));
+			CHECK(sameMatches(scanInChunks(matcher, random, text, 70), expected));
+		}
+	}
+}
+
+TEST_CASE(levenshteinMatchesEditDistance) {
+	std::mt19937_64 random(14);
+	for (const std::vector<size_t>& lengths : patternSets) {
+		for (const size_t errors : {1, 2, 3}) {
+			const std::vector<std::string> patterns = patternsOf(random, lengths, "acgt");
+			const std::string text = randomText(random, 1500, "acgt");
+			bitap_matcher_t matcher(patterns, errors, bitap_matcher_t::distance_t::levenshtein);
+			const std::vector<pattern_match_t> expected = naiveLevenshtein(patterns, text, errors);
+			CHECK(sameMatches(matcher.find(text), expected));
+			CHECK(sameMatches(scanInChunks(matcher, random, text, 70), expected));
+		}
+	}
+}
+
+TEST_CASE(registerPathKeepsStateAcrossChunks) {
+	// A single word of exact patterns runs the register loop of scan()
+	bitap_matcher_t matcher({"abcab", "cab", "b"});
+	std::vector<pattern_match_t> matches;
+	const std::string text = "xxabcabcabyy";
+	for (const char character : text)
+		matcher.scan(&character, 1, matches);
+	CHECK(sameMatches(matches, naiveHamming({"abcab", "cab", "b"}, text, 0)));
+	CHECK_EQUAL(matcher.position(), text.size());
+	matcher.reset();
+	CHECK_EQUAL(matcher.position(), (size_t)0);
+	matches.clear();
+	matcher.scan("ab", 2, matches);
+	matcher.scan("", 0, matches);
+	matcher.scan("cab", 3, matches);
+	CHECK(sameMatches(matches, naiveHamming({"abcab", "cab", "b"}, "abcab", 0)));
+}
+
+TEST_CASE(comparesBytesUnsigned) {
+	const std::string pattern = "\xff\x80" "a";
+	bitap_matcher_t matcher({pattern});
+	const std::vector<pattern_match_t> matches = matcher.find("zz" + pattern + pattern);
+	CHECK_EQUAL(matches.size(), (size_t)2);
+	CHECK_EQUAL(matches.back().end, (size_t)8);
+}
+
+TEST_CASE(rejectsEmptyPatterns) {
+	CHECK_THROWS(bitap_matcher_t(std::vector<std::string>()), std::invalid_argument);
+	CHECK_THROWS(bitap_matcher_t({"abc", ""}), std::invalid_argument);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,222 @@
+/**
+ * @file test_bitmatrix.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `bitmatrix_t` against a naive per-bit reference
+ */
+
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "test_support.h"
+#include "bitmatrix.h"
+
+typedef std::vector<std::vector<bool>> reference_t;
+
+// Dimensions around the word boundaries, and sizes which are not multiples of the eight rows of a Four Russians group
+static const size_t dimensions[] = {1, 5, 8, 9, 63, 64, 65, 129};
+
+static reference_t randomReference(std::mt19937_64& random, const size_t rows, const size_t columns, const double density = 0.5) {
+	reference_t reference;
+	for (size_t row = 0; row < rows; ++row)
+		reference.push_back(randomBits(random, columns, density));
+	return reference;
+}
+
+static bitmatrix_t matrixOf(const reference_t& reference, const size_t columns) {
+	bitmatrix_t matrix(reference.size(), columns);
+	for (size_t row = 0; row < reference.size(); ++row)
+		for (size_t column = 0; column < columns; ++column)
+			if (reference[row][column]) matrix.set(row, column);
+	return matrix;
+}
+
+static reference_t naiveProduct(const reference_t& left, const reference_t& right, const size_t inner, const size_t columns) {
+	reference_t product(left.size(), std::vector<bool>(columns, false));
+	for (size_t row = 0; row < left.size(); ++row)
+		for (size_t column = 0; column < columns; ++column) {
+			bool sum = false;
+			for (size_t index = 0; index < inner; ++index)
+				sum ^= left[row][index] && right[index][column];
+			product[row][column] = sum;
+		}
+	return product;
+}
+
+static size_t naiveRank(reference_t rows, const size_t columns) {
+	size_t rank = 0;
+	for (size_t column = 0; column < columns && rank < rows.size(); ++column) {
+		size_t pivot = rank;
+		while (pivot < rows.size() && !rows[pivot][column]) ++pivot;
+		if (pivot == rows.size()) continue;
+		std::swap(rows[rank], rows[pivot]);
+		for (size_t row = 0; row < rows.size(); ++row)
+			if (row != rank && rows[row][column])
+				for (size_t index = 0; index < columns; ++index)
+					rows[row][index] = rows[row][index] != rows[rank][index];
+		++rank;
+	}
+	return rank;
+}
+
+// Matrices of rank well below their dimensions, as products of thinner matrices
+static reference_t deficientReference(std::mt19937_64& random, const size_t rows, const size_t columns, const size_t inner) {
+	return naiveProduct(randomReference(random, rows, inner), randomReference(random, inner, columns), inner, columns);
+}
+
+TEST_CASE(transposesAsReference) {
+	std::mt19937_64 random(24);
+	for (const size_t rows : dimensions)
+		for (const size_t columns : dimensions) {
+			const reference_t reference = randomReference(random, rows, columns);
+			const bitmatrix_t transposed = matrixOf(reference, columns).transposed();
+			CHECK_EQUAL(transposed.rows(), columns);
+			CHECK_EQUAL(transposed.columns(), rows);
+			size_t mismatches = 0;
+			for (size_t row = 0; row < rows; ++row)
+				for (size_t column = 0; column < columns; ++column)
+					mismatches += (bool)transposed.at(column, row) != reference[row][column];
+			CHECK_EQUAL(mismatches, (size_t)0);
+			CHECK_EQUAL(transposed.transposed(), matrixOf(reference, columns));
+		}
+	uint64_t block[64] = {};
+	block[0] = 0x2;
+	block[63] = 1ULL << 62;
+	transposeBlock64(block);
+	CHECK_EQUAL(block[1], (uint64_t)0x1);
+	CHECK_EQUAL(block[62], 1ULL << 63);
+	CHECK_EQUAL(block[0] | block[63], (uint64_t)0);
+}
+
+TEST_CASE(multipliesVectorsAsReference) {
+	std::mt19937_64 random(25);
+	for (const size_t rows : dimensions)
+		for (const size_t columns : dimensions) {
+			const reference_t reference = randomReference(random, rows, columns);
+			const bitmatrix_t matrix = matrixOf(reference, columns);
+			const std::vector<bool> column = randomBits(random, columns), row = randomBits(random, rows);
+			std::vector<bool> right(rows, false), left(columns, false);
+			for (size_t i = 0; i < rows; ++i)
+				for (size_t j = 0; j < columns; ++j) {
+					right[i] = right[i] != (reference[i][j] && column[j]);
+					left[j] = left[j] != (row[i] && reference[i][j]);
+				}
+			CHECK_EQUAL(matrix * bitset_t(column), bitset_t(right));
+			CHECK_EQUAL(bitset_t(row) * matrix, bitset_t(left));
+			CHECK_THROWS(matrix * bitset_t(std::vector<bool>(columns + 1)), std::invalid_argument);
+			CHECK_THROWS(bitset_t(std::vector<bool>(rows + 1)) * matrix, std::invalid_argument);
+		}
+}
+
+TEST_CASE(multipliesMatricesAsReference) {
+	std::mt19937_64 random(26);
+	for (const size_t rows : {1, 9, 64, 65})
+		for (const size_t inner : dimensions)
+			for (const size_t columns : {1, 63, 129}) {
+				const reference_t left = randomReference(random, rows, inner), right = randomReference(random, inner, columns);
+				const bitmatrix_t product = matrixOf(left, inner) * matrixOf(right, columns);
+				CHECK_EQUAL(product, matrixOf(naiveProduct(left, right, inner, columns), columns));
+			}
+	const bitmatrix_t matrix = matrixOf(randomReference(random, 65, 65), 65);
+	CHECK_EQUAL(matrix * bitmatrix_t::identity(65), matrix);
+	CHECK_EQUAL(bitmatrix_t::identity(65) * matrix, matrix);
+	CHECK_THROWS(matrix * bitmatrix_t(64, 65), std::invalid_argument);
+}
+
+TEST_CASE(ranksAsReference) {
+	std::mt19937_64 random(27);
+	for (const size_t rows : dimensions)
+		for (const size_t columns : dimensions) {
+			for (const reference_t& reference : {randomReference(random, rows, columns), randomReference(random, rows, columns, 0.05), deficientReference(random, rows, columns, 3)})
+				CHECK_EQUAL(matrixOf(reference, columns).rank(), naiveRank(reference, columns));
+		}
+	CHECK_EQUAL(bitmatrix_t(129, 65).rank(), (size_t)0);
+	CHECK_EQUAL(bitmatrix_t::identity(129).rank(), (size_t)129);
+}
+
+TEST_CASE(echelonizesAsReference) {
+	std::mt19937_64 random(28);
+	for (const size_t rows : dimensions)
+		for (const size_t columns : dimensions)
+			for (const bool reduced : {false, true}) {
+				const reference_t reference = deficientReference(random, rows, columns, std::min(rows, columns) / 2 + 1);
+				const size_t rank = naiveRank(reference, columns);
+				bitmatrix_t matrix = matrixOf(reference, columns);
+				CHECK_EQUAL(matrix.echelonize(reduced), rank);
+				// Pivots move right row by row, and the rows below the rank are zero
+				size_t lastPivot = 0, misplaced = 0;
+				for (size_t row = 0; row < rows; ++row) {
+					const size_t pivot = matrix.row(row).findFirst();
+					if (row >= rank) {
+						misplaced += pivot != bitset_t::npos;
+						continue;
+					}
+					misplaced += pivot == bitset_t::npos || (row > 0 && pivot <= lastPivot);
+					if (reduced && pivot != bitset_t::npos)
+						for (size_t other = 0; other < rows; ++other)
+							misplaced += other != row && matrix.at(other, pivot);
+					lastPivot = pivot;
+				}
+				CHECK_EQUAL(misplaced, (size_t)0);
+				// The rows span the same space: stacked with the original rows, the rank does not grow
+				reference_t stacked = reference;
+				for (size_t row = 0; row < rows; ++row)
+					stacked.push_back(bitsOf(bitset_t(matrix.row(row))));
+				CHECK_EQUAL(naiveRank(stacked, columns), rank);
+			}
+}
+
+TEST_CASE(solvesAsReference) {
+	std::mt19937_64 random(29);
+	for (const size_t rows : dimensions)
+		for (const size_t columns : dimensions) {
+			const reference_t reference = deficientReference(random, rows, columns, std::min(rows, columns) / 2 + 1);
+			const bitmatrix_t matrix = matrixOf(reference, columns);
+			// A right-hand side in the column space has a solution
+			const bitset_t rhs = matrix * bitset_t(randomBits(random, columns));
+			bitset_t solution;
+			CHECK(matrix.solve(rhs, solution));
+			CHECK_EQUAL(solution.length(), columns);
+			CHECK_EQUAL(matrix * solution, rhs);
+			// Any other one has a solution exactly when it does not raise the rank of the augmented matrix
+			const std::vector<bool> other = randomBits(random, rows);
+			reference_t augmented = reference;
+			for (size_t row = 0; row < rows; ++row)
+				augmented[row].push_back(other[row]);
+			const bool consistent = naiveRank(augmented, columns + 1) == naiveRank(reference, columns);
+			CHECK_EQUAL(matrix.solve(bitset_t(other), solution), consistent);
+			if (consistent) CHECK_EQUAL(matrix * solution, bitset_t(other));
+			CHECK_THROWS(matrix.solve(bitset_t(std::vector<bool>(rows + 1)), solution), std::invalid_argument);
+		}
+	// Square systems of full rank have the one solution
+	for (const size_t size : dimensions) {
+		const bitset_t expected(randomBits(random, size));
+		bitset_t solution;
+		CHECK(bitmatrix_t::identity(size).solve(expected, solution));
+		CHECK_EQUAL(solution, expected);
+	}
+}
+
+TEST_CASE(rejectsInconsistentSystems) {
+	// Two equal rows with different right-hand sides
+	for (const size_t columns : dimensions) {
+		std::mt19937_64 random(30 + columns);
+		bitset_t row(randomBits(random, columns));
+		row[columns - 1].set();
+		const bitmatrix_t matrix(std::vector<bitset_t>{row, row});
+		bitset_t rhs(std::vector<bool>{true, false}), solution;
+		CHECK(!matrix.solve(rhs, solution));
+		rhs[1].set();
+		CHECK(matrix.solve(rhs, solution));
+		CHECK_EQUAL(matrix * solution, rhs);
+	}
+	// A zero row with a set right-hand side
+	bitset_t rhs(std::vector<bool>(65)), solution;
+	rhs[64].set();
+	CHECK(!bitmatrix_t(65, 129).solve(rhs, solution));
+}
+
+int main() {
+	return runTests();
+}
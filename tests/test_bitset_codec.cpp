@@ -0,0 +1,122 @@
+/**
+ * @file test_bitset_codec.cpp
+ * @date October 16, 2026
+ * @brief Contains the round-trip tests of the text and raw byte encoders and decoders of bitsets
+ */
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_codec.h"
+
+static const bitset_format_t formats[] = {bitset_format_t::binary, bitset_format_t::hex, bitset_format_t::base64};
+
+static std::vector<uint8_t> referenceBytes(const std::vector<bool>& bits) {
+	std::vector<uint8_t> bytes((bits.size() + 7) / 8, 0);
+	for (size_t index = 0; index < bits.size(); ++index)
+		if (bits[index]) bytes[index / 8] |= (uint8_t)(1u << (index % 8));
+	return bytes;
+}
+
+static std::string referenceHex(const std::vector<bool>& bits) {
+	std::string text((bits.size() + 3) / 4, '0');
+	for (size_t digit = 0; digit < text.size(); ++digit) {
+		unsigned value = 0;
+		for (size_t bit = 0; bit < 4 && 4 * digit + bit < bits.size(); ++bit)
+			value |= (unsigned)bits[4 * digit + bit] << bit;
+		text[digit] = "0123456789abcdef"[value];
+	}
+	return text;
+}
+
+static std::string referenceBase64(const std::vector<uint8_t>& bytes) {
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::string text;
+	for (size_t index = 0; index < bytes.size(); index += 3) {
+		const size_t available = std::min<size_t>(bytes.size() - index, 3);
+		uint32_t group = (uint32_t)bytes[index] << 16;
+		if (available > 1) group |= (uint32_t)bytes[index + 1] << 8;
+		if (available > 2) group |= bytes[index + 2];
+		for (size_t symbol = 0; symbol < 4; ++symbol)
+			text.push_back((symbol <= available) ? alphabet[(group >> (18 - 6 * symbol)) & 63] : '=');
+	}
+	return text;
+}
+
+TEST_CASE(encodesAsReference) {
+	std::mt19937_64 random(17);
+	for (const size_t length : boundaryLengths()) {
+		const std::vector<bool> bits = randomBits(random, length);
+		const bitset_t bitset(bits);
+		CHECK_EQUAL(encodeBitset(bitset, bitset_format_t::binary), bitset.toBinaryString());
+		CHECK_EQUAL(encodeBitset(bitset, bitset_format_t::hex), referenceHex(bits));
+		CHECK_EQUAL(encodeBitset(bitset, bitset_format_t::base64), referenceBase64(referenceBytes(bits)));
+		CHECK(encodeBytes(bitset) == referenceBytes(bits));
+		for (const bitset_format_t format : formats)
+			CHECK_EQUAL(encodeBitset(bitset, format).size(), encodedLength(length, format));
+	}
+}
+
+TEST_CASE(roundTripsEveryFormat) {
+	std::mt19937_64 random(18);
+	for (const size_t length : boundaryLengths()) {
+		const bitset_t bits(randomBits(random, length));
+		for (const bitset_format_t format : formats)
+			CHECK_EQUAL(decodeBitset(encodeBitset(bits, format), format, length), bits);
+		const std::vector<uint8_t> bytes = encodeBytes(bits);
+		CHECK_EQUAL(decodeBytes(bytes.data(), length), bits);
+	}
+}
+
+TEST_CASE(roundTripsUnalignedViews) {
+	std::mt19937_64 random(19);
+	const bitset_t bits(randomBits(random, 1000));
+	for (const size_t offset : {1, 7, 63, 64, 65}) {
+		const bitset_view_t view(bits, offset, 1000 - offset - 3);
+		const bitset_t expected(view);
+		for (const bitset_format_t format : formats) {
+			CHECK_EQUAL(encodeBitset(view, format), encodeBitset(expected, format));
+			CHECK_EQUAL(decodeBitset(encodeBitset(view, format), format, view.length()), expected);
+		}
+		CHECK(encodeBytes(view) == encodeBytes(expected));
+	}
+}
+
+TEST_CASE(writesSameAsEncodes) {
+	std::mt19937_64 random(20);
+	std::vector<size_t> lengths = boundaryLengths();
+	lengths.push_back(100003);
+	for (const size_t length : lengths) {
+		const bitset_t bits(randomBits(random, length));
+		for (const bitset_format_t format : formats) {
+			std::ostringstream os;
+			writeBitset(os, bits, format);
+			CHECK_EQUAL(os.str(), encodeBitset(bits, format));
+		}
+	}
+}
+
+TEST_CASE(decodesWholeDigitsByDefault) {
+	CHECK_EQUAL(decodeBitset("1f", bitset_format_t::hex), bitset_t({1, 0, 0, 0, 1, 1, 1, 1}));
+	CHECK_EQUAL(decodeBitset("1F", bitset_format_t::hex, 5), bitset_t({1, 0, 0, 0, 1}));
+	CHECK_EQUAL(decodeBitset("AQ", bitset_format_t::base64).length(), (size_t)8);
+	CHECK_EQUAL(decodeBitset("AQ==", bitset_format_t::base64), bitset_t({1, 0, 0, 0, 0, 0, 0, 0}));
+	CHECK_EQUAL(decodeBitset("", bitset_format_t::binary).length(), (size_t)0);
+}
+
+TEST_CASE(rejectsInvalidText) {
+	CHECK_THROWS(decodeBitset("0102", bitset_format_t::binary), std::invalid_argument);
+	CHECK_THROWS(decodeBitset("1g", bitset_format_t::hex), std::invalid_argument);
+	CHECK_THROWS(decodeBitset("A*==", bitset_format_t::base64), std::invalid_argument);
+	CHECK_THROWS(decodeBitset("1f", bitset_format_t::hex, 9), std::invalid_argument);
+	CHECK_THROWS(decodeBitset("101", bitset_format_t::binary, 4), std::invalid_argument);
+}
+
+int main() {
+	return runTests();
+}
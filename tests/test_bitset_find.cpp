@@ -0,0 +1,70 @@
+/**
+ * @file test_bitset_find.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the set-bit search and the set-bit position iterator of `bitset_t`
+ */
+
+#include <random>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_type.h"
+
+static std::vector<size_t> setPositions(const std::vector<bool>& bits) {
+	std::vector<size_t> positions;
+	for (size_t index = 0; index < bits.size(); ++index)
+		if (bits[index]) positions.push_back(index);
+	return positions;
+}
+
+TEST_CASE(findsMatchReference) {
+	std::mt19937_64 random(9);
+	for (const size_t length : boundaryLengths()) {
+		for (const double density : {0.0, 0.01, 0.5, 1.0}) {
+			const std::vector<bool> reference = randomBits(random, length, density);
+			const std::vector<size_t> expected = setPositions(reference);
+			const bitset_t bits(reference);
+			std::vector<size_t> forward, backward;
+			for (size_t index = bits.findFirst(); index != bitset_t::npos; index = bits.findNext(index))
+				forward.push_back(index);
+			for (size_t index = bits.findLast(); index != bitset_t::npos; index = bits.findPrev(index))
+				backward.insert(backward.begin(), index);
+			CHECK(forward == expected);
+			CHECK(backward == expected);
+			CHECK(std::vector<size_t>(bits.positions().begin(), bits.positions().end()) == expected);
+		}
+	}
+}
+
+TEST_CASE(findsAroundWordBoundaries) {
+	bitset_t bits(std::vector<bool>(200, false));
+	for (const size_t index : {0, 63, 64, 127, 199})
+		bits[index] = bit_t(true);
+	CHECK_EQUAL(bits.findFirst(), (size_t)0);
+	CHECK_EQUAL(bits.findNext(0), (size_t)63);
+	CHECK_EQUAL(bits.findNext(63), (size_t)64);
+	CHECK_EQUAL(bits.findNext(64), (size_t)127);
+	CHECK_EQUAL(bits.findNext(127), (size_t)199);
+	CHECK_EQUAL(bits.findNext(199), bitset_t::npos);
+	CHECK_EQUAL(bits.findNext(1000), bitset_t::npos);
+	CHECK_EQUAL(bits.findLast(), (size_t)199);
+	CHECK_EQUAL(bits.findPrev(199), (size_t)127);
+	CHECK_EQUAL(bits.findPrev(64), (size_t)63);
+	CHECK_EQUAL(bits.findPrev(0), bitset_t::npos);
+	CHECK_EQUAL(bits.findPrev(1000), (size_t)199);
+}
+
+TEST_CASE(findsNothingInEmptyBitsets) {
+	const bitset_t empty, reset(std::vector<bool>(130, false));
+	for (const bitset_t* bits : {&empty, &reset}) {
+		CHECK_EQUAL(bits->findFirst(), bitset_t::npos);
+		CHECK_EQUAL(bits->findLast(), bitset_t::npos);
+		CHECK_EQUAL(bits->findNext(0), bitset_t::npos);
+		CHECK_EQUAL(bits->findPrev(bitset_t::npos), bitset_t::npos);
+		CHECK(bits->positions().begin() == bits->positions().end());
+	}
+}
+
+int main() {
+	return runTests();
+}
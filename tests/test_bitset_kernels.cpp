@@ -0,0 +1,193 @@
+/**
+ * @file test_bitset_kernels.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the kernels of every instruction set level against a word-by-word reference
+ */
+
+#include <random>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_kernels.h"
+#include "bitset_type.h"
+
+// Word counts around the vector widths, and starting offsets which misalign the vectors
+static const size_t counts[] = {0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 100};
+static const size_t offsets[] = {0, 1, 3};
+
+static std::vector<uint64_t> randomWords(std::mt19937_64& random, const size_t count) {
+	std::vector<uint64_t> words(count);
+	for (uint64_t& word : words)
+		word = random();
+	return words;
+}
+
+static size_t referencePopcount(uint64_t word) {
+	size_t count = 0;
+	for (; word != 0; word &= word - 1)
+		++count;
+	return count;
+}
+
+// Runs check once with the kernels of every level the host supports
+template <class Check>
+static void forEachIsa(const Check& check) {
+	for (const isa_t isa : {isa_t::scalar, isa_t::sse2, isa_t::avx2, isa_t::avx512}) {
+		if (!forceIsa(isa)) continue;
+		check(isa);
+	}
+	forceIsa(detectIsa());
+}
+
+TEST_CASE(selectsSupportedLevels) {
+	std::cout << "host level: " << isaName(detectIsa()) << std::endl;
+	CHECK(forceIsa(isa_t::scalar));
+	CHECK(activeIsa() == isa_t::scalar);
+	CHECK(bitsetKernels().isa == isa_t::scalar);
+	CHECK(forceIsa(detectIsa()));
+	CHECK(activeIsa() == detectIsa());
+}
+
+TEST_CASE(binaryKernelsMatchReference) {
+	std::mt19937_64 random(3);
+	forEachIsa([&](const isa_t isa) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		for (const size_t offset : offsets) {
+			for (const size_t count : counts) {
+				const std::vector<uint64_t> left = randomWords(random, offset + count), right = randomWords(random, offset + count);
+				std::vector<uint64_t> xors = left, ands = left, ors = left, nands = left, nors = left, inverted = left, filled = left;
+				kernels.xorWords(xors.data() + offset, right.data() + offset, count);
+				kernels.andWords(ands.data() + offset, right.data() + offset, count);
+				kernels.orWords(ors.data() + offset, right.data() + offset, count);
+				kernels.nandWords(nands.data() + offset, right.data() + offset, count);
+				kernels.norWords(nors.data() + offset, right.data() + offset, count);
+				kernels.invertWords(inverted.data() + offset, count);
+				kernels.fillWords(filled.data() + offset, count, 0x5A5A5A5A5A5A5A5AULL);
+				size_t mismatches = 0;
+				for (size_t index = 0; index < offset + count; ++index) {
+					const bool inside = index >= offset;
+					mismatches += xors[index] != (inside ? left[index] ^ right[index] : left[index]);
+					mismatches += ands[index] != (inside ? left[index] & right[index] : left[index]);
+					mismatches += ors[index] != (inside ? left[index] | right[index] : left[index]);
+					mismatches += nands[index] != (inside ? ~(left[index] & right[index]) : left[index]);
+					mismatches += nors[index] != (inside ? ~(left[index] | right[index]) : left[index]);
+					mismatches += inverted[index] != (inside ? ~left[index] : left[index]);
+					mismatches += filled[index] != (inside ? 0x5A5A5A5A5A5A5A5AULL : left[index]);
+				}
+				if (mismatches != 0) std::cerr << isaName(isa) << ": " << count << " words at offset " << offset << std::endl;
+				CHECK_EQUAL(mismatches, (size_t)0);
+				CHECK(kernels.equalWords(left.data() + offset, left.data() + offset, count));
+				if (count != 0) {
+					std::vector<uint64_t> changed = left;
+					changed[offset + count - 1] ^= 1ULL << 63;
+					CHECK(!kernels.equalWords(left.data() + offset, changed.data() + offset, count));
+				}
+			}
+		}
+	});
+}
+
+TEST_CASE(countingKernelsMatchReference) {
+	std::mt19937_64 random(4);
+	forEachIsa([&](const isa_t isa) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		for (const size_t offset : offsets) {
+			for (const size_t count : counts) {
+				const std::vector<uint64_t> left = randomWords(random, offset + count), right = randomWords(random, offset + count);
+				size_t population = 0, distance = 0, common = 0;
+				for (size_t index = offset; index < offset + count; ++index) {
+					population += referencePopcount(left[index]);
+					distance += referencePopcount(left[index] ^ right[index]);
+					common += referencePopcount(left[index] & right[index]);
+				}
+				const size_t failures = testFailures();
+				CHECK_EQUAL(kernels.popcountWords(left.data() + offset, count), population);
+				CHECK_EQUAL(kernels.xorPopcountWords(left.data() + offset, right.data() + offset, count), distance);
+				CHECK_EQUAL(kernels.andParityWords(left.data() + offset, right.data() + offset, count), common % 2 == 1);
+				if (testFailures() != failures) std::cerr << isaName(isa) << ": " << count << " words at offset " << offset << std::endl;
+			}
+		}
+	});
+}
+
+TEST_CASE(funnelKernelsMatchReference) {
+	std::mt19937_64 random(5);
+	forEachIsa([&](const isa_t isa) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		for (const size_t count : counts) {
+			for (const unsigned shift : {1u, 7u, 32u, 63u}) {
+				const std::vector<uint64_t> source = randomWords(random, count + 1);
+				std::vector<uint64_t> down(count), up(count);
+				kernels.funnelDownWords(down.data(), source.data(), count, shift);
+				kernels.funnelUpWords(up.data(), source.data() + 1, count, shift);
+				size_t mismatches = 0;
+				for (size_t index = 0; index < count; ++index) {
+					mismatches += down[index] != ((source[index] >> shift) | (source[index + 1] << (64 - shift)));
+					mismatches += up[index] != ((source[index + 1] << shift) | (source[index] >> (64 - shift)));
+				}
+				if (mismatches != 0) std::cerr << isaName(isa) << ": funnel shift of " << count << " words by " << shift << std::endl;
+				CHECK_EQUAL(mismatches, (size_t)0);
+			}
+		}
+	});
+}
+
+TEST_CASE(funnelKernelsShiftInPlace) {
+	std::mt19937_64 random(6);
+	forEachIsa([&](const isa_t) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		const std::vector<uint64_t> source = randomWords(random, 41);
+		std::vector<uint64_t> down = source, up = source;
+		kernels.funnelDownWords(down.data(), down.data(), 40, 5);
+		kernels.funnelUpWords(up.data() + 1, up.data() + 1, 40, 5);
+		for (size_t index = 0; index < 40; ++index) {
+			CHECK_EQUAL(down[index], (source[index] >> 5) | (source[index + 1] << 59));
+			CHECK_EQUAL(up[index + 1], (source[index + 1] << 5) | (source[index] >> 59));
+		}
+	});
+}
+
+TEST_CASE(rowKernelsMatchReference) {
+	std::mt19937_64 random(7);
+	forEachIsa([&](const isa_t) {
+		const bitset_kernels_t& kernels = bitsetKernels();
+		for (const size_t words : {1, 2, 3, 8, 13, 32}) {
+			for (const size_t count : {1, 5, 63, 64, 65, 130}) {
+				const std::vector<uint64_t> query = randomWords(random, words), packed = randomWords(random, count * words);
+				std::vector<const uint64_t*> rows(count);
+				for (size_t row = 0; row < count; ++row)
+					rows[row] = packed.data() + row * words;
+				std::vector<size_t> distances(count);
+				std::vector<uint64_t> parities((count + 63) / 64, ~0ULL);
+				kernels.xorPopcountRows(query.data(), rows.data(), count, words, distances.data());
+				kernels.andParityRows(query.data(), rows.data(), count, words, parities.data());
+				for (size_t row = 0; row < count; ++row) {
+					size_t distance = 0, common = 0;
+					for (size_t index = 0; index < words; ++index) {
+						distance += referencePopcount(query[index] ^ rows[row][index]);
+						common += referencePopcount(query[index] & rows[row][index]);
+					}
+					CHECK_EQUAL(distances[row], distance);
+					CHECK_EQUAL((parities[row / 64] >> (row % 64)) & 1, (uint64_t)(common % 2));
+				}
+				if (count % 64 != 0) CHECK_EQUAL(parities.back() >> (count % 64), (uint64_t)0);
+			}
+		}
+	});
+}
+
+TEST_CASE(bitsetOperationsAgreeAcrossLevels) {
+	std::mt19937_64 random(8);
+	const bitset_t left(randomBits(random, 1000)), right(randomBits(random, 1000));
+	forceIsa(isa_t::scalar);
+	const bitset_t expected = (left ^ right) & ~left;
+	const size_t distance = hammingDistance(left, right);
+	forEachIsa([&](const isa_t) {
+		CHECK_EQUAL(bitset_t((left ^ right) & ~left), expected);
+		CHECK_EQUAL(hammingDistance(left, right), distance);
+	});
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_bitset_memory.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the `bitset_arena_t` and `bitset_pool_t` memory resources of `bitset_t`
+ */
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_allocator.h"
+
+static bool aligned(const void* pointer) {
+	return (uintptr_t)pointer % bitset_memory_t::alignment == 0;
+}
+
+TEST_CASE(arenaBumpsAndReleases) {
+	bitset_arena_t arena(4096);
+	std::vector<void*> blocks;
+	for (const size_t bytes : {1, 8, 64, 65, 1000, 5000, 24}) {
+		blocks.push_back(arena.allocate(bytes));
+		CHECK(aligned(blocks.back()));
+	}
+	CHECK(arena.used() >= 1 + 8 + 64 + 65 + 1000 + 5000 + 24);
+	const size_t reserved = arena.reserved();
+	arena.release();
+	CHECK_EQUAL(arena.used(), (size_t)0);
+	CHECK(arena.reserved() <= reserved);
+	// The block kept by release() serves the next allocations
+	const size_t kept = arena.reserved();
+	arena.allocate(64);
+	CHECK_EQUAL(arena.reserved(), kept);
+}
+
+TEST_CASE(arenaExtendsMostRecentBlockInPlace) {
+	bitset_arena_t arena(1 << 16);
+	void* first = arena.allocate(128);
+	arena.deallocate(first, 128);
+	CHECK(arena.allocate(256) == first);
+}
+
+TEST_CASE(poolReusesBlocksOfEachClass) {
+	bitset_pool_t pool(1 << 16);
+	for (const size_t bytes : {(size_t)1, (size_t)64, (size_t)65, (size_t)1000, (size_t)4096, bitset_pool_t::largestClass, bitset_pool_t::largestClass + 1}) {
+		void* block = pool.allocate(bytes);
+		CHECK(aligned(block));
+		pool.deallocate(block, bytes);
+		if (bytes <= bitset_pool_t::largestClass) CHECK(pool.allocate(bytes) == block);
+	}
+	pool.release();
+	CHECK(aligned(pool.allocate(100)));
+}
+
+TEST_CASE(bitsetsAllocateFromTheirResource) {
+	std::mt19937_64 random(23);
+	for (const bool usePool : {false, true}) {
+		bitset_arena_t arena;
+		bitset_pool_t pool;
+		bitset_memory_t& memory = usePool ? static_cast<bitset_memory_t&>(pool) : static_cast<bitset_memory_t&>(arena);
+		const bitset_t source(randomBits(random, 4099));
+		{
+			bitset_t bits(source, memory);
+			CHECK_EQUAL(bits, source);
+			CHECK(bits.allocator().resource() == &memory);
+			CHECK(aligned(bits.data()));
+			// Results of expressions and resizing stay in the resource
+			bits = source ^ bits;
+			CHECK_EQUAL(bits.count(), (size_t)0);
+			bits.resize(10000, bit_t(true));
+			CHECK(bits.allocator().resource() == &memory);
+			// Moves keep the allocator, copies start again on the global heap
+			bitset_t moved(std::move(bits));
+			CHECK(moved.allocator().resource() == &memory);
+			const bitset_t copy = moved;
+			CHECK(copy.allocator().resource() == nullptr);
+			CHECK_EQUAL(copy, moved);
+			bitset_t other(source);
+			other.swap(moved);
+			CHECK(other.allocator().resource() == &memory);
+			CHECK(moved.allocator().resource() == nullptr);
+			CHECK_EQUAL(moved, source);
+		}
+		if (!usePool) CHECK_EQUAL(arena.used(), (size_t)0);
+		usePool ? pool.release() : arena.release();
+		bitset_t reused(source, memory);
+		CHECK_EQUAL(reused, source);
+	}
+}
+
+TEST_CASE(shortBitsetsDoNotAllocate) {
+	bitset_arena_t arena;
+	{
+		bitset_t bits(arena);
+		bits.resize(BITLIB_INLINE_BITS, bit_t(true));
+		CHECK_EQUAL(bits.count(), (size_t)BITLIB_INLINE_BITS);
+		CHECK_EQUAL(arena.used(), (size_t)0);
+		bits.resize(BITLIB_INLINE_BITS + 1, bit_t(true));
+		CHECK(arena.used() != 0);
+	}
+}
+
+TEST_CASE(allocatesStandardContainers) {
+	bitset_pool_t pool;
+	std::vector<size_t, bitset_allocator_t<size_t>> positions(pool);
+	for (size_t index = 0; index < 10000; ++index)
+		positions.push_back(index);
+	CHECK_EQUAL(positions[9999], (size_t)9999);
+	CHECK(positions.get_allocator().resource() == &pool);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,84 @@
+/**
+ * @file test_bitset_move.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the move, swap and copy assignment of `bitset_t`
+ */
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_type.h"
+
+// Long enough to be stored on the heap, so that moves take the storage over
+static const size_t heapLength = 4099;
+
+TEST_CASE(moveTakesStorageOver) {
+	std::mt19937_64 random(14);
+	const bitset_t original(randomBits(random, heapLength));
+	bitset_t source = original;
+	const bitset_t::word_t* storage = source.data();
+	bitset_t target(std::move(source));
+	CHECK_EQUAL(target, original);
+	CHECK(target.data() == storage);
+	CHECK_EQUAL(source.length(), (size_t)0);
+	bitset_t assigned({1, 0, 1});
+	assigned = std::move(target);
+	CHECK_EQUAL(assigned, original);
+	CHECK(assigned.data() == storage);
+	CHECK_EQUAL(target.length(), (size_t)0);
+}
+
+TEST_CASE(movedFromBitsetIsReusable) {
+	bitset_t source(std::vector<bool>(heapLength, true));
+	bitset_t target(std::move(source));
+	source.resize(70, bit_t(true));
+	CHECK_EQUAL(source.count(), (size_t)70);
+	source = target;
+	CHECK_EQUAL(source, target);
+}
+
+TEST_CASE(swapExchangesContents) {
+	std::mt19937_64 random(15);
+	for (const size_t leftLength : boundaryLengths()) {
+		const bitset_t left(randomBits(random, leftLength)), right(randomBits(random, heapLength - leftLength));
+		bitset_t x = left, y = right;
+		x.swap(y);
+		CHECK_EQUAL(x, right);
+		CHECK_EQUAL(y, left);
+		swap(x, y);
+		CHECK_EQUAL(x, left);
+		CHECK_EQUAL(y, right);
+	}
+}
+
+TEST_CASE(copyAssignmentReusesCapacity) {
+	std::mt19937_64 random(16);
+	bitset_t target(randomBits(random, heapLength));
+	const bitset_t::word_t* storage = target.data();
+	for (const size_t length : {1000, 2049, 4099, 3000}) {
+		const bitset_t source(randomBits(random, length));
+		target = source;
+		CHECK_EQUAL(target, source);
+		CHECK(target.data() == storage);
+	}
+	const bitset_t longer(randomBits(random, 2 * heapLength));
+	target = longer;
+	CHECK_EQUAL(target, longer);
+}
+
+TEST_CASE(selfAssignmentKeepsBits) {
+	std::mt19937_64 random(17);
+	const bitset_t original(randomBits(random, 1000));
+	bitset_t bits = original;
+	const bitset_t& alias = bits;
+	bits = alias;
+	CHECK_EQUAL(bits, original);
+	bits.swap(bits);
+	CHECK_EQUAL(bits, original);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,169 @@
+/**
+ * @file test_bitset_parallel.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `work_pool_t` and of the split of bulk bitset operations across its threads
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_parallel.h"
+
+TEST_CASE(poolRunsEveryGrainOnce) {
+	work_pool_t pool(4);
+	CHECK_EQUAL(pool.threads(), (size_t)4);
+	const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	CHECK_EQUAL(work_pool_t(0).threads(), hardware);
+	for (const size_t grains : {0, 1, 2, 3, 4, 5, 100, 1000}) {
+		std::vector<std::atomic<size_t>> runs(grains);
+		for (std::atomic<size_t>& count : runs)
+			count.store(0);
+		pool.run(grains, [&](const size_t grain) { runs[grain].fetch_add(1); });
+		size_t wrong = 0;
+		for (const std::atomic<size_t>& count : runs)
+			wrong += count.load() != 1;
+		CHECK_EQUAL(wrong, (size_t)0);
+	}
+}
+
+TEST_CASE(poolRethrowsAfterOtherGrains) {
+	work_pool_t pool(4);
+	std::atomic<size_t> completed(0);
+	CHECK_THROWS(pool.run(100, [&](const size_t grain) {
+		if (grain == 5) throw std::runtime_error("grain 5");
+		completed.fetch_add(1);
+	}), std::runtime_error);
+	CHECK_EQUAL(completed.load(), (size_t)99);
+	// The pool runs further jobs after a failure
+	completed.store(0);
+	pool.run(100, [&](const size_t) { completed.fetch_add(1); });
+	CHECK_EQUAL(completed.load(), (size_t)100);
+}
+
+TEST_CASE(poolRunsNestedJobsInline) {
+	work_pool_t pool(4);
+	std::atomic<size_t> inner(0), foreign(0);
+	pool.run(16, [&](const size_t) {
+		const std::thread::id self = std::this_thread::get_id();
+		pool.run(8, [&](const size_t) {
+			inner.fetch_add(1);
+			foreign += std::this_thread::get_id() != self;
+		});
+	});
+	CHECK_EQUAL(inner.load(), (size_t)128);
+	CHECK_EQUAL(foreign.load(), (size_t)0);
+}
+
+TEST_CASE(poolSerializesJobsOfSeveralThreads) {
+	work_pool_t pool(3);
+	std::vector<std::atomic<size_t>> sums(4);
+	for (std::atomic<size_t>& sum : sums)
+		sum.store(0);
+	std::vector<std::thread> submitters;
+	for (size_t submitter = 0; submitter < sums.size(); ++submitter)
+		submitters.emplace_back([&, submitter]() {
+			for (size_t job = 0; job < 50; ++job)
+				pool.run(64, [&](const size_t grain) { sums[submitter].fetch_add(grain); });
+		});
+	for (std::thread& submitter : submitters)
+		submitter.join();
+	for (const std::atomic<size_t>& sum : sums)
+		CHECK_EQUAL(sum.load(), (size_t)50 * 64 * 63 / 2);
+}
+
+TEST_CASE(splitsOnlyLargeOperations) {
+	const parallel_scope_t parallel(4, 100000);
+	CHECK(!splitsAcrossThreads(99999));
+	CHECK(splitsAcrossThreads(100000));
+	setBitsetParallelThreshold(1);
+	// Never below two of the smallest ranges
+	CHECK(!splitsAcrossThreads(4095));
+	CHECK(splitsAcrossThreads(4096));
+	setBitsetThreads(1);
+	CHECK(!splitsAcrossThreads(1 << 20));
+	setBitsetThreads(0);
+	const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	CHECK_EQUAL(bitsetThreads(), hardware);
+	// Below the threshold the task runs once, over every word
+	setBitsetThreads(4);
+	setBitsetParallelThreshold(1 << 20);
+	size_t calls = 0;
+	CHECK_EQUAL(parallelForWords(nullptr, 5000, [&](const size_t first, const size_t last) { ++calls; return last - first + first * 1000; }), (size_t)5000);
+	CHECK_EQUAL(calls, (size_t)1);
+}
+
+TEST_CASE(splitRangesCoverWordsAtLineBoundaries) {
+	const parallel_scope_t parallel;
+	std::vector<uint64_t> words(100003 + 8);
+	for (size_t offset = 0; offset < 8; ++offset)
+		for (const size_t count : {1, 7, 8, 9, 2048, 4096, 10000, 100003})
+			for (const size_t weight : {1, 64}) {
+				const uint64_t* base = words.data() + offset;
+				std::mutex lock;
+				std::vector<std::pair<size_t, size_t>> ranges;
+				const size_t total = splitWords(base, count, [&](const size_t first, const size_t last) {
+					std::lock_guard<std::mutex> guard(lock);
+					ranges.emplace_back(first, last);
+					return last - first;
+				}, weight);
+				CHECK_EQUAL(total, count);
+				std::sort(ranges.begin(), ranges.end());
+				size_t next = 0, wrong = 0;
+				for (const std::pair<size_t, size_t>& range : ranges) {
+					wrong += range.first != next || range.second <= range.first;
+					// Ranges after the first start at a cache line of base
+					wrong += range.first != 0 && (uintptr_t)(base + range.first) % 64 != 0;
+					next = range.second;
+				}
+				CHECK_EQUAL(wrong, (size_t)0);
+				CHECK_EQUAL(next, count);
+				if (count >= 10000) CHECK(ranges.size() > 1);
+			}
+	CHECK_EQUAL(splitWords(nullptr, 100003, [](const size_t first, const size_t last) { return last - first; }), (size_t)100003);
+}
+
+TEST_CASE(operationsKeepResultsWhileThreadsChange) {
+	// Two threads XOR bitsets of 4M bits while a third changes the number of threads they split across
+	const parallel_scope_t parallel(4, (size_t)1 << 16);
+	std::mt19937_64 random(19);
+	const std::vector<bool> leftBits = randomBits(random, (size_t)1 << 22), rightBits = randomBits(random, (size_t)1 << 22);
+	std::vector<bool> exclusive(leftBits.size());
+	for (size_t index = 0; index < exclusive.size(); ++index)
+		exclusive[index] = leftBits[index] != rightBits[index];
+	const bitset_t left(leftBits), right(rightBits), expected(exclusive);
+	const size_t expectedCount = expected.count();
+	std::atomic<bool> running(true);
+	std::atomic<size_t> wrong(0);
+	std::thread cycler([&]() {
+		const size_t counts[] = {1, 2, 3, 4, 8, 0};
+		for (size_t step = 0; running.load(); ++step) {
+			setBitsetThreads(counts[step % 6]);
+			std::this_thread::yield();
+		}
+	});
+	std::vector<std::thread> workers;
+	for (size_t worker = 0; worker < 2; ++worker)
+		workers.emplace_back([&]() {
+			for (size_t iteration = 0; iteration < 20; ++iteration) {
+				const bitset_t result = left ^ right;
+				wrong += result != expected;
+				wrong += result.count() != expectedCount;
+			}
+		});
+	for (std::thread& worker : workers)
+		worker.join();
+	running.store(false);
+	cycler.join();
+	CHECK_EQUAL(wrong.load(), (size_t)0);
+}
+
+int main() {
+	return runTests();
+}
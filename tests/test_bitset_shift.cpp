@@ -0,0 +1,94 @@
+/**
+ * @file test_bitset_shift.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the shifts and the rotations of `bitset_t` at word boundaries
+ */
+
+#include <random>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_type.h"
+
+// Shifts around every word boundary up to the length, and past the length
+static std::vector<size_t> shiftsFor(const size_t length) {
+	std::vector<size_t> shifts = {0, 1, 2, 31, 63, 64, 65, 127, 128, 129, 200};
+	for (const size_t offset : {1, 0})
+		if (length >= offset) shifts.push_back(length - offset);
+	shifts.push_back(length + 1);
+	shifts.push_back(2 * length + 3);
+	return shifts;
+}
+
+// Checks every shift and rotation of every length against a bit-by-bit reference
+static void checkAgainstReference(std::mt19937_64& random, const std::vector<size_t>& lengths, std::vector<size_t> (*shifts)(const size_t) = shiftsFor) {
+	for (const size_t length : lengths) {
+		const std::vector<bool> bits = randomBits(random, length);
+		for (const size_t shift : shifts(length)) {
+			std::vector<bool> left(length), right(length), rotatedLeft(length), rotatedRight(length);
+			for (size_t index = 0; index < length; ++index) {
+				left[index] = index + shift < length && bits[index + shift];
+				right[index] = index >= shift && bits[index - shift];
+				rotatedLeft[index] = bits[(index + shift % length) % length];
+				rotatedRight[index] = bits[(index + length - shift % length) % length];
+			}
+			bitset_t shifted(bits);
+			shifted.shiftLeft(shift);
+			CHECK_EQUAL(shifted, bitset_t(left));
+			shifted = bitset_t(bits);
+			shifted.shiftRight(shift);
+			CHECK_EQUAL(shifted, bitset_t(right));
+			if (length == 0) continue;
+			shifted = bitset_t(bits);
+			shifted.rotateLeft(shift);
+			CHECK_EQUAL(shifted, bitset_t(rotatedLeft));
+			shifted = bitset_t(bits);
+			shifted.rotateRight(shift);
+			CHECK_EQUAL(shifted, bitset_t(rotatedRight));
+		}
+	}
+}
+
+TEST_CASE(shiftsMatchReference) {
+	std::mt19937_64 random(11);
+	checkAgainstReference(random, boundaryLengths());
+}
+
+TEST_CASE(shiftsKeepBitsPastLengthReset) {
+	for (const size_t length : {65, 127, 129, 1000}) {
+		bitset_t bits(std::vector<bool>(length, true));
+		bits.shiftRight(3);
+		CHECK_EQUAL(bits.count(), length - 3);
+		bits.rotateLeft(5);
+		CHECK_EQUAL(bits.count(), length - 3);
+		CHECK_EQUAL(bits.data()[bits.wordCount() - 1] >> (length % 64), (bitset_t::word_t)0);
+	}
+}
+
+TEST_CASE(rotationsUndoEachOther) {
+	std::mt19937_64 random(12);
+	const bitset_t original(randomBits(random, 4099));
+	bitset_t bits = original;
+	for (const size_t shift : {1, 64, 2049, 2050, 4098}) {
+		bits.rotateLeft(shift);
+		bits.rotateRight(shift);
+		CHECK_EQUAL(bits, original);
+	}
+}
+
+// Shifts of a few words, and of more than half the length, which move words across the ranges of the threads
+static std::vector<size_t> splitShiftsFor(const size_t length) {
+	return {0, 1, 64, 3 * 64 + 5, length / 2 + 70, length - 3 * 64, length - 1};
+}
+
+TEST_CASE(shiftsSplitAcrossThreadsMatchReference) {
+	const parallel_scope_t parallel;
+	// Above twice the smallest range of a thread, i.e. 4096 words
+	CHECK(splitsAcrossThreads(5000));
+	std::mt19937_64 random(13);
+	checkAgainstReference(random, {64 * 4096, 64 * 5000 + 17, 64 * 9000 - 1}, splitShiftsFor);
+}
+
+int main() {
+	return runTests();
+}
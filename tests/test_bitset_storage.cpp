@@ -0,0 +1,92 @@
+/**
+ * @file test_bitset_storage.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the inline storage of short `bitset_t` values
+ */
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_type.h"
+
+static bool storedInline(const bitset_t& bits) {
+	const char* object = reinterpret_cast<const char*>(&bits);
+	const char* words = reinterpret_cast<const char*>(bits.data());
+	return words >= object && words < object + sizeof(bitset_t);
+}
+
+static const size_t inlineLengths[] = {1, 63, 64, 65, BITLIB_INLINE_BITS - 1, BITLIB_INLINE_BITS};
+static const size_t heapLengths[] = {BITLIB_INLINE_BITS + 1, BITLIB_INLINE_BITS + 64, 4099};
+
+TEST_CASE(storesShortBitsetsInline) {
+	std::mt19937_64 random(22);
+	for (const size_t length : inlineLengths) {
+		const bitset_t bits(randomBits(random, length));
+		CHECK(storedInline(bits));
+		const bitset_t copy = bits;
+		CHECK(storedInline(copy));
+		CHECK_EQUAL(copy, bits);
+	}
+	for (const size_t length : heapLengths)
+		CHECK(!storedInline(bitset_t(randomBits(random, length))));
+}
+
+TEST_CASE(resizesAcrossInlineLimit) {
+	std::mt19937_64 random(23);
+	for (const size_t length : inlineLengths) {
+		const std::vector<bool> reference = randomBits(random, length);
+		bitset_t bits(reference);
+		bits.resize(BITLIB_INLINE_BITS + 65, bit_t(true));
+		CHECK(!storedInline(bits));
+		CHECK_EQUAL(bits.count(), bitset_t(reference).count() + BITLIB_INLINE_BITS + 65 - length);
+		const bitset_t::word_t* storage = bits.data();
+		bits.resize(length);
+		CHECK_EQUAL(bits, bitset_t(reference));
+		// A bitset which shrinks back keeps its heap storage for growing again
+		bits.resize(BITLIB_INLINE_BITS + 65);
+		CHECK(bits.data() == storage);
+		bits.resize(length);
+		CHECK_EQUAL(bits, bitset_t(reference));
+	}
+}
+
+TEST_CASE(movesBetweenInlineAndHeap) {
+	std::mt19937_64 random(24);
+	for (const size_t shortLength : inlineLengths) {
+		for (const size_t longLength : heapLengths) {
+			const bitset_t shortBits(randomBits(random, shortLength)), longBits(randomBits(random, longLength));
+			bitset_t x = shortBits, y = longBits;
+			x.swap(y);
+			CHECK_EQUAL(x, longBits);
+			CHECK_EQUAL(y, shortBits);
+			CHECK(storedInline(y));
+			bitset_t moved(std::move(y));
+			CHECK_EQUAL(moved, shortBits);
+			CHECK(storedInline(moved));
+			CHECK_EQUAL(y.length(), (size_t)0);
+			moved = std::move(x);
+			CHECK_EQUAL(moved, longBits);
+			x = shortBits;
+			CHECK_EQUAL(x, shortBits);
+			moved = x;
+			CHECK_EQUAL(moved, shortBits);
+		}
+	}
+}
+
+TEST_CASE(evaluatesExpressionsIntoInlineStorage) {
+	std::mt19937_64 random(25);
+	const bitset_t left(randomBits(random, BITLIB_INLINE_BITS)), right(randomBits(random, BITLIB_INLINE_BITS));
+	bitset_t result = left;
+	result ^= right;
+	CHECK(storedInline(result));
+	CHECK_EQUAL(result, bitset_t(left ^ right));
+	result = result & left;
+	CHECK_EQUAL(result, bitset_t((left ^ right) & left));
+}
+
+int main() {
+	return runTests();
+}
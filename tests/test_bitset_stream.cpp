@@ -0,0 +1,174 @@
+/**
+ * @file test_bitset_stream.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the chunked operations of `bitset_stream_t` over in-memory, generated and file bitsets
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "test_support.h"
+#include "bitset_stream.h"
+#include "mapped_bitset.h"
+
+static const size_t lengths[] = {0, 1, 63, 64, 65, 200, 1000, 4099};
+
+// One word per chunk, chunks which do not divide the lengths, and a single chunk
+static const size_t chunkSizes[] = {1, 3, 7, 64};
+
+static std::string temporaryPath(const std::string& name) {
+	return "test_bitset_stream_" + std::to_string((long)::getpid()) + "_" + name + ".bits";
+}
+
+/**
+ * @brief Source of the words of a bitset with every bit past its length set, which the stream must ignore
+ */
+static generator_source_t dirtySource(const bitset_t& bits) {
+	return generator_source_t(bits.length(), [bits](uint64_t* words, const size_t first, const size_t count) {
+		for (size_t index = 0; index < count; ++index) {
+			const size_t word = first + index;
+			words[index] = bits.data()[word];
+			if (word + 1 == bits.wordCount() && bits.length() % 64 != 0) words[index] |= ~0ULL << (bits.length() % 64);
+		}
+	});
+}
+
+/**
+ * @brief Source which claims @ref claimed bits, but ends after the words of @ref available bits
+ */
+class short_source_t : public bitset_source_t {
+private:
+	size_t claimed;
+	size_t remaining;
+public:
+	short_source_t(const size_t claimed, const size_t available) : claimed(claimed), remaining((available + 63) / 64) {
+		return;
+	}
+
+	size_t length() const override {
+		return claimed;
+	}
+
+	size_t read(uint64_t* words, const size_t count) override {
+		const size_t taken = std::min(count, remaining);
+		for (size_t index = 0; index < taken; ++index)
+			words[index] = ~0ULL;
+		remaining -= taken;
+		return taken;
+	}
+};
+
+TEST_CASE(combinesAsBitsetOperators) {
+	std::mt19937_64 random(18);
+	for (const size_t chunkWords : chunkSizes) {
+		const bitset_stream_t stream(chunkWords);
+		for (const size_t length : lengths) {
+			const bitset_t left(randomBits(random, length)), right(randomBits(random, length));
+			const std::vector<std::pair<bitset_stream_t::operation_t, bitset_t>> cases = {
+				{bitset_stream_t::operation_t::xorWords, bitset_t(left ^ right)},
+				{bitset_stream_t::operation_t::andWords, bitset_t(left & right)},
+				{bitset_stream_t::operation_t::orWords, bitset_t(left | right)},
+				{bitset_stream_t::operation_t::nandWords, nand(left, right)},
+				{bitset_stream_t::operation_t::norWords, nor(left, right)},
+				{bitset_stream_t::operation_t::andNotWords, bitset_t(left & ~right)}
+			};
+			for (const auto& operation : cases) {
+				view_source_t x(left), y(right);
+				bitset_collector_t collector;
+				CHECK_EQUAL(stream.combine(x, y, operation.first, &collector), operation.second.count());
+				CHECK_EQUAL(collector.release(), operation.second);
+			}
+			view_source_t x(left), y(right);
+			CHECK_EQUAL(stream.hammingDistance(x, y), hammingDistance(left, right));
+		}
+	}
+}
+
+TEST_CASE(ignoresBitsPastLength) {
+	std::mt19937_64 random(19);
+	for (const size_t chunkWords : chunkSizes) {
+		const bitset_stream_t stream(chunkWords);
+		for (const size_t length : lengths) {
+			const bitset_t bits(randomBits(random, length));
+			generator_source_t counted = dirtySource(bits);
+			CHECK_EQUAL(stream.count(counted), bits.count());
+			generator_source_t inverted = dirtySource(bits);
+			bitset_collector_t collector;
+			CHECK_EQUAL(stream.invert(inverted, &collector), length - bits.count());
+			CHECK_EQUAL(collector.release(), bitset_t(~bits));
+			generator_source_t left = dirtySource(bits), right = dirtySource(bitset_t(~bits));
+			bitset_collector_t ored;
+			CHECK_EQUAL(stream.combine(left, right, bitset_stream_t::operation_t::orWords, &ored), length);
+			const bitset_t all = ored.release();
+			CHECK_EQUAL(all.count(), length);
+			if (length % 64 != 0) CHECK_EQUAL(all.data()[all.wordCount() - 1] >> (length % 64), (uint64_t)0);
+		}
+	}
+}
+
+TEST_CASE(roundTripsThroughFiles) {
+	std::mt19937_64 random(20);
+	const std::string path = temporaryPath("sink"), copy = temporaryPath("copy");
+	for (const size_t chunkWords : chunkSizes) {
+		const bitset_stream_t stream(chunkWords);
+		for (const size_t length : lengths) {
+			const bitset_t bits(randomBits(random, length));
+			{
+				view_source_t source(bits);
+				file_sink_t sink(path);
+				CHECK_EQUAL(stream.invert(source, &sink), length - bits.count());
+			}
+			CHECK(mapped_bitset_t(path, true).view() == bitset_t(~bits));
+			{
+				file_source_t source(path);
+				CHECK_EQUAL(source.length(), length);
+				file_sink_t sink(copy);
+				stream.invert(source, &sink);
+			}
+			file_source_t restored(copy);
+			bitset_collector_t collector;
+			stream.invert(restored, &collector);
+			CHECK_EQUAL(collector.release(), bitset_t(~bits));
+		}
+	}
+	// Files written with a checksum and a rank index are read as well
+	const bitset_t bits(randomBits(random, 5000));
+	mapped_bitset_t::write(path, bits, mapped_bitset_t::withChecksum | mapped_bitset_t::withRankIndex);
+	file_source_t source(path);
+	CHECK_EQUAL(bitset_stream_t(5).count(source), bits.count());
+	std::remove(path.c_str());
+	std::remove(copy.c_str());
+}
+
+TEST_CASE(unfinishedSinkLeavesNoFile) {
+	const std::string path = temporaryPath("unfinished");
+	{
+		file_sink_t sink(path);
+		const uint64_t word = 1;
+		sink.write(&word, 1);
+	}
+	CHECK_THROWS(file_source_t(path), std::runtime_error);
+	CHECK_THROWS(file_source_t(path + ".tmp"), std::runtime_error);
+}
+
+TEST_CASE(rejectsShortAndUnequalSources) {
+	for (const size_t chunkWords : chunkSizes) {
+		const bitset_stream_t stream(chunkWords);
+		short_source_t early(1000, 500);
+		CHECK_THROWS(stream.count(early), std::runtime_error);
+		short_source_t left(1000, 1000), right(1000, 900);
+		CHECK_THROWS(stream.combine(left, right, bitset_stream_t::operation_t::xorWords), std::runtime_error);
+		short_source_t shorter(999, 999), longer(1000, 1000);
+		CHECK_THROWS(stream.hammingDistance(shorter, longer), std::invalid_argument);
+	}
+	CHECK_THROWS(bitset_stream_t(0), std::invalid_argument);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file test_bitset_type.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the word-packed storage and the word operations of `bitset_t`
+ */
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_type.h"
+
+TEST_CASE(packsBitsIntoWords) {
+	const bitset_t bits({1, 0, 1, 1, 0, 0, 0, 0, 1});
+	CHECK_EQUAL(bits.length(), (size_t)9);
+	CHECK_EQUAL(bits.wordCount(), (size_t)1);
+	CHECK_EQUAL(bits.data()[0], (bitset_t::word_t)0x10D);
+	CHECK_EQUAL(bits.toBinaryString(), std::string("101100001"));
+}
+
+TEST_CASE(keepsBitsPastLengthReset) {
+	for (const size_t length : boundaryLengths()) {
+		bitset_t bits(std::vector<bool>(length, false));
+		bits.invert();
+		CHECK_EQUAL(bits.count(), length);
+		if (length % 64 != 0) CHECK_EQUAL(bits.data()[bits.wordCount() - 1] >> (length % 64), (bitset_t::word_t)0);
+		bits.setAll();
+		CHECK_EQUAL(bits.count(), length);
+		bits.resize(length / 2);
+		bits.resize(length, bit_t(false));
+		CHECK_EQUAL(bits.count(), length / 2);
+	}
+}
+
+TEST_CASE(resizesWithValue) {
+	bitset_t bits({1, 0, 1});
+	bits.resize(130, bit_t(true));
+	CHECK_EQUAL(bits.length(), (size_t)130);
+	CHECK_EQUAL(bits.count(), (size_t)129);
+	CHECK(!bool(bits[1]));
+	bits.resize(2);
+	CHECK_EQUAL(bits, bitset_t({1, 0}));
+	CHECK_THROWS(bits.at(2), std::out_of_range);
+}
+
+TEST_CASE(matchesBitwiseReference) {
+	std::mt19937_64 random(1);
+	for (const size_t length : boundaryLengths()) {
+		const std::vector<bool> left = randomBits(random, length), right = randomBits(random, length);
+		const bitset_t x(left), y(right);
+		std::vector<bool> exclusive(length), both(length), either(length), notBoth(length), neither(length), inverted(length);
+		size_t distance = 0, common = 0;
+		for (size_t index = 0; index < length; ++index) {
+			exclusive[index] = left[index] != right[index];
+			both[index] = left[index] && right[index];
+			either[index] = left[index] || right[index];
+			notBoth[index] = !both[index];
+			neither[index] = !either[index];
+			inverted[index] = !left[index];
+			distance += exclusive[index];
+			common += both[index];
+		}
+		CHECK_EQUAL(bitset_t(x ^ y), bitset_t(exclusive));
+		CHECK_EQUAL(bitset_t(x & y), bitset_t(both));
+		CHECK_EQUAL(bitset_t(x | y), bitset_t(either));
+		CHECK_EQUAL(bitset_t(~x), bitset_t(inverted));
+		CHECK_EQUAL(nand(x, y), bitset_t(notBoth));
+		CHECK_EQUAL(nor(x, y), bitset_t(neither));
+		CHECK_EQUAL(hammingDistance(x, y), distance);
+		CHECK_EQUAL(bool(x * y), common % 2 == 1);
+		bitset_t compound = x;
+		compound ^= y;
+		CHECK_EQUAL(compound, bitset_t(exclusive));
+		compound = x;
+		compound &= y;
+		CHECK_EQUAL(compound, bitset_t(both));
+		compound = x;
+		compound |= y;
+		CHECK_EQUAL(compound, bitset_t(either));
+	}
+}
+
+TEST_CASE(comparesByLengthAndBits) {
+	bitset_t bits({1, 0}), same({1, 0}), longer({1, 0, 0}), other({0, 1});
+	CHECK(bits == same);
+	CHECK(bits != longer);
+	CHECK(bits != other);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,88 @@
+/**
+ * @file test_bitset_view.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `bitset_view_t` over unaligned ranges of external words
+ */
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_view.h"
+
+static const size_t offsets[] = {0, 1, 7, 63, 64, 65, 130};
+
+static bitset_t slice(const std::vector<bool>& bits, const size_t offset, const size_t length) {
+	return bitset_t(std::vector<bool>(bits.begin() + offset, bits.begin() + offset + length));
+}
+
+TEST_CASE(viewsMatchCopiedRanges) {
+	std::mt19937_64 random(15);
+	const std::vector<bool> reference = randomBits(random, 1200, 0.3);
+	const bitset_t bits(reference);
+	for (const size_t offset : offsets) {
+		for (const size_t length : boundaryLengths()) {
+			if (offset + length > bits.length()) continue;
+			const bitset_view_t view(bits, offset, length);
+			const bitset_t expected = slice(reference, offset, length);
+			CHECK_EQUAL(view.length(), length);
+			CHECK_EQUAL(bitset_t(view), expected);
+			CHECK(view == expected);
+			CHECK_EQUAL(view.count(), expected.count());
+			CHECK_EQUAL(view.any(), expected.any());
+			CHECK_EQUAL(view.findFirst(), expected.findFirst());
+			CHECK_EQUAL(view.findLast(), expected.findLast());
+			if (length > 70) {
+				CHECK_EQUAL(view.findNext(64), expected.findNext(64));
+				CHECK_EQUAL(view.findPrev(65), expected.findPrev(65));
+			}
+			CHECK_EQUAL(view.toBinaryString(), expected.toBinaryString());
+			for (size_t index = 0; index < view.wordCount(); ++index)
+				CHECK_EQUAL(view.paddedWord(index), expected.data()[index]);
+		}
+	}
+}
+
+TEST_CASE(subviewsComposeOffsets) {
+	std::mt19937_64 random(16);
+	const std::vector<bool> reference = randomBits(random, 1000);
+	const bitset_t bits(reference);
+	for (const size_t outer : offsets) {
+		const bitset_view_t view(bits, outer, 1000 - outer);
+		for (const size_t inner : offsets) {
+			const size_t length = 1000 - outer - inner - 5;
+			CHECK_EQUAL(bitset_t(view.subview(inner, length)), slice(reference, outer + inner, length));
+		}
+	}
+	CHECK_THROWS(bitset_view_t(bits, 990, 11), std::out_of_range);
+	CHECK_THROWS(bitset_view_t(bits).subview(10, 991), std::out_of_range);
+}
+
+TEST_CASE(viewsExternalWords) {
+	std::mt19937_64 random(17);
+	const bitset_t bits(randomBits(random, 256));
+	const std::vector<uint64_t> words(bits.data(), bits.data() + bits.wordCount());
+	for (const size_t offset : offsets) {
+		const size_t length = 256 - offset - 3;
+		const bitset_view_t view(words.data(), length, offset);
+		CHECK(view == bitset_view_t(bits, offset, length));
+		CHECK(view != bitset_view_t(bits, offset, length - 1));
+	}
+}
+
+TEST_CASE(viewsAreExpressionOperands) {
+	std::mt19937_64 random(18);
+	const std::vector<bool> reference = randomBits(random, 700);
+	const bitset_t bits(reference);
+	const bitset_view_t left(bits, 3, 300), right(bits, 333, 300);
+	const bitset_t x = slice(reference, 3, 300), y = slice(reference, 333, 300);
+	CHECK_EQUAL(bitset_t(left ^ right), bitset_t(x ^ y));
+	CHECK_EQUAL(bitset_t(left & ~right), bitset_t(x & ~y));
+	CHECK_EQUAL(bitset_t(left | right), bitset_t(x | y));
+	CHECK_EQUAL((left ^ right).count(), hammingDistance(x, y));
+}
+
+int main() {
+	return runTests();
+}
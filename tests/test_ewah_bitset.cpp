@@ -0,0 +1,81 @@
+/**
+ * @file test_ewah_bitset.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `ewah_bitset_t` against `bitset_t`
+ */
+
+#include <random>
+#include <vector>
+
+#include "test_support.h"
+#include "ewah_bitset.h"
+
+// Runs of zero words, of one words, and of mixed words, of random lengths
+static std::vector<bool> runBits(std::mt19937_64& random, const size_t length) {
+	std::vector<bool> bits(length, false);
+	for (size_t index = 0; index < length;) {
+		const size_t kind = random() % 3, words = 1 + random() % 40;
+		for (size_t bit = 0; bit < 64 * words && index < length; ++bit, ++index)
+			bits[index] = (kind == 1) || (kind == 2 && random() % 2 == 0);
+	}
+	return bits;
+}
+
+TEST_CASE(convertsLosslessly) {
+	std::mt19937_64 random(8);
+	for (const size_t length : boundaryLengths()) {
+		for (const std::vector<bool>& pattern : {runBits(random, length), randomBits(random, length), std::vector<bool>(length, true), std::vector<bool>(length, false)}) {
+			const bitset_t bits(pattern);
+			const ewah_bitset_t compressed(bits);
+			CHECK_EQUAL(compressed.length(), length);
+			CHECK_EQUAL(compressed.count(), bits.count());
+			CHECK_EQUAL(bitset_t(compressed), bits);
+		}
+	}
+}
+
+TEST_CASE(compressesRuns) {
+	bitset_t bits(std::vector<bool>(64 * 100000, false));
+	bits[12345] = bit_t(true);
+	const ewah_bitset_t compressed(bits);
+	CHECK(compressed.wordCount() <= 4);
+	CHECK_EQUAL(bitset_t(compressed), bits);
+}
+
+TEST_CASE(iteratesSetBits) {
+	std::mt19937_64 random(9);
+	for (const size_t length : boundaryLengths()) {
+		const std::vector<bool> pattern = runBits(random, length);
+		std::vector<size_t> expected;
+		for (size_t index = 0; index < length; ++index)
+			if (pattern[index]) expected.push_back(index);
+		const ewah_bitset_t compressed{bitset_t(pattern)};
+		CHECK(std::vector<size_t>(compressed.begin(), compressed.end()) == expected);
+	}
+}
+
+TEST_CASE(operationsMatchBitset) {
+	std::mt19937_64 random(10);
+	for (const size_t length : boundaryLengths()) {
+		for (size_t round = 0; round < 4; ++round) {
+			const bitset_t left((round % 2 == 0) ? runBits(random, length) : randomBits(random, length)), right(runBits(random, length));
+			const ewah_bitset_t x(left), y(right);
+			CHECK_EQUAL(bitset_t(x ^ y), bitset_t(left ^ right));
+			CHECK_EQUAL(bitset_t(x & y), bitset_t(left & right));
+			CHECK_EQUAL(bitset_t(x | y), bitset_t(left | right));
+			CHECK_EQUAL(bitset_t(~x), bitset_t(~left));
+			CHECK_EQUAL((x | y).count(), bitset_t(left | right).count());
+			CHECK_EQUAL(hammingDistance(x, y), hammingDistance(left, right));
+			CHECK_EQUAL(x == y, hammingDistance(left, right) == 0);
+			CHECK(x == ewah_bitset_t(left));
+			ewah_bitset_t inverted = x;
+			inverted.invert();
+			CHECK_EQUAL(bitset_t(inverted), bitset_t(~left));
+			CHECK_EQUAL(inverted.toBinaryString(), bitset_t(~left).toBinaryString());
+		}
+	}
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,126 @@
+/**
+ * @file test_fingerprint_index.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the nearest neighbour search of `fingerprint_index_t` against brute force
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_support.h"
+#include "bitset_kernels.h"
+#include "fingerprint_index.h"
+
+static std::vector<neighbour_t> bruteForce(const std::vector<bitset_t>& fingerprints, const bitset_t& query, const size_t k) {
+	std::vector<neighbour_t> all;
+	for (size_t id = 0; id < fingerprints.size(); ++id)
+		all.push_back(neighbour_t{id, hammingDistance(query, fingerprints[id])});
+	std::sort(all.begin(), all.end(), [](const neighbour_t& left, const neighbour_t& right) {
+		return left.distance < right.distance || (left.distance == right.distance && left.id < right.id);
+	});
+	all.resize(std::min(k, all.size()));
+	return all;
+}
+
+static bool sameNeighbours(const std::vector<neighbour_t>& left, const std::vector<neighbour_t>& right) {
+	if (left.size() != right.size()) return false;
+	for (size_t index = 0; index < left.size(); ++index)
+		if (left[index].id != right[index].id || left[index].distance != right[index].distance) return false;
+	return true;
+}
+
+// Stored fingerprints with a few bits flipped are found by the probes of the first radii, random queries fall back to the scan
+static std::vector<bitset_t> queriesFor(std::mt19937_64& random, const std::vector<bitset_t>& fingerprints, const size_t length) {
+	std::vector<bitset_t> queries;
+	for (size_t flips = 0; flips < 4; ++flips) {
+		bitset_t query = fingerprints[random() % fingerprints.size()];
+		for (size_t flip = 0; flip < flips; ++flip)
+			query[random() % length] = bit_t(!bool(query[random() % length]));
+		queries.push_back(query);
+	}
+	for (size_t index = 0; index < 4; ++index)
+		queries.emplace_back(randomBits(random, length));
+	return queries;
+}
+
+static void checkCollection(std::mt19937_64& random, const size_t length, const size_t substrings, const size_t count) {
+	fingerprint_index_t index(length, substrings);
+	std::vector<bitset_t> fingerprints;
+	for (size_t id = 0; id < count; ++id) {
+		fingerprints.emplace_back(randomBits(random, length));
+		CHECK_EQUAL(index.insert(fingerprints.back()), id);
+	}
+	CHECK_EQUAL(index.size(), count);
+	for (const bitset_t& query : queriesFor(random, fingerprints, length))
+		for (const size_t k : {1, 3, 10, 100})
+			CHECK(sameNeighbours(index.nearest(query, k), bruteForce(fingerprints, query, k)));
+}
+
+TEST_CASE(matchesBruteForce) {
+	std::mt19937_64 random(6);
+	for (const size_t length : {32, 64, 100, 256}) {
+		for (const size_t count : {50, 3000}) {
+			checkCollection(random, length, 0, count);
+			checkCollection(random, length, fingerprint_index_t::substringsFor(length, count), count);
+		}
+	}
+	checkCollection(random, 64, 2, 20000);
+	checkCollection(random, 64, 8, 2000);
+}
+
+TEST_CASE(matchesBruteForceAtEveryLevel) {
+	std::mt19937_64 random(7);
+	for (const isa_t isa : {isa_t::scalar, isa_t::sse2, isa_t::avx2, isa_t::avx512}) {
+		if (!forceIsa(isa)) continue;
+		checkCollection(random, 200, 0, 1000);
+	}
+	forceIsa(detectIsa());
+}
+
+TEST_CASE(ordersTiesById) {
+	std::mt19937_64 random(8);
+	fingerprint_index_t index(64, 4);
+	std::vector<bitset_t> codes, fingerprints;
+	for (size_t code = 0; code < 200; ++code)
+		codes.emplace_back(randomBits(random, 64));
+	// Every fingerprint three times, and several at the same distance from the query
+	for (size_t round = 0; round < 3; ++round)
+		for (const bitset_t& code : codes) {
+			fingerprints.push_back(code);
+			index.insert(code);
+		}
+	for (const size_t code : {0, 7, 199}) {
+		const bitset_t query = fingerprints[code];
+		const std::vector<neighbour_t> nearest = index.nearest(query, 5);
+		CHECK(sameNeighbours(nearest, bruteForce(fingerprints, query, 5)));
+		CHECK_EQUAL(nearest[0].id, code);
+		CHECK_EQUAL(nearest[1].id, code + 200);
+		CHECK_EQUAL(nearest[2].id, code + 400);
+	}
+}
+
+TEST_CASE(returnsWholeCollectionForLargeK) {
+	std::mt19937_64 random(9);
+	fingerprint_index_t index(100, 4);
+	std::vector<bitset_t> fingerprints;
+	CHECK(index.nearest(bitset_t(randomBits(random, 100)), 5).empty());
+	for (size_t id = 0; id < 40; ++id) {
+		fingerprints.emplace_back(randomBits(random, 100));
+		index.insert(fingerprints.back());
+	}
+	const bitset_t query(randomBits(random, 100));
+	CHECK(sameNeighbours(index.nearest(query, 1000), bruteForce(fingerprints, query, 40)));
+	CHECK(index.nearest(query, 0).empty());
+}
+
+TEST_CASE(rejectsOtherLengths) {
+	fingerprint_index_t index(64, 2);
+	CHECK_THROWS(index.insert(bitset_t(std::vector<bool>(65, false))), std::invalid_argument);
+	CHECK_THROWS(index.nearest(bitset_t(std::vector<bool>(63, false)), 1), std::invalid_argument);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_hamming_batch.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of the batched Hamming distances and scalar products against the pairwise operations
+ */
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_support.h"
+#include "hamming_batch.h"
+
+static std::vector<bitset_t> randomBitsets(std::mt19937_64& random, const size_t count, const size_t length) {
+	std::vector<bitset_t> bitsets;
+	for (size_t index = 0; index < count; ++index)
+		bitsets.emplace_back(randomBits(random, length));
+	return bitsets;
+}
+
+static std::vector<uint64_t> packed(const std::vector<bitset_t>& bitsets) {
+	std::vector<uint64_t> words;
+	for (const bitset_t& bits : bitsets)
+		words.insert(words.end(), bits.data(), bits.data() + bits.wordCount());
+	return words;
+}
+
+// Checks queries against fingerprints with both overloads of hammingDistanceMatrix()
+static void checkMatrix(std::mt19937_64& random, const size_t queryCount, const size_t count, const size_t length) {
+	const std::vector<bitset_t> queries = randomBitsets(random, queryCount, length), fingerprints = randomBitsets(random, count, length);
+	std::vector<size_t> expected(queryCount * count), distances(queryCount * count, ~(size_t)0), packedDistances(queryCount * count, ~(size_t)0);
+	for (size_t query = 0; query < queryCount; ++query)
+		for (size_t row = 0; row < count; ++row)
+			expected[query * count + row] = hammingDistance(queries[query], fingerprints[row]);
+	hammingDistanceMatrix(queries.data(), queryCount, fingerprints.data(), count, distances.data());
+	const std::vector<uint64_t> packedQueries = packed(queries), packedFingerprints = packed(fingerprints);
+	hammingDistanceMatrix(packedQueries.data(), queryCount, packedFingerprints.data(), count, (length + 63) / 64, packedDistances.data());
+	CHECK(distances == expected);
+	CHECK(packedDistances == expected);
+}
+
+TEST_CASE(distancesMatchPairwise) {
+	std::mt19937_64 random(5);
+	for (const size_t length : {1, 63, 64, 65, 130, 1000}) {
+		for (const size_t count : {0, 1, 7, 64, 1001}) {
+			const bitset_t query(randomBits(random, length));
+			const std::vector<bitset_t> fingerprints = randomBitsets(random, count, length);
+			std::vector<size_t> expected(count), distances(count, ~(size_t)0), packedDistances(count, ~(size_t)0);
+			for (size_t row = 0; row < count; ++row)
+				expected[row] = hammingDistance(query, fingerprints[row]);
+			hammingDistances(query, fingerprints.data(), count, distances.data());
+			const std::vector<uint64_t> words = packed(fingerprints);
+			hammingDistances(query.data(), words.data(), count, query.wordCount(), packedDistances.data());
+			CHECK(distances == expected);
+			CHECK(packedDistances == expected);
+		}
+	}
+}
+
+TEST_CASE(matrixMatchesPairwise) {
+	std::mt19937_64 random(6);
+	for (const size_t length : {64, 200})
+		for (const size_t queryCount : {1, 3, 9})
+			for (const size_t count : {1, 5, 300})
+				checkMatrix(random, queryCount, count, length);
+}
+
+TEST_CASE(splitMatrixMatchesPairwise) {
+	parallel_scope_t parallel;
+	std::mt19937_64 random(7);
+	// More fingerprints than queries, and more queries than fingerprints, with rows not a whole number of cache lines
+	checkMatrix(random, 3, 4099, 1000);
+	checkMatrix(random, 1, 4099, 1000);
+	checkMatrix(random, 1001, 13, 500);
+	checkMatrix(random, 700, 13, 512);
+}
+
+TEST_CASE(rejectsUnequalLengths) {
+	const bitset_t query(std::vector<bool>(64, true));
+	const std::vector<bitset_t> fingerprints = {bitset_t(std::vector<bool>(64, false)), bitset_t(std::vector<bool>(65, false))};
+	std::vector<size_t> distances(2);
+	CHECK_THROWS(hammingDistances(query, fingerprints.data(), 2, distances.data()), std::invalid_argument);
+	CHECK_THROWS(hammingDistanceMatrix(&query, 1, fingerprints.data(), 2, distances.data()), std::invalid_argument);
+	CHECK_THROWS(scalarProducts(query, fingerprints.data(), 2), std::invalid_argument);
+}
+
+// Checks both overloads of scalarProducts() against operator*
+static void checkProducts(std::mt19937_64& random, const size_t count, const size_t length) {
+	const bitset_t vector(randomBits(random, length));
+	const std::vector<bitset_t> rows = randomBitsets(random, count, length);
+	std::vector<bool> expected(count);
+	for (size_t row = 0; row < count; ++row)
+		expected[row] = bool(vector * rows[row]);
+	CHECK_EQUAL(scalarProducts(vector, rows.data(), count), bitset_t(expected));
+	const std::vector<uint64_t> words = packed(rows);
+	std::vector<uint64_t> products((count + 63) / 64, ~0ULL);
+	scalarProducts(vector.data(), words.data(), count, vector.wordCount(), products.data());
+	CHECK_EQUAL(bitset_t(products, count), bitset_t(expected));
+}
+
+TEST_CASE(productsMatchPairwise) {
+	std::mt19937_64 random(25);
+	for (const size_t length : {1, 63, 64, 65, 1000})
+		for (const size_t count : {0, 1, 63, 64, 65, 1000})
+			checkProducts(random, count, length);
+}
+
+TEST_CASE(splitProductsMatchPairwise) {
+	parallel_scope_t parallel;
+	std::mt19937_64 random(26);
+	checkProducts(random, 4099, 1280);
+	checkProducts(random, 64 * 1100 + 5, 64);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_mapped_bitset.cpp
+ * @date October 16, 2026
+ * @brief Contains the round-trip tests of the bitset file format, and the tests of the validation of damaged files
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+
+#include "test_support.h"
+#include "mapped_bitset.h"
+
+static std::string temporaryPath(const std::string& name) {
+	return "test_mapped_bitset_" + std::to_string((long)::getpid()) + "_" + name + ".bits";
+}
+
+static std::vector<char> readFile(const std::string& path) {
+	std::ifstream file(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string& path, const std::vector<char>& bytes) {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(bytes.data(), (std::streamsize)bytes.size());
+}
+
+/**
+ * @brief Writes @p bits with @p options, lets @p damage change the header or the bytes of the file, and tests whether the damaged file is rejected when opened
+ */
+template <class Damage>
+static bool rejected(const bitset_t& bits, const unsigned options, const Damage& damage, const bool verifyChecksum = false) {
+	const std::string path = temporaryPath("damaged");
+	mapped_bitset_t::write(path, bits, options);
+	std::vector<char> bytes = readFile(path);
+	bitset_file_header_t header;
+	std::memcpy(&header, bytes.data(), sizeof(header));
+	damage(header, bytes);
+	std::memcpy(bytes.data(), &header, std::min(sizeof(header), bytes.size()));
+	writeFile(path, bytes);
+	bool thrown = false;
+	try {
+		mapped_bitset_t mapped(path, verifyChecksum);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	std::remove(path.c_str());
+	return thrown;
+}
+
+TEST_CASE(roundTripsEveryOption) {
+	std::mt19937_64 random(16);
+	std::vector<size_t> lengths = boundaryLengths();
+	lengths.push_back(100003);
+	const std::string path = temporaryPath("round_trip");
+	for (const size_t length : lengths) {
+		for (const unsigned options : {0u, 1u, 2u, 3u}) {
+			const bitset_t bits(randomBits(random, length));
+			mapped_bitset_t::write(path, bits, options);
+			const mapped_bitset_t mapped(path, true);
+			CHECK_EQUAL(mapped.length(), length);
+			CHECK(mapped.view() == bits);
+			CHECK(mapped.verify());
+			CHECK_EQUAL(mapped.hasRankIndex(), (options & mapped_bitset_t::withRankIndex) != 0);
+			if (mapped.hasRankIndex()) {
+				const rank_index_t& index = mapped.rankIndex();
+				CHECK_EQUAL(index.count(), bits.count());
+				for (size_t position = 0; position <= length; position += 97)
+					CHECK_EQUAL(index.rank1(position), bitset_view_t(bits, 0, position).count());
+			} else {
+				CHECK_THROWS(mapped.rankIndex(), std::logic_error);
+			}
+		}
+	}
+	std::remove(path.c_str());
+}
+
+TEST_CASE(movesMapping) {
+	const std::string path = temporaryPath("move");
+	const bitset_t bits({1, 0, 1, 1});
+	mapped_bitset_t::write(path, bits, mapped_bitset_t::withRankIndex);
+	mapped_bitset_t first(path);
+	mapped_bitset_t second(std::move(first));
+	CHECK(second.view() == bits);
+	CHECK_EQUAL(second.rankIndex().rank1(4), (size_t)3);
+	mapped_bitset_t third(path);
+	third = std::move(second);
+	CHECK(third.view() == bits);
+	std::remove(path.c_str());
+}
+
+TEST_CASE(rejectsDamagedHeaders) {
+	std::mt19937_64 random(17);
+	const bitset_t bits(randomBits(random, 5000));
+	const unsigned all = mapped_bitset_t::withChecksum | mapped_bitset_t::withRankIndex;
+	CHECK(!rejected(bits, all, [](bitset_file_header_t&, std::vector<char>&) {}));
+	CHECK(rejected(bits, all, [](bitset_file_header_t& header, std::vector<char>&) { header.magic ^= 1; }));
+	CHECK(rejected(bits, all, [](bitset_file_header_t& header, std::vector<char>&) { header.byteOrder = 0x0807060504030201ULL; }));
+	CHECK(rejected(bits, all, [](bitset_file_header_t& header, std::vector<char>&) { header.version += 1; }));
+	CHECK(rejected(bits, all, [](bitset_file_header_t&, std::vector<char>& bytes) { bytes.resize(40); }));
+	CHECK_THROWS(mapped_bitset_t(temporaryPath("missing")), std::runtime_error);
+}
+
+TEST_CASE(rejectsTruncatedPayloads) {
+	std::mt19937_64 random(18);
+	const bitset_t bits(randomBits(random, 5000));
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t&, std::vector<char>& bytes) { bytes.resize(bytes.size() - 8); }));
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t& header, std::vector<char>&) { header.bitLength += 64; }));
+	// Lengths whose word counts overflow the size computations
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t& header, std::vector<char>&) { header.bitLength = ~(uint64_t)0; }));
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t& header, std::vector<char>&) { header.payloadOffset = ~(uint64_t)0 - 7; }));
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t& header, std::vector<char>&) { header.payloadOffset = 32; }));
+	CHECK(rejected(bits, mapped_bitset_t::plain, [](bitset_file_header_t& header, std::vector<char>&) { header.payloadOffset += 4; }));
+}
+
+TEST_CASE(rejectsDamagedIndexSections) {
+	std::mt19937_64 random(19);
+	const bitset_t bits(randomBits(random, 5000));
+	const unsigned indexed = mapped_bitset_t::withRankIndex;
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexOffset += 4; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexOffset -= 8; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>& bytes) { header.indexOffset = bytes.size() + 8; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexOffset = ~(uint64_t)0 - 7; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexWords += 1; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexWords -= 1; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexWords = 0; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t& header, std::vector<char>&) { header.indexWords = ~(uint64_t)0; }));
+	CHECK(rejected(bits, indexed, [](bitset_file_header_t&, std::vector<char>& bytes) { bytes.resize(bytes.size() - 8); }));
+}
+
+TEST_CASE(verifiesChecksums) {
+	std::mt19937_64 random(20);
+	const bitset_t bits(randomBits(random, 5000));
+	const unsigned all = mapped_bitset_t::withChecksum | mapped_bitset_t::withRankIndex;
+	const auto flipPayloadBit = [](bitset_file_header_t& header, std::vector<char>& bytes) { bytes[header.payloadOffset + 100] ^= 4; };
+	const auto flipIndexBit = [](bitset_file_header_t& header, std::vector<char>& bytes) { bytes[header.indexOffset + 8 * header.indexWords - 1] ^= 1; };
+	CHECK(rejected(bits, all, flipPayloadBit, true));
+	CHECK(rejected(bits, all, flipIndexBit, true));
+	CHECK(rejected(bits, all, [](bitset_file_header_t& header, std::vector<char>&) { header.checksum ^= 1; }, true));
+	// The checksum is only read on request
+	CHECK(!rejected(bits, all, flipPayloadBit, false));
+	const std::string path = temporaryPath("checksum");
+	mapped_bitset_t::write(path, bits, mapped_bitset_t::withChecksum);
+	std::vector<char> bytes = readFile(path);
+	bytes[bytes.size() - 1] ^= 1;
+	writeFile(path, bytes);
+	const mapped_bitset_t mapped(path);
+	CHECK(!mapped.verify());
+	std::remove(path.c_str());
+}
+
+int main() {
+	return runTests();
+}
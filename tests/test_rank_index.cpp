@@ -0,0 +1,69 @@
+/**
+ * @file test_rank_index.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `rank_index_t` against the bits of `bitset_t`
+ */
+
+#include <random>
+#include <vector>
+
+#include "test_support.h"
+#include "rank_index.h"
+
+// Checks every rank and every select of the index against a scan of the bits
+static void checkAgainstScan(const bitset_t& bits, const rank_index_t& index) {
+	CHECK_EQUAL(index.length(), bits.length());
+	CHECK_EQUAL(index.count(), bits.count());
+	size_t ones = 0, rankMismatches = 0, selectMismatches = 0;
+	for (size_t position = 0; position < bits.length(); ++position) {
+		rankMismatches += index.rank1(position) != ones;
+		rankMismatches += index.rank0(position) != position - ones;
+		if (bits[position]) {
+			selectMismatches += index.select1(ones) != position;
+			selectMismatches += index.rank1(index.select1(ones)) != ones;
+			++ones;
+		}
+	}
+	CHECK_EQUAL(rankMismatches, (size_t)0);
+	CHECK_EQUAL(selectMismatches, (size_t)0);
+	CHECK_EQUAL(index.rank1(bits.length()), ones);
+	CHECK_EQUAL(index.rank1(bits.length() + 100), ones);
+	CHECK_EQUAL(index.rank0(bits.length()), bits.length() - ones);
+	CHECK_EQUAL(index.select1(ones), bitset_t::npos);
+}
+
+TEST_CASE(matchesScanAtBoundaryLengths) {
+	std::mt19937_64 random(10);
+	for (const size_t length : boundaryLengths()) {
+		const bitset_t bits(randomBits(random, length));
+		checkAgainstScan(bits, rank_index_t(bits));
+	}
+}
+
+TEST_CASE(matchesScanAcrossBlocksAndSamples) {
+	std::mt19937_64 random(11);
+	// Sparse bits leave blocks without set bits, dense bits put several select samples in a block
+	for (const double density : {0.001, 0.02, 0.5, 0.98, 1.0}) {
+		for (const size_t length : {2047, 2048, 2049, 100000}) {
+			const bitset_t bits(randomBits(random, length, density));
+			checkAgainstScan(bits, rank_index_t(bits));
+		}
+	}
+}
+
+TEST_CASE(copiesKeepAnswering) {
+	std::mt19937_64 random(12);
+	const bitset_t bits(randomBits(random, 20000, 0.3));
+	const rank_index_t original(bits);
+	rank_index_t copy(original);
+	checkAgainstScan(bits, copy);
+	const bitset_t other(std::vector<bool>(5, false));
+	copy = rank_index_t(other);
+	checkAgainstScan(other, copy);
+	copy = original;
+	checkAgainstScan(bits, copy);
+}
+
+int main() {
+	return runTests();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file test_roaring_bitmap.cpp
+ * @date October 16, 2026
+ * @brief Contains the tests of `roaring_bitmap_t` against `bitset_t`
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "test_support.h"
+#include "roaring_bitmap.h"
+
+// Bits of every chunk in another pattern, so that array, run and bitmap containers meet each other in the operations
+static std::vector<bool> mixedBits(std::mt19937_64& random, const size_t length, const size_t first) {
+	std::vector<bool> bits(length, false);
+	for (size_t chunk = 0; chunk * roaring_bitmap_t::chunkBits < length; ++chunk) {
+		const size_t begin = chunk * roaring_bitmap_t::chunkBits, end = std::min(begin + roaring_bitmap_t::chunkBits, length);
+		switch ((first + chunk) % 5) {
+			case 0:	// empty
+				break;
+			case 1:	// sparse, an array container
+				for (size_t index = begin; index < end; ++index)
+					bits[index] = random() % 1000 == 0;
+				break;
+			case 2:	// long runs, a run container
+				for (size_t index = begin; index < end; ++index)
+					bits[index] = (index / 1500 + first) % 3 == 0;
+				break;
+			case 3:	// random, a bitmap container
+				for (size_t index = begin; index < end; ++index)
+					bits[index] = random() % 2 == 0;
+				break;
+			default:	// full
+				for (size_t index = begin; index < end; ++index)
+					bits[index] = true;
+		}
+	}
+	return bits;
+}
+
+TEST_CASE(convertsLosslessly) {
+	std::mt19937_64 random(7);
+	for (const size_t length : {(size_t)0, (size_t)1, (size_t)129, roaring_bitmap_t::chunkBits, 5 * roaring_bitmap_t::chunkBits + 77}) {
+		for (size_t first = 0; first < 5; ++first) {
+			const bitset_t bits(mixedBits(random, length, first));
+			const roaring_bitmap_t bitmap(bits);
+			CHECK_EQUAL(bitmap.length(), length);
+			CHECK_EQUAL(bitmap.count(), bits.count());
+			CHECK_EQUAL(bitset_t(bitmap), bits);
+		}
+	}
+}
+
+TEST_CASE(operationsMatchBitset) {
+	std::mt19937_64 random(8);
+	const size_t length = 5 * roaring_bitmap_t::chunkBits + 77;
+	for (size_t first = 0; first < 5; ++first) {
+		for (size_t second = 0; second < 5; ++second) {
+			const bitset_t left(mixedBits(random, length, first)), right(mixedBits(random, length, second));
+			const roaring_bitmap_t x(left), y(right);
+			CHECK_EQUAL(bitset_t(x ^ y), bitset_t(left ^ right));
+			CHECK_EQUAL(bitset_t(x & y), bitset_t(left & right));
+			CHECK_EQUAL(bitset_t(x | y), bitset_t(left | right));
+			CHECK_EQUAL(bitset_t(~x), bitset_t(~left));
+			CHECK_EQUAL(hammingDistance(x, y), hammingDistance(left, right));
+			CHECK_EQUAL((x & y).count(), bitset_t(left & right).count());
+			CHECK_EQUAL(x == y, hammingDistance(left, right) == 0);
+		}
+	}
+}
+
+TEST_CASE(invertsInPlace) {
+	std::mt19937_64 random(9);
+	const bitset_t bits(mixedBits(random, 3 * roaring_bitmap_t::chunkBits + 5, 1));
+	roaring_bitmap_t bitmap(bits);
+	bitmap.invert();
+	CHECK_EQUAL(bitset_t(bitmap), bitset_t(~bits));
+	bitmap.invert();
+	CHECK(bitmap == roaring_bitmap_t(bits));
+}
+
+TEST_CASE(setsAndResetsSingleBits) {
+	std::mt19937_64 random(10);
+	const size_t length = 3 * roaring_bitmap_t::chunkBits + 5;
+	bitset_t bits(mixedBits(random, length, 2));
+	roaring_bitmap_t bitmap(bits);
+	for (size_t step = 0; step < 20000; ++step) {
+		const size_t index = random() % length;
+		if (random() % 2 == 0) {
+			bitmap.set(index);
+			bits[index] = bit_t(true);
+		} else {
+			bitmap.reset(index);
+			bits[index] = bit_t(false);
+		}
+	}
+	CHECK_EQUAL(bitset_t(bitmap), bits);
+	CHECK_EQUAL(bitmap.count(), bits.count());
+	for (size_t index = 0; index < length; index += 997)
+		CHECK_EQUAL(bool(bitmap.at(index)), bool(bits[index]));
+	CHECK_THROWS(bitmap.at(length), std::out_of_range);
+	CHECK_THROWS(bitmap.set(length), std::out_of_range);
+}
+
+TEST_CASE(storesSparseBitsCompactly) {
+	roaring_bitmap_t sparse(1000000000);
+	sparse.set(7);
+	sparse.set(999999999);
+	CHECK_EQUAL(sparse.count(), (size_t)2);
+	CHECK(sparse.memoryUsage() < 1024);
+	roaring_bitmap_t full(1000000);
+	full.invert();
+	CHECK_EQUAL(full.count(), (size_t)1000000);
+	CHECK(full.memoryUsage() < 1000000 / 8 / 16);
+}
+
+int main() {
+	return runTests();
+}
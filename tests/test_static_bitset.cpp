@@ -0,0 +1,102 @@
+/**
+ * @file test_static_bitset.cpp
+ * @date October 16, 2026
+ * @brief Contains the compile-time checks of the constant expressions of `static_bitset_t`, and its tests against `bitset_t`
+ */
+
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "test_support.h"
+#include "static_bitset.h"
+
+// Evaluated by the compiler: every check below fails the build rather than the test
+constexpr static_bitset_t<1> one(1);
+static_assert(one.count() == 1 && one.shiftedLeft(1).count() == 0 && one.rotatedLeft(5) == one, "1-bit shifts and rotations");
+static_assert((~one).count() == 0 && !(!one).any(), "1-bit inversion");
+
+constexpr static_bitset_t<63> ends(0x4000000000000001ULL);
+static_assert(ends.count() == 2 && (~ends).count() == 61, "63-bit count ignores the unused bit");
+static_assert(ends.rotatedLeft(1)[61] && ends.rotatedLeft(1)[62] && ends.rotatedLeft(1).count() == 2, "63-bit rotation wraps at bit 62");
+static_assert(ends.shiftedRight(1)[1] && ends.shiftedRight(1).count() == 1, "63-bit shift drops bit 62");
+
+constexpr static_bitset_t<64> full(~0ULL);
+static_assert(full.count() == 64 && full.shiftedLeft(63).count() == 1 && full.shiftedRight(64).count() == 0, "64-bit shifts");
+static_assert(full.rotatedRight(17) == full && hammingDistance(full, full.shiftedLeft(8)) == 8, "64-bit rotations");
+
+constexpr static_bitset_t<65> low(0x8000000000000001ULL);
+static_assert(low.shiftedRight(1)[64] && low.shiftedRight(1)[1] && low.shiftedRight(1).count() == 2, "65-bit shift crosses the word boundary");
+static_assert(low.rotatedRight(2)[0] && low.rotatedRight(2)[2] && low.rotatedRight(2).count() == 2, "65-bit rotation wraps over bit 64");
+static_assert(low.rotatedLeft(1).rotatedRight(1) == low && (~low).count() == 63, "65-bit rotations undo each other");
+
+constexpr static_bitset_t<130> wide(0x8000000000000001ULL);
+static_assert(wide.shiftedRight(65)[65] && wide.shiftedRight(65)[128] && wide.shiftedRight(65).count() == 2, "130-bit shift over two words");
+static_assert(wide.rotatedLeft(1)[129] && wide.rotatedLeft(1)[62] && wide.rotatedLeft(130) == wide, "130-bit rotation");
+static_assert(((wide ^ wide.shiftedRight(1)) & ~wide).count() == 2 && (wide | wide.shiftedRight(64)).count() == 4, "130-bit operators");
+static_assert(hammingDistance(wide, wide.rotatedRight(64)) == 4 && wide != wide.rotatedRight(64), "130-bit distance");
+static_assert(one.scalarProduct(one) && !wide.scalarProduct(wide) && wide.scalarProduct(wide.shiftedLeft(63)), "scalar products");
+static_assert(std::is_same<decltype(wide * wide), bit_t>::value, "operator* returns bit_t, as bitset_t::operator* does");
+
+template <size_t Length>
+static void checkAgainstBitset(std::mt19937_64& random) {
+	const std::vector<size_t> shifts = {0, 1, 2, 63, 64, 65, Length - 1, Length, Length + 1, 2 * Length + 1};
+	for (size_t round = 0; round < 8; ++round) {
+		const bitset_t left(randomBits(random, Length)), right(randomBits(random, Length));
+		const static_bitset_t<Length> x(left), y(right);
+		CHECK_EQUAL(x.toBitset(), left);
+		CHECK_EQUAL((x ^ y).toBitset(), bitset_t(left ^ right));
+		CHECK_EQUAL((x & y).toBitset(), bitset_t(left & right));
+		CHECK_EQUAL((x | y).toBitset(), bitset_t(left | right));
+		CHECK_EQUAL((~x).toBitset(), bitset_t(~left));
+		CHECK_EQUAL(x.count(), left.count());
+		CHECK_EQUAL(hammingDistance(x, y), hammingDistance(left, right));
+		CHECK_EQUAL(bool(x * y), bool(left * right));
+		CHECK_EQUAL(x.toBinaryString(), left.toBinaryString());
+		for (const size_t shift : shifts) {
+			bitset_t expected = left;
+			expected.shiftLeft(shift);
+			CHECK_EQUAL(x.shiftedLeft(shift).toBitset(), expected);
+			expected = left;
+			expected.shiftRight(shift);
+			CHECK_EQUAL(x.shiftedRight(shift).toBitset(), expected);
+			expected = left;
+			expected.rotateLeft(shift);
+			CHECK_EQUAL(x.rotatedLeft(shift).toBitset(), expected);
+			static_bitset_t<Length> rotated = x;
+			rotated.rotateRight(shift);
+			expected = left;
+			expected.rotateRight(shift);
+			CHECK_EQUAL(rotated.toBitset(), expected);
+		}
+	}
+}
+
+TEST_CASE(matchesBitset) {
+	std::mt19937_64 random(21);
+	checkAgainstBitset<1>(random);
+	checkAgainstBitset<63>(random);
+	checkAgainstBitset<64>(random);
+	checkAgainstBitset<65>(random);
+	checkAgainstBitset<130>(random);
+}
+
+TEST_CASE(modifiesInPlace) {
+	static_bitset_t<130> bits({1, 0, 1});
+	bits.set(129);
+	CHECK_EQUAL(bits.count(), (size_t)3);
+	CHECK(bits.at(129));
+	CHECK_THROWS(bits.at(130), std::out_of_range);
+	bits.invert();
+	CHECK_EQUAL(bits.count(), (size_t)127);
+	bits.setAll();
+	CHECK_EQUAL(bits.count(), (size_t)130);
+	bits.resetAll();
+	CHECK(!bits.any());
+	CHECK_THROWS(static_bitset_t<130>(bitset_t(std::vector<bool>(129, true))), std::invalid_argument);
+}
+
+int main() {
+	return runTests();
+}
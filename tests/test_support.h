@@ -0,0 +1,164 @@
+/**
+ * @file test_support.h
+ * @date October 16, 2026
+ * @brief Contains the assertion macros and helpers shared by the bitlib tests
+ */
+
+#ifndef bitlib___test_support_h
+#define bitlib___test_support_h
+
+#include <cstdint>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "bitset_type.h"
+#include "bitset_parallel.h"
+
+/**
+ * @brief Test function registered by @ref TEST_CASE
+ */
+struct test_case_t {
+	const char* name;
+	void (*run)();
+};
+
+inline std::vector<test_case_t>& testCases() {
+	static std::vector<test_case_t> cases;
+	return cases;
+}
+
+inline size_t& testFailures() {
+	static size_t failures = 0;
+	return failures;
+}
+
+/**
+ * @brief Adds a test function to testCases() during static initialisation
+ */
+struct test_registration_t {
+	test_registration_t(const char* name, void (*run)()) {
+		testCases().push_back(test_case_t{name, run});
+	}
+};
+
+/**
+ * @brief Defines and registers a test function, run by runTests()
+ */
+#define TEST_CASE(name) \
+	static void name(); \
+	static const test_registration_t name##Registration(#name, name); \
+	static void name()
+
+/**
+ * @brief Reports a failure, and goes on with the test, unless @p condition holds
+ */
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			++testFailures(); \
+			std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+		} \
+	} while (false)
+
+/**
+ * @brief Reports a failure with both values, and goes on with the test, unless @p left equals @p right
+ */
+#define CHECK_EQUAL(left, right) \
+	do { \
+		const auto& checkedLeft = (left); \
+		const auto& checkedRight = (right); \
+		if (!(checkedLeft == checkedRight)) { \
+			++testFailures(); \
+			std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK_EQUAL(" #left ", " #right ") failed: " << checkedLeft << " != " << checkedRight << std::endl; \
+		} \
+	} while (false)
+
+/**
+ * @brief Reports a failure unless @p expression throws @p exception
+ */
+#define CHECK_THROWS(expression, exception) \
+	do { \
+		bool thrown = false; \
+		try { \
+			(void)(expression); \
+		} catch (const exception&) { \
+			thrown = true; \
+		} \
+		if (!thrown) { \
+			++testFailures(); \
+			std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK_THROWS(" #expression ", " #exception ") failed" << std::endl; \
+		} \
+	} while (false)
+
+/**
+ * @brief Runs every registered test, and returns the exit status of the test program
+ */
+inline int runTests() {
+	for (const test_case_t& test : testCases()) {
+		const size_t before = testFailures();
+		try {
+			test.run();
+		} catch (const std::exception& error) {
+			++testFailures();
+			std::cerr << test.name << ": unexpected exception: " << error.what() << std::endl;
+		}
+		std::cout << ((testFailures() == before) ? "[ pass ] " : "[ FAIL ] ") << test.name << std::endl;
+	}
+	std::cout << testCases().size() << " tests, " << testFailures() << " failed checks" << std::endl;
+	return (testFailures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Returns @p length random bits, each set with probability @p density
+ */
+inline std::vector<bool> randomBits(std::mt19937_64& random, const size_t length, const double density = 0.5) {
+	std::bernoulli_distribution bit(density);
+	std::vector<bool> bits(length);
+	for (size_t index = 0; index < length; ++index)
+		bits[index] = bit(random);
+	return bits;
+}
+
+/**
+ * @brief Returns the bits of @p bits one by one, the reference the tests compare against
+ */
+inline std::vector<bool> bitsOf(const bitset_t& bits) {
+	std::vector<bool> result(bits.length());
+	for (size_t index = 0; index < bits.length(); ++index)
+		result[index] = bits[index];
+	return result;
+}
+
+/**
+ * @brief Lengths around the word and cache line boundaries of the storage
+ */
+inline std::vector<size_t> boundaryLengths() {
+	return {0, 1, 7, 63, 64, 65, 127, 128, 129, 511, 512, 513, 1000, 4099};
+}
+
+/**
+ * @brief Splits bulk operations across the shared pool from a few words on, and restores the former settings when it goes out of scope
+ *
+ * @details Tests construct one so that operations on bitsets of a few thousand words run the split code paths, which they otherwise take only from bitsetParallelThreshold() words on; the settings are restored even if a check throws.
+ */
+struct parallel_scope_t {
+	const size_t threads;
+	const size_t threshold;
+
+	explicit parallel_scope_t(const size_t splitThreads = 4, const size_t splitThreshold = 1) : threads(bitsetThreads()), threshold(bitsetParallelThreshold()) {
+		setBitsetThreads(splitThreads);
+		setBitsetParallelThreshold(splitThreshold);
+	}
+
+	parallel_scope_t(const parallel_scope_t&) = delete;
+	parallel_scope_t& operator=(const parallel_scope_t&) = delete;
+
+	~parallel_scope_t() {
+		setBitsetThreads(threads);
+		setBitsetParallelThreshold(threshold);
+	}
+};
+
+#endif